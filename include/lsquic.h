@@ -269,6 +269,33 @@ struct lsquic_stream_if {
 /** Default clock granularity is 1000 microseconds */
 #define LSQUIC_DF_CLOCK_GRANULARITY      1000
 
+/** By default, packets are released by the pacer when they are due */
+#define LSQUIC_DF_TXTIME_HORIZON    0
+
+/** By default, each outgoing packet is passed in its own lsquic_out_spec */
+#define LSQUIC_DF_GSO               0
+
+/** By default, advisory tick times are kept in a binary heap */
+#define LSQUIC_DF_ATTQ_WHEEL        0
+
+/** By default, use CUBIC congestion control */
+#define LSQUIC_DF_CC_ALGO           1
+
+/** By default, HyStart++ is off: CUBIC leaves slow start on first loss */
+#define LSQUIC_DF_HYSTART           0
+
+/** By default, every second ackable packet is acknowledged right away */
+#define LSQUIC_DF_ACK_FREQ          2
+
+/** By default, ACK decimation is off */
+#define LSQUIC_DF_ACK_DECIMATION    0
+
+/**
+ * By default, up to 256 ranges of received packets are tracked.  This is
+ * as many as fits into a gQUIC ACK frame.
+ */
+#define LSQUIC_DF_MAX_RECV_RANGES   256
+
 struct lsquic_engine_settings {
     /**
      * This is a bit mask wherein each bit corresponds to a value in
@@ -461,6 +488,114 @@ struct lsquic_engine_settings {
      * is in microseconds; default is @ref LSQUIC_DF_CLOCK_GRANULARITY.
      */
     unsigned        es_clock_granularity;
+
+    /**
+     * If set to a non-zero value, the pacer releases packets up to this
+     * many microseconds before they are due.  Each such packet's departure
+     * time is passed in the `txtime' field of @ref lsquic_out_spec and
+     * the application is expected to hand it to the kernel -- for example,
+     * using the SO_TXTIME socket option together with the fq or etf
+     * qdisc -- which then does the pacing.  This way, fewer engine wakeups
+     * are needed to send out the same number of packets.
+     *
+     * Leave this at zero if `txtime' is ignored by the application:
+     * otherwise, packets go out in bursts and RTT is overestimated.  The
+     * value is in microseconds; it only has effect if packets are paced.
+     *
+     * The default value is @ref LSQUIC_DF_TXTIME_HORIZON.
+     */
+    unsigned        es_txtime_horizon;
+
+    /**
+     * If set to true, consecutive packets from the same connection are
+     * coalesced into a single @ref lsquic_out_spec, which can then be
+     * sent out using a single sendmsg(2) call with the UDP_SEGMENT socket
+     * option (Generic Segmentation Offload).  All datagrams in such a spec
+     * have the same size (`segsz') except for the last one, which may be
+     * shorter.  See @ref lsquic_out_spec.
+     *
+     * The default value is @ref LSQUIC_DF_GSO.
+     */
+    int             es_gso;
+
+    /**
+     * If set to true, the engine keeps connections' advisory tick times
+     * in a hierarchical timer wheel instead of a binary heap.  Adding and
+     * removing a connection is then O(1) instead of O(log N), which helps
+     * when there are many connections.  The wheel resolution is
+     * es_clock_granularity: connections whose tick times fall into the
+     * same slot are processed together.
+     *
+     * The default value is @ref LSQUIC_DF_ATTQ_WHEEL.
+     */
+    int             es_attq_wheel;
+
+    /**
+     * Congestion control algorithm to use:
+     *
+     *  0:  Use default (CUBIC)
+     *  1:  CUBIC
+     *  2:  BBR
+     *
+     * BBR requires pacing: if it is selected, packets are paced regardless
+     * of the value of @ref es_pace_packets.
+     *
+     * If a custom congestion controller is specified using @ref ea_cc_if,
+     * this setting is only used if the custom controller cannot be
+     * created.
+     *
+     * The default value is @ref LSQUIC_DF_CC_ALGO.
+     */
+    unsigned        es_cc_algo;
+
+    /**
+     * If set to true, CUBIC uses HyStart++ (RFC 9406) in slow start.  When
+     * minimum RTT grows from one round trip to the next, the sender slows
+     * down cwnd growth and then leaves slow start before the bottleneck
+     * queue overflows, instead of waiting for the first loss.  This
+     * avoids massive losses on paths with deep buffers.
+     *
+     * HyStart++ is opt-in, so slow start behaves the same as in previous
+     * releases unless this setting is turned on.
+     *
+     * The default value is @ref LSQUIC_DF_HYSTART.
+     */
+    int             es_hystart;
+
+    /**
+     * An ACK is sent as soon as this many ackable packets have been
+     * received since the last ACK.  Otherwise, the ACK is delayed by
+     * up to 25 milliseconds.  Larger values result in fewer ACK-only
+     * packets, at the cost of less precise feedback to the peer.  Must
+     * be at least 1.
+     *
+     * The default value is @ref LSQUIC_DF_ACK_FREQ.
+     */
+    unsigned        es_ack_freq;
+
+    /**
+     * If set to true, ACK decimation is used once the first 100 packets
+     * have been received, which is when the peer is likely to be out of
+     * slow start: an ACK is sent after every 10 ackable packets (or
+     * @ref es_ack_freq, if it is larger), and the ACK delay is shortened
+     * to a quarter of smoothed RTT.  On bulk downloads, this reduces the
+     * number of ACK-only packets the client sends severalfold.
+     *
+     * The default value is @ref LSQUIC_DF_ACK_DECIMATION.
+     */
+    int             es_ack_decimation;
+
+    /**
+     * Maximum number of ranges of received packet numbers a connection
+     * keeps to generate ACK frames.  Each gap in received packet numbers
+     * starts a new range.  Once the limit is reached, the oldest range is
+     * dropped and packets in it are no longer acknowledged; if they arrive
+     * again, they are treated as duplicates.  This bounds per-connection
+     * memory when the loss pattern is adversarial.  Zero means no limit.
+     *
+     * The default value is @ref LSQUIC_DF_MAX_RECV_RANGES.
+     */
+    unsigned        es_max_recv_ranges;
 };
 
 /* Initialize `settings' to default values */
@@ -491,19 +626,40 @@ lsquic_engine_check_settings (const struct lsquic_engine_settings *settings,
 
 struct lsquic_out_spec
 {
+    /** First (and usually the only) datagram */
     const unsigned char   *buf;
     size_t                 sz;
     const struct sockaddr *local_sa;
     const struct sockaddr *dest_sa;
     void                  *peer_ctx;
+    /**
+     * All datagrams described by this spec.  Unless @ref es_gso is set,
+     * `iovlen' is always 1 and `iov' describes the same buffer as `buf'
+     * and `sz'.  If @ref es_gso is set, there may be several datagrams,
+     * each `segsz' bytes long except for the last one, which may be
+     * shorter.
+     */
+    const struct iovec    *iov;
+    size_t                 iovlen;
+    unsigned short         segsz;
+    /**
+     * Earliest departure time in microseconds.  It uses the same clock as
+     * the library (CLOCK_MONOTONIC on Linux), which is the clock used by
+     * the fq qdisc for SO_TXTIME.  Zero means that the datagrams are to be
+     * sent right away.  This is only set if @ref es_txtime_horizon is
+     * non-zero.  Datagrams with departure time are never coalesced.
+     */
+    uint64_t               txtime;
 };
 
 /**
- * Returns number of packets successfully sent out or -1 on error.  -1 should
- * only be returned if no packets were sent out.  If -1 is returned or if the
+ * Returns number of specs successfully sent out or -1 on error.  -1 should
+ * only be returned if no specs were sent out.  If -1 is returned or if the
  * return value is smaller than `n_packets_out', this indicates that sending
  * of packets is not possible  No packets will be attempted to be sent out
  * until @ref lsquic_engine_send_unsent_packets() is called.
+ *
+ * Unless @ref es_gso is set, each spec describes exactly one packet.
  */
 typedef int (*lsquic_packets_out_f)(
     void                          *packets_out_ctx,
@@ -606,6 +762,115 @@ struct lsquic_hset_if
      * header sets that had an error.
      */
     void                (*hsi_discard_header_set)(void *hdr_set);
+    /**
+     * Optional.  If specified, each header is decoded directly into memory
+     * provided by the header set instead of into a temporary buffer.
+     *
+     * Return pointer to a buffer of at least `min_space' bytes and set
+     * `space' to its actual size.  If `min_space' is zero, any size will
+     * do.  The decoded name and value are written to the beginning of the
+     * buffer and the `name' and `value' arguments passed to the following
+     * call to @ref hsi_process_header() point into it.  Because this
+     * memory belongs to the header set, the header set may keep these
+     * pointers for as long as it lives instead of copying name and value.
+     *
+     * If the header does not fit, this callback is called again with a
+     * larger `min_space'.  The contents of the previously returned buffer
+     * are then no longer needed and the memory may be reused.
+     *
+     * Return NULL if the buffer cannot be allocated.
+     */
+    char *              (*hsi_prepare_decode)(void *hdr_set,
+                                    unsigned min_space, unsigned *space);
+};
+
+/**
+ * Congestion controller interface.  Use it to plug in your own
+ * congestion control algorithm by setting @ref ea_cc_if.
+ *
+ * Each connection gets its own controller object, created by cci_create().
+ * The first argument to all other functions is that object.  Packet
+ * numbers increase monotonically; sizes are in bytes and times are in
+ * microseconds.  If a controller needs to keep per-packet state, it keeps
+ * it itself.
+ */
+struct lsquic_cong_ctl_if
+{
+    /**
+     * Create controller for connection `conn'.  `cc_ctx' is
+     * @ref ea_cc_ctx.  If NULL is returned, the connection falls back
+     * to the built-in controller selected by @ref es_cc_algo.
+     */
+    void *
+    (*cci_create) (void *cc_ctx, lsquic_conn_t *conn);
+
+    /**
+     * Called for each packet that is sent.  `bytes_in_flight' does not
+     * include this packet.  `app_limited' is true if the sender has
+     * nothing else to send and the congestion window is not full.
+     */
+    void
+    (*cci_sent) (void *cc, uint64_t packno, unsigned packet_sz,
+                 uint64_t now, unsigned bytes_in_flight, int app_limited);
+
+    /**
+     * Packets acknowledged by a single ACK frame are reported by calls to
+     * cci_ack() between cci_begin_ack() and cci_end_ack().  Losses
+     * detected as a result of processing the ACK frame are reported
+     * before cci_end_ack() is called.
+     */
+    void
+    (*cci_begin_ack) (void *cc, uint64_t ack_time, unsigned bytes_in_flight);
+
+    void
+    (*cci_ack) (void *cc, uint64_t packno, unsigned packet_sz,
+                uint64_t sent, uint64_t now, int app_limited);
+
+    void
+    (*cci_end_ack) (void *cc, unsigned bytes_in_flight);
+
+    /** Called for each packet that is deemed lost */
+    void
+    (*cci_lost) (void *cc, uint64_t packno, unsigned packet_sz);
+
+    /** Called once per loss event, that is, once per window of data */
+    void
+    (*cci_loss) (void *cc);
+
+    /** Retransmission timeout */
+    void
+    (*cci_timeout) (void *cc);
+
+    /**
+     * Called when an ACK arrives after there were no retransmittable
+     * packets in flight.
+     */
+    void
+    (*cci_was_quiet) (void *cc, uint64_t now);
+
+    /** Congestion window in bytes */
+    unsigned long
+    (*cci_get_cwnd) (void *cc);
+
+    /**
+     * Pacing rate in bytes per second.  Only used if packets are paced
+     * (see @ref es_pace_packets).
+     */
+    uint64_t
+    (*cci_pacing_rate) (void *cc, int in_recovery);
+
+    /** Destroy controller.  This is called when connection is destroyed. */
+    void
+    (*cci_destroy) (void *cc);
+
+    /**
+     * Optional.  Called when all packets declared lost in the last loss
+     * event or retransmission timeout have been acknowledged after all:
+     * the controller should restore the state it had before cci_loss()
+     * or cci_timeout() was called.
+     */
+    void
+    (*cci_undo) (void *cc);
 };
 
 /* TODO: describe this important data structure */
@@ -643,6 +908,28 @@ typedef struct lsquic_engine_api
      */
     const struct lsquic_hset_if         *ea_hsi_if;
     void                                *ea_hsi_ctx;
+
+    /**
+     * Optional function to release incoming packet buffers.  If set, the
+     * library takes ownership of buffers passed to
+     * lsquic_engine_packet_in(), lsquic_engine_packets_in(), and
+     * lsquic_engine_packet_in_gro() and decrypts packets in place instead
+     * of copying them.  The buffers must be writeable and remain valid
+     * until released.  The function is called exactly once for each
+     * packet -- for each segment in the GRO case -- whether the packet
+     * was processed or dropped.
+     */
+    void                               (*ea_packin_release)(void *release_ctx,
+                                                            void *buf);
+    void                                *ea_packin_release_ctx;
+
+    /**
+     * Optional congestion controller.  If set, it is used instead of the
+     * built-in controllers and @ref es_cc_algo is only used as fallback.
+     * All callbacks must be specified.
+     */
+    const struct lsquic_cong_ctl_if     *ea_cc_if;
+    void                                *ea_cc_ctx;
 #if LSQUIC_CONN_STATS
     /**
      * If set, engine will print cumulative connection statistics to this
@@ -662,6 +949,54 @@ lsquic_engine_t *
 lsquic_engine_new (unsigned lsquic_engine_flags,
                    const struct lsquic_engine_api *);
 
+/**
+ * Maximum number of engines in an engine group.  The engine index is
+ * encoded into the connection IDs generated by the engine.
+ */
+#define LSQUIC_MAX_ENGINES_IN_GROUP 256
+
+/**
+ * Create a group of `n_engines' client engines, one per thread.  Engine
+ * `i' is created using `apis[i]', which lets each engine have its own
+ * packets-out callback context (socket) and stream callback context.
+ *
+ * Each engine in the group encodes its index in the connection IDs it
+ * generates, which lets lsquic_engine_group_steer() map an incoming packet
+ * to the engine that owns the connection.  For that to work, the server
+ * must include the connection ID in its packets: the group turns off
+ * es_support_tcid0 and versions in LSQUIC_FORCED_TCID0_VERSIONS.
+ *
+ * The library does not create threads: the engines are independent and
+ * each engine must only be used by one thread at a time.
+ *
+ * Returns NULL on error.
+ */
+lsquic_engine_group_t *
+lsquic_engine_group_new (unsigned lsquic_engine_flags,
+                    const struct lsquic_engine_api *apis, unsigned n_engines);
+
+/** Return number of engines in the group */
+unsigned
+lsquic_engine_group_count (const lsquic_engine_group_t *);
+
+/** Return engine number `idx' or NULL if `idx' is out of range */
+lsquic_engine_t *
+lsquic_engine_group_get (lsquic_engine_group_t *, unsigned idx);
+
+/**
+ * Return index of the engine that should process the incoming packet or
+ * -1 if the packet does not contain a connection ID generated by one of
+ * the engines in the group.  The function only reads the packet header
+ * and can be called from any thread.
+ */
+int
+lsquic_engine_group_steer (const lsquic_engine_group_t *,
+                                    const unsigned char *buf, size_t bufsz);
+
+/** Destroy all engines in the group and the group itself */
+void
+lsquic_engine_group_destroy (lsquic_engine_group_t *);
+
 /**
  * Create a client connection to peer identified by `peer_ctx'.
  * If `max_packet_size' is set to zero, it is inferred based on `peer_sa':
@@ -690,6 +1025,63 @@ lsquic_engine_packet_in (lsquic_engine_t *,
         const struct sockaddr *sa_local, const struct sockaddr *sa_peer,
         void *peer_ctx);
 
+/**
+ * Used as argument to @ref lsquic_engine_packets_in().  Describes one
+ * incoming UDP datagram.
+ */
+struct lsquic_in_spec
+{
+    const unsigned char   *buf;
+    size_t                 sz;
+    const struct sockaddr *local_sa;
+    const struct sockaddr *peer_sa;
+    void                  *peer_ctx;
+};
+
+/**
+ * Pass a batch of incoming packets to the QUIC engine.  This is equivalent
+ * to calling @ref lsquic_engine_packet_in() for each element of `specs',
+ * but cheaper: packets are timestamped once per batch and packets that
+ * belong to the same connection are looked up and delivered together.
+ * Relative order of packets belonging to the same connection is preserved.
+ *
+ * As with @ref lsquic_engine_packet_in(), packet data is not referenced
+ * after this function returns -- unless @ref ea_packin_release is set, in
+ * which case the library decrypts each packet in place and releases its
+ * buffer later.
+ *
+ * Packets that cannot be parsed or that do not belong to any connection
+ * are dropped.
+ *
+ * @retval  Number of packets processed by real connections.
+ */
+int
+lsquic_engine_packets_in (lsquic_engine_t *,
+        const struct lsquic_in_spec *specs, unsigned n_specs);
+
+/**
+ * Pass a buffer of coalesced incoming packets to the QUIC engine.  This
+ * is meant to be used with UDP Generic Receive Offload (UDP_GRO socket
+ * option): the kernel delivers several datagrams from the same peer in one
+ * buffer, each `segsz' bytes long except for the last one, which may be
+ * shorter.  The segment size is the value of the UDP_GRO control message.
+ *
+ * The buffer is split into datagrams without copying and they are
+ * processed the same way as in @ref lsquic_engine_packets_in().  The
+ * buffer is not referenced after this function returns -- unless
+ * @ref ea_packin_release is set, in which case each segment is decrypted
+ * in place and released separately.
+ *
+ * @retval -1   `segsz' is zero.  If @ref ea_packin_release is set, the
+ *              buffer is released as a single packet.
+ * @retval  Number of packets processed by real connections otherwise.
+ */
+int
+lsquic_engine_packet_in_gro (lsquic_engine_t *,
+        const unsigned char *buf, size_t bufsz, size_t segsz,
+        const struct sockaddr *sa_local, const struct sockaddr *sa_peer,
+        void *peer_ctx);
+
 /**
  * Process tickable connections.  This function must be called often enough so
  * that packets and connections do not expire.
@@ -750,6 +1142,28 @@ ssize_t lsquic_stream_read(lsquic_stream_t *s, void *buf, size_t len);
 ssize_t lsquic_stream_readv(lsquic_stream_t *s, const struct iovec *,
                                                             int iovcnt);
 
+/**
+ * Read from stream without copying.  Stream data is passed to the callback
+ * `readf' as it is stored in the incoming packets.  `buf' is valid only
+ * for the duration of the call.  `fin' is set if the end of the stream
+ * is at `buf + len'; the end of the stream may also be signaled by a
+ * separate call with `len' set to zero.
+ *
+ * The callback returns the number of bytes it consumed.  Consumed data
+ * is released: once a packet's data has been consumed, the packet is
+ * freed.  If the callback consumes fewer bytes than it is given, the
+ * rest is offered again on the next call.
+ *
+ * Returns the number of bytes consumed or 0 when end of stream has been
+ * reached.  -1 is returned on error, with errno set the same way as by
+ * @ref lsquic_stream_readv().  If no data is available or the callback
+ * consumes nothing, -1 is returned and errno is set to EWOULDBLOCK.
+ */
+ssize_t
+lsquic_stream_readf (lsquic_stream_t *s,
+    size_t (*readf)(void *ctx, const unsigned char *buf, size_t len, int fin),
+    void *ctx);
+
 int lsquic_stream_wantwrite(lsquic_stream_t *s, int is_want);
 
 /**
@@ -17,6 +17,9 @@ typedef uint64_t lsquic_cid_t;
 /** LSQUIC engine */
 typedef struct lsquic_engine lsquic_engine_t;
 
+/** Group of LSQUIC engines */
+typedef struct lsquic_engine_group lsquic_engine_group_t;
+
 /** Connection */
 typedef struct lsquic_conn lsquic_conn_t;
 
@@ -22,8 +22,9 @@
 #include "lsquic_conn.h"
 
 
-struct attq
+struct attq_heap
 {
+    struct attq         aq_base;
     struct malo        *aq_elem_malo;
     struct attq_elem  **aq_heap;
     unsigned            aq_nelem;
@@ -31,10 +32,13 @@ struct attq
 };
 
 
+static const struct attq_iface attq_heap_if;
+
+
 struct attq *
 attq_create (void)
 {
-    struct attq *q;
+    struct attq_heap *q;
     struct malo *malo;
 
     malo = lsquic_malo_create(sizeof(struct attq_elem));
@@ -48,14 +52,17 @@ attq_create (void)
         return NULL;
     }
 
+    q->aq_base.aq_if = &attq_heap_if;
     q->aq_elem_malo = malo;
-    return q;
+    return &q->aq_base;
 }
 
 
-void
-attq_destroy (struct attq *q)
+static void
+attq_heap_destroy (struct attq *aq)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
+
     lsquic_malo_destroy(q->aq_elem_malo);
     free(q->aq_heap);
     free(q);
@@ -70,7 +77,7 @@ attq_destroy (struct attq *q)
 
 #ifndef NDEBUG
 static void
-attq_verify (struct attq *q)
+attq_verify (struct attq_heap *q)
 {
     unsigned i;
 
@@ -91,7 +98,7 @@ attq_verify (struct attq *q)
 
 
 static void
-attq_swap (struct attq *q, unsigned a, unsigned b)
+attq_swap (struct attq_heap *q, unsigned a, unsigned b)
 {
     struct attq_elem *el;
 
@@ -103,10 +110,11 @@ attq_swap (struct attq *q, unsigned a, unsigned b)
 }
 
 
-int
-attq_add (struct attq *q, struct lsquic_conn *conn,
+static int
+attq_heap_add (struct attq *aq, struct lsquic_conn *conn,
                                             lsquic_time_t advisory_time)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
     struct attq_elem *el, **heap;
     unsigned n, i;
 
@@ -149,9 +157,14 @@ attq_add (struct attq *q, struct lsquic_conn *conn,
 }
 
 
-struct lsquic_conn *
-attq_pop (struct attq *q, lsquic_time_t cutoff)
+static void
+attq_heap_remove (struct attq *, struct lsquic_conn *);
+
+
+static struct lsquic_conn *
+attq_heap_pop (struct attq *aq, lsquic_time_t cutoff)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
     struct lsquic_conn *conn;
     struct attq_elem *el;
 
@@ -163,13 +176,13 @@ attq_pop (struct attq *q, lsquic_time_t cutoff)
         return NULL;
 
     conn = el->ae_conn;
-    attq_remove(q, conn);
+    attq_heap_remove(aq, conn);
     return conn;
 }
 
 
 static void
-attq_heapify (struct attq *q, unsigned i)
+attq_heapify (struct attq_heap *q, unsigned i)
 {
     unsigned smallest;
 
@@ -198,9 +211,10 @@ attq_heapify (struct attq *q, unsigned i)
 }
 
 
-void
-attq_remove (struct attq *q, struct lsquic_conn *conn)
+static void
+attq_heap_remove (struct attq *aq, struct lsquic_conn *conn)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
     struct attq_elem *el;
     unsigned idx;
 
@@ -233,9 +247,10 @@ attq_remove (struct attq *q, struct lsquic_conn *conn)
 }
 
 
-unsigned
-attq_count_before (struct attq *q, lsquic_time_t cutoff)
+static unsigned
+attq_heap_count_before (struct attq *aq, lsquic_time_t cutoff)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
     unsigned level, total_count, level_count, i, level_max;
 
     total_count = 0;
@@ -253,11 +268,24 @@ attq_count_before (struct attq *q, lsquic_time_t cutoff)
 }
 
 
-const lsquic_time_t *
-attq_next_time (struct attq *q)
+static const lsquic_time_t *
+attq_heap_next_time (struct attq *aq)
 {
+    struct attq_heap *const q = (struct attq_heap *) aq;
+
     if (q->aq_nelem > 0)
         return &q->aq_heap[0]->ae_adv_time;
     else
         return NULL;
 }
+
+
+static const struct attq_iface attq_heap_if =
+{
+    .aqi_destroy      = attq_heap_destroy,
+    .aqi_add          = attq_heap_add,
+    .aqi_remove       = attq_heap_remove,
+    .aqi_pop          = attq_heap_pop,
+    .aqi_count_before = attq_heap_count_before,
+    .aqi_next_time    = attq_heap_next_time,
+};
@@ -17,30 +17,68 @@ struct attq_elem
 {
     struct lsquic_conn  *ae_conn;
     lsquic_time_t        ae_adv_time;
-    unsigned             ae_heap_idx;
+    unsigned             ae_heap_idx;   /* Heap: index into heap array;
+                                         * wheel: slot index.
+                                         */
+    struct attq_elem    *ae_next,       /* Wheel: slot list linkage */
+                        *ae_prev;
 };
 
 
+struct attq_iface
+{
+    void
+    (*aqi_destroy) (struct attq *);
+
+    /* Return 0 on success, -1 on failure (malloc) */
+    int
+    (*aqi_add) (struct attq *, struct lsquic_conn *,
+                                            lsquic_time_t advisory_time);
+
+    void
+    (*aqi_remove) (struct attq *, struct lsquic_conn *);
+
+    struct lsquic_conn *
+    (*aqi_pop) (struct attq *, lsquic_time_t cutoff);
+
+    unsigned
+    (*aqi_count_before) (struct attq *, lsquic_time_t cutoff);
+
+    const lsquic_time_t *
+    (*aqi_next_time) (struct attq *);
+};
+
+
+struct attq
+{
+    const struct attq_iface *aq_if;
+};
+
+
+/* Binary heap: O(log n) add and remove, exact next time */
 struct attq *
 attq_create (void);
 
-void
-attq_destroy (struct attq *);
+/* Hierarchical timer wheel: O(1) add and remove.  Advisory times are
+ * bucketed into slots `granularity' microseconds wide: attq_next_time()
+ * returns the end of the earliest occupied slot, so that all connections
+ * in the slot can be processed at once.  attq_pop() is exact.  The wheel
+ * starts at time `now' and moves forward with each attq_pop() cutoff.
+ */
+struct attq *
+attq_wheel_create (unsigned granularity, lsquic_time_t now);
+
+#define attq_destroy(q) (q)->aq_if->aqi_destroy(q)
 
-/* Return 0 on success, -1 on failure (malloc) */
-int
-attq_add (struct attq *, struct lsquic_conn *, lsquic_time_t advisory_time);
+#define attq_add(q, conn, advisory_time) \
+    (q)->aq_if->aqi_add(q, conn, advisory_time)
 
-void
-attq_remove (struct attq *, struct lsquic_conn *);
+#define attq_remove(q, conn) (q)->aq_if->aqi_remove(q, conn)
 
-struct lsquic_conn *
-attq_pop (struct attq *, lsquic_time_t cutoff);
+#define attq_pop(q, cutoff) (q)->aq_if->aqi_pop(q, cutoff)
 
-unsigned
-attq_count_before (struct attq *, lsquic_time_t cutoff);
+#define attq_count_before(q, cutoff) (q)->aq_if->aqi_count_before(q, cutoff)
 
-const lsquic_time_t *
-attq_next_time (struct attq *);
+#define attq_next_time(q) (q)->aq_if->aqi_next_time(q)
 
 #endif
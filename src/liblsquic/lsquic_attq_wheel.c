@@ -0,0 +1,437 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_attq_wheel.c -- Advisory Tick Time Queue: hierarchical timer wheel
+ *
+ * Time is divided into ticks `granularity' microseconds long.  Level 0
+ * has one slot per tick and covers the next 256 ticks.  Each of the three
+ * levels above it has 64 slots, each slot covering all of the level below.
+ * Connections due even further in the future are kept on the overflow
+ * list.  When the current tick crosses the boundary of a higher-level
+ * slot, that slot's connections are redistributed ("cascaded") into lower
+ * levels.
+ *
+ * The current tick only moves forward, following the cutoff passed to
+ * attq_pop().  Connections added with advisory time before the current
+ * tick are placed into the current slot.
+ *
+ * Adding and removing a connection is O(1): each slot is an unsorted
+ * doubly-linked list and the element remembers its slot index.  Bitmaps
+ * of occupied slots make it cheap to find the next event, which lets the
+ * wheel skip over idle periods without visiting each tick.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#ifdef WIN32
+#include <vc_compat.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_attq.h"
+#include "lsquic_malo.h"
+#include "lsquic_conn.h"
+
+
+#define AW_L0_BITS      8
+#define AW_LN_BITS      6
+#define AW_N_LEVELS     4       /* Including level 0 */
+#define AW_L0_SIZE      (1U << AW_L0_BITS)
+#define AW_LN_SIZE      (1U << AW_LN_BITS)
+/* Levels 1 and above: */
+#define AW_SHIFT(level) (AW_L0_BITS + ((level) - 1) * AW_LN_BITS)
+#define AW_SLOT(level, idx) (AW_L0_SIZE + ((level) - 1) * AW_LN_SIZE + (idx))
+#define AW_OVERFLOW     AW_SLOT(AW_N_LEVELS, 0)
+#define AW_N_SLOTS      (AW_OVERFLOW + 1)
+
+
+struct attq_wheel
+{
+    struct attq          aw_base;
+    struct malo         *aw_elem_malo;
+    uint64_t             aw_cur;            /* Current tick */
+    unsigned             aw_granularity;
+    unsigned             aw_nelem;
+    lsquic_time_t        aw_next_time;
+    uint64_t             aw_l0_bits[AW_L0_SIZE / 64];
+    uint64_t             aw_ln_bits[AW_N_LEVELS - 1];
+    struct attq_elem    *aw_slots[AW_N_SLOTS];
+};
+
+
+#if __GNUC__
+#   define ctz __builtin_ctzll
+#else
+static unsigned
+ctz (unsigned long long x)
+{
+    unsigned n = 0;
+    if (0 == (x & ((1ULL << 32) - 1))) { n += 32; x >>= 32; }
+    if (0 == (x & ((1ULL << 16) - 1))) { n += 16; x >>= 16; }
+    if (0 == (x & ((1ULL <<  8) - 1))) { n +=  8; x >>=  8; }
+    if (0 == (x & ((1ULL <<  4) - 1))) { n +=  4; x >>=  4; }
+    if (0 == (x & ((1ULL <<  2) - 1))) { n +=  2; x >>=  2; }
+    if (0 == (x & ((1ULL <<  1) - 1))) { n +=  1; x >>=  1; }
+    return n;
+}
+
+
+#endif
+
+
+static const struct attq_iface attq_wheel_if;
+
+
+struct attq *
+attq_wheel_create (unsigned granularity, lsquic_time_t now)
+{
+    struct attq_wheel *q;
+    struct malo *malo;
+
+    malo = lsquic_malo_create(sizeof(struct attq_elem));
+    if (!malo)
+        return NULL;
+
+    q = calloc(1, sizeof(*q));
+    if (!q)
+    {
+        lsquic_malo_destroy(malo);
+        return NULL;
+    }
+
+    q->aw_base.aq_if = &attq_wheel_if;
+    q->aw_elem_malo = malo;
+    q->aw_granularity = granularity ? granularity : 1;
+    q->aw_cur = now / q->aw_granularity;
+    return &q->aw_base;
+}
+
+
+static void
+attq_wheel_destroy (struct attq *aq)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+
+    lsquic_malo_destroy(q->aw_elem_malo);
+    free(q);
+}
+
+
+static void
+wheel_set_bit (struct attq_wheel *q, unsigned slot)
+{
+    if (slot < AW_L0_SIZE)
+        q->aw_l0_bits[slot >> 6] |= 1ULL << (slot & 63);
+    else if (slot < AW_OVERFLOW)
+        q->aw_ln_bits[(slot - AW_L0_SIZE) / AW_LN_SIZE]
+                                |= 1ULL << ((slot - AW_L0_SIZE) % AW_LN_SIZE);
+}
+
+
+static void
+wheel_clear_bit (struct attq_wheel *q, unsigned slot)
+{
+    if (slot < AW_L0_SIZE)
+        q->aw_l0_bits[slot >> 6] &= ~(1ULL << (slot & 63));
+    else if (slot < AW_OVERFLOW)
+        q->aw_ln_bits[(slot - AW_L0_SIZE) / AW_LN_SIZE]
+                            &= ~(1ULL << ((slot - AW_L0_SIZE) % AW_LN_SIZE));
+}
+
+
+static void
+wheel_place (struct attq_wheel *q, struct attq_elem *el)
+{
+    uint64_t tick, delta;
+    unsigned level, slot;
+
+    tick = el->ae_adv_time / q->aw_granularity;
+    if (tick < q->aw_cur)
+        tick = q->aw_cur;
+    delta = tick - q->aw_cur;
+
+    if (delta < AW_L0_SIZE)
+        slot = tick & (AW_L0_SIZE - 1);
+    else
+    {
+        for (level = 1; level < AW_N_LEVELS; ++level)
+            if (delta < 1ULL << AW_SHIFT(level + 1))
+                break;
+        if (level < AW_N_LEVELS)
+            slot = AW_SLOT(level,
+                            (tick >> AW_SHIFT(level)) & (AW_LN_SIZE - 1));
+        else
+            slot = AW_OVERFLOW;
+    }
+
+    el->ae_heap_idx = slot;
+    el->ae_prev = NULL;
+    el->ae_next = q->aw_slots[slot];
+    if (el->ae_next)
+        el->ae_next->ae_prev = el;
+    else
+        wheel_set_bit(q, slot);
+    q->aw_slots[slot] = el;
+}
+
+
+static void
+wheel_unlink (struct attq_wheel *q, struct attq_elem *el)
+{
+    const unsigned slot = el->ae_heap_idx;
+
+    if (el->ae_prev)
+        el->ae_prev->ae_next = el->ae_next;
+    else
+        q->aw_slots[slot] = el->ae_next;
+    if (el->ae_next)
+        el->ae_next->ae_prev = el->ae_prev;
+    if (!q->aw_slots[slot])
+        wheel_clear_bit(q, slot);
+}
+
+
+/* Put elements in `slot' where they belong given the current tick */
+static void
+wheel_replace_slot (struct attq_wheel *q, unsigned slot)
+{
+    struct attq_elem *el, *next;
+
+    el = q->aw_slots[slot];
+    q->aw_slots[slot] = NULL;
+    wheel_clear_bit(q, slot);
+    for ( ; el; el = next)
+    {
+        next = el->ae_next;
+        wheel_place(q, el);
+    }
+}
+
+
+/* Called when the current tick is at the start of a level 1 slot */
+static void
+wheel_cascade (struct attq_wheel *q)
+{
+    unsigned level, idx;
+
+    assert(0 == (q->aw_cur & (AW_L0_SIZE - 1)));
+    for (level = 1; level < AW_N_LEVELS; ++level)
+    {
+        idx = (q->aw_cur >> AW_SHIFT(level)) & (AW_LN_SIZE - 1);
+        wheel_replace_slot(q, AW_SLOT(level, idx));
+        if (idx != 0)
+            return;
+    }
+    wheel_replace_slot(q, AW_OVERFLOW);
+}
+
+
+/* Return distance from `from' to the next set bit, going around.  `from'
+ * itself is 64 slots away.
+ */
+static unsigned
+next_bit_after (uint64_t bits, unsigned from)
+{
+    const unsigned rot = (from + 1) & 63;
+
+    assert(bits);
+    if (rot)
+        bits = (bits >> rot) | (bits << (64 - rot));
+    return ctz(bits) + 1;
+}
+
+
+/* Return distance from the current tick to the next occupied level 0 slot
+ * or AW_L0_SIZE if level 0 is empty.
+ */
+static unsigned
+wheel_l0_distance (const struct attq_wheel *q)
+{
+    const unsigned from = q->aw_cur & (AW_L0_SIZE - 1);
+    unsigned i, word;
+    uint64_t bits;
+
+    word = from >> 6;
+    bits = q->aw_l0_bits[word] & (~0ULL << (from & 63));
+    for (i = 0; i <= AW_L0_SIZE / 64; ++i)
+    {
+        if (bits)
+            return ((word << 6) + ctz(bits) - from) & (AW_L0_SIZE - 1);
+        word = (word + 1) & (AW_L0_SIZE / 64 - 1);
+        bits = q->aw_l0_bits[word];
+    }
+    return AW_L0_SIZE;
+}
+
+
+/* Return the next tick at which there is something to do: either a level
+ * 0 slot is occupied or a non-empty higher-level slot is to be cascaded.
+ * The wheel must not be empty.
+ */
+static uint64_t
+wheel_next_tick (const struct attq_wheel *q)
+{
+    uint64_t tick, best;
+    unsigned level, dist, shift;
+
+    assert(q->aw_nelem > 0);
+
+    best = UINT64_MAX;
+    dist = wheel_l0_distance(q);
+    if (dist < AW_L0_SIZE)
+        best = q->aw_cur + dist;
+
+    for (level = 1; level < AW_N_LEVELS; ++level)
+        if (q->aw_ln_bits[level - 1])
+        {
+            shift = AW_SHIFT(level);
+            dist = next_bit_after(q->aw_ln_bits[level - 1],
+                                (q->aw_cur >> shift) & (AW_LN_SIZE - 1));
+            tick = ((q->aw_cur >> shift) + dist) << shift;
+            if (tick < best)
+                best = tick;
+        }
+
+    if (q->aw_slots[AW_OVERFLOW])
+    {
+        shift = AW_SHIFT(AW_N_LEVELS);
+        tick = ((q->aw_cur >> shift) + 1) << shift;
+        if (tick < best)
+            best = tick;
+    }
+
+    assert(best != UINT64_MAX);
+    return best;
+}
+
+
+static int
+attq_wheel_add (struct attq *aq, struct lsquic_conn *conn,
+                                            lsquic_time_t advisory_time)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+    struct attq_elem *el;
+
+    el = lsquic_malo_get(q->aw_elem_malo);
+    if (!el)
+        return -1;
+    el->ae_adv_time = advisory_time;
+
+    el->ae_conn = conn;
+    conn->cn_attq_elem = el;
+
+    ++q->aw_nelem;
+    wheel_place(q, el);
+    return 0;
+}
+
+
+static void
+attq_wheel_remove (struct attq *aq, struct lsquic_conn *conn)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+    struct attq_elem *el;
+
+    el = conn->cn_attq_elem;
+    assert(q->aw_nelem > 0);
+    assert(el->ae_conn == conn);
+
+    wheel_unlink(q, el);
+    --q->aw_nelem;
+    conn->cn_attq_elem = NULL;
+    lsquic_malo_put(el);
+}
+
+
+static struct lsquic_conn *
+attq_wheel_pop (struct attq *aq, lsquic_time_t cutoff)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+    struct lsquic_conn *conn;
+    struct attq_elem *el;
+    uint64_t cutoff_tick, tick;
+
+    /* All slots before the cutoff tick are due in their entirety */
+    cutoff_tick = cutoff / q->aw_granularity;
+
+    if (q->aw_nelem == 0)
+    {
+        /* Keep up with time, so that new elements are placed correctly */
+        if (q->aw_cur < cutoff_tick)
+            q->aw_cur = cutoff_tick;
+        return NULL;
+    }
+    for (;;)
+    {
+        el = q->aw_slots[q->aw_cur & (AW_L0_SIZE - 1)];
+        if (q->aw_cur >= cutoff_tick)
+        {
+            for ( ; el; el = el->ae_next)
+                if (el->ae_adv_time < cutoff)
+                    break;
+            if (!el)
+                return NULL;
+            break;
+        }
+        else if (el)
+            break;
+        else
+        {
+            tick = wheel_next_tick(q);
+            q->aw_cur = tick < cutoff_tick ? tick : cutoff_tick;
+            if (0 == (q->aw_cur & (AW_L0_SIZE - 1)))
+                wheel_cascade(q);
+        }
+    }
+
+    conn = el->ae_conn;
+    attq_wheel_remove(aq, conn);
+    return conn;
+}
+
+
+static unsigned
+attq_wheel_count_before (struct attq *aq, lsquic_time_t cutoff)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+    const struct attq_elem *el;
+    unsigned slot, count;
+
+    count = 0;
+    for (slot = 0; slot < AW_N_SLOTS; ++slot)
+        for (el = q->aw_slots[slot]; el; el = el->ae_next)
+            count += el->ae_adv_time < cutoff;
+
+    return count;
+}
+
+
+/* Return end of the first slot that has something in it.  This way, all
+ * connections in the slot are processed at once.
+ */
+static const lsquic_time_t *
+attq_wheel_next_time (struct attq *aq)
+{
+    struct attq_wheel *const q = (struct attq_wheel *) aq;
+
+    if (q->aw_nelem > 0)
+    {
+        q->aw_next_time = (wheel_next_tick(q) + 1) * q->aw_granularity;
+        return &q->aw_next_time;
+    }
+    else
+        return NULL;
+}
+
+
+static const struct attq_iface attq_wheel_if =
+{
+    .aqi_destroy      = attq_wheel_destroy,
+    .aqi_add          = attq_wheel_add,
+    .aqi_remove       = attq_wheel_remove,
+    .aqi_pop          = attq_wheel_pop,
+    .aqi_count_before = attq_wheel_count_before,
+    .aqi_next_time    = attq_wheel_next_time,
+};
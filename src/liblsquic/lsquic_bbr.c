@@ -0,0 +1,647 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_bbr.c -- LSQUIC BBR implementation.
+ *
+ * BBR builds a model of the path from the maximum delivery rate and the
+ * minimum round-trip time it observes and paces packets at the estimated
+ * bottleneck bandwidth.  Unlike CUBIC, it does not treat packet loss as a
+ * signal of congestion.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
+#include "lsquic_bbr.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn_public.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_BBR
+#define LSQUIC_LOG_CONN_ID bbr->bbr_cid
+#include "lsquic_logger.h"
+
+#define BBR_MSS 1460
+
+/* 2/ln(2): the smallest gain that allows the sending rate to double each
+ * round trip.
+ */
+#define BBR_HIGH_GAIN           2.885
+#define BBR_DRAIN_GAIN          (1.0 / BBR_HIGH_GAIN)
+#define BBR_CWND_GAIN           2.0
+
+/* Bandwidth filter window, in round trips */
+#define BBR_BW_FILTER_LEN       10
+
+/* If minimum RTT has not been updated for this long, probe for it */
+#define BBR_MIN_RTT_FILTER_LEN  (10 * 1000000)
+#define BBR_PROBE_RTT_TIME      (200 * 1000)
+
+/* The pipe is full when bandwidth does not grow by 25% in three rounds */
+#define BBR_FULL_BW_THRESH      1.25
+#define BBR_FULL_BW_COUNT       3
+
+#define BBR_INIT_CWND           (32 * BBR_MSS)
+#define BBR_MIN_CWND            (4 * BBR_MSS)
+
+/* Used to calculate the initial pacing rate if there is no RTT sample */
+#define BBR_INITIAL_RTT         (100 * 1000)
+
+#define BBR_CYCLE_LEN           8
+
+static const double pacing_gain_cycle[BBR_CYCLE_LEN] = {
+    1.25, 0.75, 1, 1, 1, 1, 1, 1,
+};
+
+static const char *const mode2str[] = {
+    [BBR_MODE_STARTUP]   = "STARTUP",
+    [BBR_MODE_DRAIN]     = "DRAIN",
+    [BBR_MODE_PROBE_BW]  = "PROBE_BW",
+    [BBR_MODE_PROBE_RTT] = "PROBE_RTT",
+};
+
+
+static void
+bbr_set_mode (struct lsquic_bbr *bbr, enum bbr_mode mode)
+{
+    if (bbr->bbr_mode != mode)
+    {
+        LSQ_DEBUG("mode change %s -> %s", mode2str[bbr->bbr_mode],
+                                                            mode2str[mode]);
+        bbr->bbr_mode = mode;
+    }
+}
+
+
+static void
+bbr_enter_startup (struct lsquic_bbr *bbr)
+{
+    bbr_set_mode(bbr, BBR_MODE_STARTUP);
+    bbr->bbr_pacing_gain = BBR_HIGH_GAIN;
+    bbr->bbr_cwnd_gain   = BBR_HIGH_GAIN;
+}
+
+
+static int
+bbr_init (void *cong_ctl, const struct lsquic_conn_public *conn_pub)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    memset(bbr, 0, sizeof(*bbr));
+    bbr->bbr_cid = conn_pub->lconn->cn_cid;
+    bbr->bbr_rtt_stats = &conn_pub->rtt_stats;
+    lsquic_bw_sampler_init(&bbr->bbr_bw_sampler, bbr->bbr_cid);
+    minmax_init(&bbr->bbr_max_bandwidth, BBR_BW_FILTER_LEN);
+    bbr->bbr_init_cwnd = BBR_INIT_CWND;
+    bbr->bbr_min_cwnd  = BBR_MIN_CWND;
+    bbr->bbr_cwnd      = bbr->bbr_init_cwnd;
+    bbr->bbr_mode      = BBR_MODE_STARTUP;
+    bbr_enter_startup(bbr);
+    LSQ_INFO("initialized");
+    return 0;
+}
+
+
+static void
+bbr_cleanup (void *cong_ctl)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    lsquic_bw_sampler_cleanup(&bbr->bbr_bw_sampler);
+    LSQ_DEBUG("cleanup");
+}
+
+
+/* Congestion window needed to fill the pipe, scaled by `gain' */
+static unsigned long
+bbr_inflight (const struct lsquic_bbr *bbr, double gain)
+{
+    uint64_t bw, bdp;
+
+    bw = lsquic_bbr_get_bandwidth(bbr);
+    if (bw == 0 || bbr->bbr_min_rtt == 0)
+        return bbr->bbr_init_cwnd;
+
+    bdp = bw * bbr->bbr_min_rtt / 1000000;
+    /* Allow for delayed and stretched ACKs: add three packets */
+    return (unsigned long) (gain * bdp) + 3 * BBR_MSS;
+}
+
+
+static unsigned long
+bbr_save_cwnd (const struct lsquic_bbr *bbr)
+{
+    if (!(bbr->bbr_flags & BBR_FLAG_IN_RECOVERY)
+                                    && bbr->bbr_mode != BBR_MODE_PROBE_RTT)
+        return bbr->bbr_cwnd;
+    else if (bbr->bbr_prior_cwnd > bbr->bbr_cwnd)
+        return bbr->bbr_prior_cwnd;
+    else
+        return bbr->bbr_cwnd;
+}
+
+
+static void
+bbr_restore_cwnd (struct lsquic_bbr *bbr)
+{
+    if (bbr->bbr_cwnd < bbr->bbr_prior_cwnd)
+        bbr->bbr_cwnd = bbr->bbr_prior_cwnd;
+}
+
+
+static void
+bbr_sent (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t now, unsigned bytes_in_flight, int app_limited)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    if (app_limited)
+        lsquic_bw_sampler_app_limited(&bbr->bbr_bw_sampler);
+    (void) lsquic_bw_sampler_packet_sent(&bbr->bbr_bw_sampler, packno,
+                                            packet_sz, now, bytes_in_flight);
+    bbr->bbr_last_sent_packno = packno;
+    bbr->bbr_bytes_in_flight = bytes_in_flight + packet_sz;
+}
+
+
+static void
+bbr_begin_ack (void *cong_ctl, lsquic_time_t ack_time,
+                                                    unsigned bytes_in_flight)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    memset(&bbr->bbr_ack_state, 0, sizeof(bbr->bbr_ack_state));
+    bbr->bbr_ack_state.ack_time = ack_time;
+    bbr->bbr_ack_state.prior_in_flight = bytes_in_flight;
+}
+
+
+static void
+bbr_ack (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t sent, lsquic_time_t now, int app_limited)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+    struct bw_sample sample;
+    lsquic_time_t rtt;
+
+    if (0 == lsquic_bw_sampler_packet_acked(&bbr->bbr_bw_sampler, packno,
+                                                                now, &sample))
+    {
+        /* Use the sample from the most recently sent packet */
+        if (!bbr->bbr_ack_state.have_sample
+            || sample.prior_delivered
+                            >= bbr->bbr_ack_state.sample.prior_delivered)
+        {
+            bbr->bbr_ack_state.sample = sample;
+            bbr->bbr_ack_state.have_sample = 1;
+        }
+    }
+
+    bbr->bbr_ack_state.acked_bytes += packet_sz;
+    if (packno > bbr->bbr_ack_state.largest_acked)
+        bbr->bbr_ack_state.largest_acked = packno;
+    rtt = now - sent;
+    if (bbr->bbr_ack_state.min_rtt == 0 || rtt < bbr->bbr_ack_state.min_rtt)
+        bbr->bbr_ack_state.min_rtt = rtt;
+}
+
+
+static void
+bbr_lost (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    lsquic_bw_sampler_packet_lost(&bbr->bbr_bw_sampler, packno);
+    bbr->bbr_ack_state.lost_bytes += packet_sz;
+    if (bbr->bbr_flags & BBR_FLAG_IN_RECOVERY)
+    {
+        if (bbr->bbr_cwnd > packet_sz + BBR_MSS)
+            bbr->bbr_cwnd -= packet_sz;
+        else
+            bbr->bbr_cwnd = BBR_MSS;
+    }
+}
+
+
+static void
+bbr_enter_recovery (struct lsquic_bbr *bbr, unsigned long cwnd)
+{
+    if (!(bbr->bbr_flags & BBR_FLAG_IN_RECOVERY))
+        bbr->bbr_prior_cwnd = bbr_save_cwnd(bbr);
+    bbr->bbr_flags |= BBR_FLAG_IN_RECOVERY;
+    bbr->bbr_end_recovery_at = bbr->bbr_last_sent_packno;
+    bbr->bbr_cwnd = cwnd;
+}
+
+
+static void
+bbr_loss (void *cong_ctl)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+    unsigned long cwnd;
+
+    if (bbr->bbr_flags & BBR_FLAG_IN_RECOVERY)
+        return;
+
+    /* Packet conservation: for the first round of recovery, send only as
+     * many packets as are acknowledged.
+     */
+    cwnd = bbr->bbr_bytes_in_flight;
+    if (bbr->bbr_ack_state.acked_bytes > BBR_MSS)
+        cwnd += bbr->bbr_ack_state.acked_bytes;
+    else
+        cwnd += BBR_MSS;
+    bbr_enter_recovery(bbr, cwnd);
+    bbr->bbr_flags |= BBR_FLAG_CONSERVATION;
+    bbr->bbr_next_round_delivered =
+                    lsquic_bw_sampler_total_acked(&bbr->bbr_bw_sampler);
+    LSQ_INFO("loss detected, enter recovery; cwnd: %lu; prior cwnd: %lu",
+                                        bbr->bbr_cwnd, bbr->bbr_prior_cwnd);
+}
+
+
+static void
+bbr_timeout (void *cong_ctl)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    bbr_enter_recovery(bbr, bbr->bbr_min_cwnd);
+    bbr->bbr_flags &= ~BBR_FLAG_CONSERVATION;
+    LSQ_INFO("timeout, cwnd: %lu", bbr->bbr_cwnd);
+}
+
+
+static void
+bbr_set_pacing_rate (struct lsquic_bbr *bbr, double gain)
+{
+    uint64_t rate;
+
+    rate = (uint64_t) (gain * lsquic_bbr_get_bandwidth(bbr));
+    if (rate == 0)
+        return;
+
+    /* Before the pipe is full, do not lower the pacing rate: the initial
+     * estimate may be lower than the initial rate.
+     */
+    if ((bbr->bbr_flags & BBR_FLAG_FILLED_PIPE) || rate > bbr->bbr_pacing_rate)
+        bbr->bbr_pacing_rate = rate;
+}
+
+
+static void
+bbr_was_quiet (void *cong_ctl, lsquic_time_t now)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    LSQ_DEBUG("restart from idle");
+    bbr->bbr_flags |= BBR_FLAG_IDLE_RESTART;
+    lsquic_bw_sampler_app_limited(&bbr->bbr_bw_sampler);
+    if (bbr->bbr_mode == BBR_MODE_PROBE_BW)
+        bbr_set_pacing_rate(bbr, 1.0);
+}
+
+
+static void
+bbr_enter_probe_bw (struct lsquic_bbr *bbr, lsquic_time_t now)
+{
+    unsigned idx;
+
+    bbr_set_mode(bbr, BBR_MODE_PROBE_BW);
+    bbr->bbr_cwnd_gain = BBR_CWND_GAIN;
+    /* Start at a random phase other than the draining one, so that flows
+     * sharing a bottleneck do not probe in lockstep.
+     */
+    idx = (unsigned) ((now / 1000 + bbr->bbr_cid) % (BBR_CYCLE_LEN - 1));
+    if (idx >= 1)
+        ++idx;
+    bbr->bbr_cycle_idx = idx;
+    bbr->bbr_pacing_gain = pacing_gain_cycle[idx];
+    bbr->bbr_cycle_stamp = now;
+}
+
+
+static void
+bbr_update_round (struct lsquic_bbr *bbr)
+{
+    if (bbr->bbr_ack_state.have_sample
+        && bbr->bbr_ack_state.sample.prior_delivered
+                                            >= bbr->bbr_next_round_delivered)
+    {
+        bbr->bbr_next_round_delivered =
+                    lsquic_bw_sampler_total_acked(&bbr->bbr_bw_sampler);
+        ++bbr->bbr_round_count;
+        bbr->bbr_flags |= BBR_FLAG_ROUND_START;
+        bbr->bbr_flags &= ~BBR_FLAG_CONSERVATION;
+    }
+    else
+        bbr->bbr_flags &= ~BBR_FLAG_ROUND_START;
+}
+
+
+static void
+bbr_update_bandwidth (struct lsquic_bbr *bbr)
+{
+    const struct bw_sample *const sample = &bbr->bbr_ack_state.sample;
+
+    if (!bbr->bbr_ack_state.have_sample)
+        return;
+
+    /* Application-limited samples underestimate the bandwidth: only use
+     * them if they are larger than the current estimate.
+     */
+    if (sample->bandwidth >= lsquic_bbr_get_bandwidth(bbr)
+                                                || !sample->is_app_limited)
+        lsquic_minmax_upmax(&bbr->bbr_max_bandwidth, bbr->bbr_round_count,
+                                                        sample->bandwidth);
+}
+
+
+static void
+bbr_check_recovery_exit (struct lsquic_bbr *bbr)
+{
+    if ((bbr->bbr_flags & BBR_FLAG_IN_RECOVERY)
+        && bbr->bbr_ack_state.largest_acked > bbr->bbr_end_recovery_at)
+    {
+        bbr->bbr_flags &= ~(BBR_FLAG_IN_RECOVERY|BBR_FLAG_CONSERVATION);
+        bbr_restore_cwnd(bbr);
+        LSQ_INFO("exit recovery, cwnd: %lu", bbr->bbr_cwnd);
+    }
+}
+
+
+/* BBR does not reduce its bandwidth model on loss: only recovery needs to
+ * be undone.
+ */
+static void
+bbr_undo (void *cong_ctl)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    if (bbr->bbr_flags & BBR_FLAG_IN_RECOVERY)
+    {
+        bbr->bbr_flags &= ~(BBR_FLAG_IN_RECOVERY|BBR_FLAG_CONSERVATION);
+        bbr_restore_cwnd(bbr);
+        LSQ_INFO("spurious loss, exit recovery, cwnd: %lu", bbr->bbr_cwnd);
+    }
+}
+
+
+static int
+bbr_is_next_cycle_phase (const struct lsquic_bbr *bbr, unsigned bytes_in_flight)
+{
+    int is_full_length;
+
+    is_full_length = bbr->bbr_ack_state.ack_time - bbr->bbr_cycle_stamp
+                                                            > bbr->bbr_min_rtt;
+    if (bbr->bbr_pacing_gain > 1)
+        return is_full_length
+            && (bbr->bbr_ack_state.lost_bytes > 0
+                || bbr->bbr_ack_state.prior_in_flight
+                                >= bbr_inflight(bbr, bbr->bbr_pacing_gain));
+    else if (bbr->bbr_pacing_gain < 1)
+        return is_full_length
+            || bytes_in_flight <= bbr_inflight(bbr, 1.0);
+    else
+        return is_full_length;
+}
+
+
+static void
+bbr_update_cycle_phase (struct lsquic_bbr *bbr, unsigned bytes_in_flight)
+{
+    if (bbr->bbr_mode == BBR_MODE_PROBE_BW
+                            && bbr_is_next_cycle_phase(bbr, bytes_in_flight))
+    {
+        bbr->bbr_cycle_idx = (bbr->bbr_cycle_idx + 1) % BBR_CYCLE_LEN;
+        bbr->bbr_cycle_stamp = bbr->bbr_ack_state.ack_time;
+        bbr->bbr_pacing_gain = pacing_gain_cycle[ bbr->bbr_cycle_idx ];
+    }
+}
+
+
+static void
+bbr_check_full_pipe (struct lsquic_bbr *bbr)
+{
+    uint64_t bw;
+
+    if ((bbr->bbr_flags & BBR_FLAG_FILLED_PIPE)
+                || !(bbr->bbr_flags & BBR_FLAG_ROUND_START)
+                || bbr->bbr_ack_state.sample.is_app_limited)
+        return;
+
+    bw = lsquic_bbr_get_bandwidth(bbr);
+    if (bw >= bbr->bbr_full_bw * BBR_FULL_BW_THRESH)
+    {
+        bbr->bbr_full_bw = bw;
+        bbr->bbr_full_bw_count = 0;
+        return;
+    }
+
+    if (++bbr->bbr_full_bw_count >= BBR_FULL_BW_COUNT)
+    {
+        bbr->bbr_flags |= BBR_FLAG_FILLED_PIPE;
+        LSQ_INFO("pipe is full; bandwidth: %"PRIu64" bytes/sec", bw);
+    }
+}
+
+
+static void
+bbr_check_drain (struct lsquic_bbr *bbr, unsigned bytes_in_flight)
+{
+    if (bbr->bbr_mode == BBR_MODE_STARTUP
+                                && (bbr->bbr_flags & BBR_FLAG_FILLED_PIPE))
+    {
+        bbr_set_mode(bbr, BBR_MODE_DRAIN);
+        bbr->bbr_pacing_gain = BBR_DRAIN_GAIN;
+        bbr->bbr_cwnd_gain   = BBR_HIGH_GAIN;
+    }
+
+    if (bbr->bbr_mode == BBR_MODE_DRAIN
+                            && bytes_in_flight <= bbr_inflight(bbr, 1.0))
+        bbr_enter_probe_bw(bbr, bbr->bbr_ack_state.ack_time);
+}
+
+
+static void
+bbr_exit_probe_rtt (struct lsquic_bbr *bbr, lsquic_time_t now)
+{
+    if (bbr->bbr_flags & BBR_FLAG_FILLED_PIPE)
+        bbr_enter_probe_bw(bbr, now);
+    else
+        bbr_enter_startup(bbr);
+}
+
+
+static void
+bbr_update_min_rtt (struct lsquic_bbr *bbr, unsigned bytes_in_flight)
+{
+    const lsquic_time_t now = bbr->bbr_ack_state.ack_time;
+    const lsquic_time_t rtt = bbr->bbr_ack_state.min_rtt;
+    int expired;
+
+    expired = bbr->bbr_min_rtt_stamp
+            && now > bbr->bbr_min_rtt_stamp + BBR_MIN_RTT_FILTER_LEN;
+    if (rtt && (bbr->bbr_min_rtt == 0 || rtt <= bbr->bbr_min_rtt || expired))
+    {
+        if (rtt != bbr->bbr_min_rtt)
+            LSQ_DEBUG("min_rtt: %"PRIu64" usec", rtt);
+        bbr->bbr_min_rtt = rtt;
+        bbr->bbr_min_rtt_stamp = now;
+    }
+
+    if (expired && bbr->bbr_mode != BBR_MODE_PROBE_RTT
+                                && !(bbr->bbr_flags & BBR_FLAG_IDLE_RESTART))
+    {
+        bbr_set_mode(bbr, BBR_MODE_PROBE_RTT);
+        bbr->bbr_pacing_gain = 1;
+        bbr->bbr_cwnd_gain   = 1;
+        bbr->bbr_prior_cwnd  = bbr_save_cwnd(bbr);
+        bbr->bbr_probe_rtt_done_stamp = 0;
+    }
+
+    if (bbr->bbr_mode != BBR_MODE_PROBE_RTT)
+        return;
+
+    /* Do not let the time spent with a small window count as
+     * application-limited.
+     */
+    lsquic_bw_sampler_app_limited(&bbr->bbr_bw_sampler);
+    if (bbr->bbr_probe_rtt_done_stamp == 0
+                                    && bytes_in_flight <= bbr->bbr_min_cwnd)
+    {
+        bbr->bbr_probe_rtt_done_stamp = now + BBR_PROBE_RTT_TIME;
+        bbr->bbr_flags &= ~BBR_FLAG_PROBE_RTT_ROUND_DONE;
+        bbr->bbr_next_round_delivered =
+                    lsquic_bw_sampler_total_acked(&bbr->bbr_bw_sampler);
+    }
+    else if (bbr->bbr_probe_rtt_done_stamp)
+    {
+        if (bbr->bbr_flags & BBR_FLAG_ROUND_START)
+            bbr->bbr_flags |= BBR_FLAG_PROBE_RTT_ROUND_DONE;
+        if ((bbr->bbr_flags & BBR_FLAG_PROBE_RTT_ROUND_DONE)
+                                    && now > bbr->bbr_probe_rtt_done_stamp)
+        {
+            bbr->bbr_min_rtt_stamp = now;
+            bbr_restore_cwnd(bbr);
+            bbr_exit_probe_rtt(bbr, now);
+        }
+    }
+}
+
+
+static void
+bbr_set_cwnd (struct lsquic_bbr *bbr, unsigned bytes_in_flight)
+{
+    const uint64_t acked = bbr->bbr_ack_state.acked_bytes;
+    unsigned long target;
+
+    target = bbr_inflight(bbr, bbr->bbr_cwnd_gain);
+    if (bbr->bbr_flags & BBR_FLAG_CONSERVATION)
+    {
+        if (bbr->bbr_cwnd < bytes_in_flight + acked)
+            bbr->bbr_cwnd = bytes_in_flight + acked;
+    }
+    else if (bbr->bbr_flags & BBR_FLAG_FILLED_PIPE)
+    {
+        if (bbr->bbr_cwnd + acked < target)
+            bbr->bbr_cwnd += acked;
+        else
+            bbr->bbr_cwnd = target;
+    }
+    else if (bbr->bbr_cwnd < target
+        || lsquic_bw_sampler_total_acked(&bbr->bbr_bw_sampler)
+                                                        < bbr->bbr_init_cwnd)
+        bbr->bbr_cwnd += acked;
+
+    if (bbr->bbr_cwnd < bbr->bbr_min_cwnd)
+        bbr->bbr_cwnd = bbr->bbr_min_cwnd;
+    if (bbr->bbr_mode == BBR_MODE_PROBE_RTT
+                                    && bbr->bbr_cwnd > bbr->bbr_min_cwnd)
+        bbr->bbr_cwnd = bbr->bbr_min_cwnd;
+}
+
+
+static void
+bbr_end_ack (void *cong_ctl, unsigned bytes_in_flight)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    bbr->bbr_bytes_in_flight = bytes_in_flight;
+    if (bbr->bbr_ack_state.acked_bytes == 0)
+        return;
+
+    bbr_update_round(bbr);
+    bbr_update_bandwidth(bbr);
+    bbr_check_recovery_exit(bbr);
+    bbr_update_cycle_phase(bbr, bytes_in_flight);
+    bbr_check_full_pipe(bbr);
+    bbr_check_drain(bbr, bytes_in_flight);
+    bbr_update_min_rtt(bbr, bytes_in_flight);
+    bbr->bbr_flags &= ~BBR_FLAG_IDLE_RESTART;
+
+    bbr_set_pacing_rate(bbr, bbr->bbr_pacing_gain);
+    bbr_set_cwnd(bbr, bytes_in_flight);
+    LSQ_DEBUG("%s: bw: %"PRIu64"; min_rtt: %"PRIu64"; pacing rate: %"PRIu64
+        "; cwnd: %lu", mode2str[bbr->bbr_mode], lsquic_bbr_get_bandwidth(bbr),
+        bbr->bbr_min_rtt, bbr->bbr_pacing_rate, bbr->bbr_cwnd);
+}
+
+
+static unsigned long
+bbr_get_cwnd (void *cong_ctl)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+
+    return bbr->bbr_cwnd;
+}
+
+
+static uint64_t
+bbr_pacing_rate (void *cong_ctl, int in_recovery)
+{
+    struct lsquic_bbr *const bbr = cong_ctl;
+    lsquic_time_t rtt;
+
+    if (bbr->bbr_pacing_rate)
+        return bbr->bbr_pacing_rate;
+
+    /* No bandwidth estimate yet: send the initial window over one RTT,
+     * scaled by the startup gain.
+     */
+    if (bbr->bbr_min_rtt)
+        rtt = bbr->bbr_min_rtt;
+    else if (lsquic_rtt_stats_get_srtt(bbr->bbr_rtt_stats))
+        rtt = lsquic_rtt_stats_get_srtt(bbr->bbr_rtt_stats);
+    else
+        rtt = BBR_INITIAL_RTT;
+    return (uint64_t) (BBR_HIGH_GAIN * bbr->bbr_cwnd * 1000000 / rtt);
+}
+
+
+const struct cong_ctl_if lsquic_cong_bbr_if =
+{
+    .cci_ack           = bbr_ack,
+    .cci_begin_ack     = bbr_begin_ack,
+    .cci_cleanup       = bbr_cleanup,
+    .cci_end_ack       = bbr_end_ack,
+    .cci_get_cwnd      = bbr_get_cwnd,
+    .cci_init          = bbr_init,
+    .cci_loss          = bbr_loss,
+    .cci_lost          = bbr_lost,
+    .cci_pacing_rate   = bbr_pacing_rate,
+    .cci_sent          = bbr_sent,
+    .cci_timeout       = bbr_timeout,
+    .cci_undo          = bbr_undo,
+    .cci_was_quiet     = bbr_was_quiet,
+};
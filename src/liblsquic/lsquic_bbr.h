@@ -0,0 +1,81 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_bbr.h -- BBR congestion control protocol.
+ *
+ * This is BBR version 1, as described in draft-cardwell-iccrg-bbr-
+ * congestion-control-00.
+ */
+
+#ifndef LSQUIC_BBR_H
+#define LSQUIC_BBR_H 1
+
+#include "lsquic_minmax.h"
+#include "lsquic_bw_sampler.h"
+
+struct lsquic_rtt_stats;
+
+enum bbr_mode
+{
+    BBR_MODE_STARTUP,
+    BBR_MODE_DRAIN,
+    BBR_MODE_PROBE_BW,
+    BBR_MODE_PROBE_RTT,
+};
+
+struct lsquic_bbr
+{
+    struct bw_sampler               bbr_bw_sampler;
+    /* Maximum delivery rate, in bytes per second, over the last few
+     * round trips.  Time unit is round trip count.
+     */
+    struct minmax                   bbr_max_bandwidth;
+    const struct lsquic_rtt_stats  *bbr_rtt_stats;
+    lsquic_cid_t                    bbr_cid;            /* Used for logging */
+    enum bbr_mode                   bbr_mode;
+    enum bbr_flags {
+        BBR_FLAG_ROUND_START        = 1 << 0,
+        BBR_FLAG_FILLED_PIPE        = 1 << 1,
+        BBR_FLAG_IDLE_RESTART       = 1 << 2,
+        BBR_FLAG_IN_RECOVERY        = 1 << 3,
+        BBR_FLAG_CONSERVATION       = 1 << 4,
+        BBR_FLAG_PROBE_RTT_ROUND_DONE
+                                    = 1 << 5,
+    }                               bbr_flags;
+    double                          bbr_pacing_gain;
+    double                          bbr_cwnd_gain;
+    uint64_t                        bbr_pacing_rate;    /* Bytes per second */
+    unsigned long                   bbr_cwnd;
+    unsigned long                   bbr_prior_cwnd;
+    unsigned long                   bbr_init_cwnd;
+    unsigned long                   bbr_min_cwnd;
+    lsquic_time_t                   bbr_min_rtt;
+    lsquic_time_t                   bbr_min_rtt_stamp;
+    uint64_t                        bbr_round_count;
+    uint64_t                        bbr_next_round_delivered;
+    uint64_t                        bbr_full_bw;
+    unsigned                        bbr_full_bw_count;
+    unsigned                        bbr_cycle_idx;
+    lsquic_time_t                   bbr_cycle_stamp;
+    lsquic_time_t                   bbr_probe_rtt_done_stamp;
+    lsquic_packno_t                 bbr_last_sent_packno;
+    lsquic_packno_t                 bbr_end_recovery_at;
+    unsigned                        bbr_bytes_in_flight;
+
+    /* State accumulated while an ACK frame is processed */
+    struct {
+        lsquic_time_t       ack_time;
+        uint64_t            acked_bytes;
+        uint64_t            lost_bytes;
+        lsquic_packno_t     largest_acked;
+        lsquic_time_t       min_rtt;
+        unsigned            prior_in_flight;
+        int                 have_sample;
+        struct bw_sample    sample;
+    }                               bbr_ack_state;
+};
+
+extern const struct cong_ctl_if lsquic_cong_bbr_if;
+
+#define lsquic_bbr_get_bandwidth(bbr) minmax_get(&(bbr)->bbr_max_bandwidth)
+
+#endif
@@ -0,0 +1,209 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_bw_sampler.c -- Delivery rate sampler
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_bw_sampler.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_BW_SAMPLER
+#define LSQUIC_LOG_CONN_ID sampler->bws_cid
+#include "lsquic_logger.h"
+
+#define BWS_MIN_RING_SZ 64
+
+#define bws_slot(sampler, packno) \
+                (&(sampler)->bws_ring[ (packno) & ((sampler)->bws_ring_sz - 1) ])
+
+
+void
+lsquic_bw_sampler_init (struct bw_sampler *sampler, lsquic_cid_t cid)
+{
+    memset(sampler, 0, sizeof(*sampler));
+    sampler->bws_cid = cid;
+}
+
+
+void
+lsquic_bw_sampler_cleanup (struct bw_sampler *sampler)
+{
+    free(sampler->bws_ring);
+    sampler->bws_ring = NULL;
+    sampler->bws_ring_sz = 0;
+    sampler->bws_count = 0;
+}
+
+
+static struct bwp_state *
+bws_lookup (struct bw_sampler *sampler, lsquic_packno_t packno)
+{
+    struct bwp_state *state;
+
+    if (!sampler->bws_ring)
+        return NULL;
+
+    state = bws_slot(sampler, packno);
+    if (state->bwps_packno == packno)
+        return state;
+    else
+        return NULL;
+}
+
+
+/* Double the ring until packets in flight and the new packet `packno' all
+ * map to different slots.
+ */
+static int
+bws_grow (struct bw_sampler *sampler, lsquic_packno_t packno)
+{
+    struct bwp_state *ring, *state;
+    unsigned sz, i;
+
+    sz = sampler->bws_ring_sz ? sampler->bws_ring_sz : BWS_MIN_RING_SZ / 2;
+  double_sz:
+    sz <<= 1;
+    if (sz == 0)
+        return -1;
+    ring = calloc(sz, sizeof(ring[0]));
+    if (!ring)
+        return -1;
+
+    for (i = 0; i < sampler->bws_ring_sz; ++i)
+    {
+        state = &sampler->bws_ring[i];
+        if (state->bwps_packno)
+        {
+            if (ring[ state->bwps_packno & (sz - 1) ].bwps_packno
+                || (state->bwps_packno & (sz - 1)) == (packno & (sz - 1)))
+            {
+                free(ring);
+                goto double_sz;
+            }
+            ring[ state->bwps_packno & (sz - 1) ] = *state;
+        }
+    }
+
+    LSQ_DEBUG("grew ring from %u to %u slots", sampler->bws_ring_sz, sz);
+    free(sampler->bws_ring);
+    sampler->bws_ring = ring;
+    sampler->bws_ring_sz = sz;
+    return 0;
+}
+
+
+int
+lsquic_bw_sampler_packet_sent (struct bw_sampler *sampler,
+        lsquic_packno_t packno, unsigned packet_sz, lsquic_time_t now,
+        unsigned bytes_in_flight)
+{
+    struct bwp_state *state;
+
+    assert(packno > 0);
+
+    /* If nothing is in flight, start measuring the delivery interval from
+     * this packet.
+     */
+    if (bytes_in_flight == 0)
+    {
+        sampler->bws_first_sent_time = now;
+        sampler->bws_delivered_time  = now;
+    }
+    sampler->bws_last_sent_packno = packno;
+
+    if (!sampler->bws_ring || bws_slot(sampler, packno)->bwps_packno)
+        if (0 != bws_grow(sampler, packno))
+        {
+            LSQ_WARN("cannot allocate state for packet %"PRIu64, packno);
+            return -1;
+        }
+
+    state = bws_slot(sampler, packno);
+    state->bwps_packno          = packno;
+    state->bwps_sent_time       = now;
+    state->bwps_delivered_time  = sampler->bws_delivered_time;
+    state->bwps_first_sent_time = sampler->bws_first_sent_time;
+    state->bwps_delivered       = sampler->bws_delivered;
+    state->bwps_packet_sz       = packet_sz;
+    state->bwps_is_app_limited  = lsquic_bw_sampler_is_app_limited(sampler);
+    ++sampler->bws_count;
+    return 0;
+}
+
+
+int
+lsquic_bw_sampler_packet_acked (struct bw_sampler *sampler,
+            lsquic_packno_t packno, lsquic_time_t now, struct bw_sample *sample)
+{
+    struct bwp_state *state;
+    lsquic_time_t send_elapsed, ack_elapsed;
+
+    state = bws_lookup(sampler, packno);
+    if (!state)
+        return -1;
+
+    sampler->bws_delivered += state->bwps_packet_sz;
+    sampler->bws_delivered_time = now;
+    /* The next sample's send interval starts when this packet was sent */
+    sampler->bws_first_sent_time = state->bwps_sent_time;
+    if ((sampler->bws_flags & BWS_APP_LIMITED)
+                                && packno > sampler->bws_end_of_app_limited)
+    {
+        LSQ_DEBUG("exit app-limited phase due to packet %"PRIu64" being "
+            "acked", packno);
+        sampler->bws_flags &= ~BWS_APP_LIMITED;
+    }
+
+    state->bwps_packno = 0;
+    --sampler->bws_count;
+
+    /* The delivery rate is limited both by the rate at which the packets
+     * were sent and the rate at which they were acked: take the longer
+     * of the two intervals.
+     */
+    send_elapsed = state->bwps_sent_time - state->bwps_first_sent_time;
+    ack_elapsed = now - state->bwps_delivered_time;
+    sample->interval = send_elapsed > ack_elapsed ? send_elapsed : ack_elapsed;
+    if (sample->interval == 0)
+        return -1;
+
+    sample->bandwidth = (sampler->bws_delivered - state->bwps_delivered)
+                                            * 1000000 / sample->interval;
+    sample->rtt = now - state->bwps_sent_time;
+    sample->prior_delivered = state->bwps_delivered;
+    sample->is_app_limited = state->bwps_is_app_limited;
+    LSQ_DEBUG("packet %"PRIu64" acked: bandwidth %"PRIu64" bytes/sec; "
+        "rtt %"PRIu64" usec; app-limited: %d", packno, sample->bandwidth,
+        sample->rtt, sample->is_app_limited);
+    return 0;
+}
+
+
+void
+lsquic_bw_sampler_packet_lost (struct bw_sampler *sampler,
+                                                    lsquic_packno_t packno)
+{
+    struct bwp_state *state;
+
+    state = bws_lookup(sampler, packno);
+    if (state)
+    {
+        state->bwps_packno = 0;
+        --sampler->bws_count;
+    }
+}
+
+
+void
+lsquic_bw_sampler_app_limited (struct bw_sampler *sampler)
+{
+    sampler->bws_flags |= BWS_APP_LIMITED;
+    sampler->bws_end_of_app_limited = sampler->bws_last_sent_packno;
+    LSQ_DEBUG("app-limited until packet %"PRIu64,
+                                            sampler->bws_end_of_app_limited);
+}
@@ -0,0 +1,89 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_bw_sampler.h -- Delivery rate sampler
+ *
+ * When a packet is sent, the sampler records how much data had been
+ * delivered by then and when.  When the packet is acknowledged, the
+ * amount of data delivered since it was sent, divided by the elapsed
+ * time, yields a delivery rate sample.  See draft-cheng-iccrg-delivery-rate-
+ * estimation.
+ */
+
+#ifndef LSQUIC_BW_SAMPLER_H
+#define LSQUIC_BW_SAMPLER_H 1
+
+/* State recorded when packet is sent */
+struct bwp_state
+{
+    lsquic_packno_t     bwps_packno;            /* Zero means empty slot */
+    lsquic_time_t       bwps_sent_time;
+    lsquic_time_t       bwps_delivered_time;
+    lsquic_time_t       bwps_first_sent_time;
+    uint64_t            bwps_delivered;
+    unsigned            bwps_packet_sz;
+    int                 bwps_is_app_limited;
+};
+
+struct bw_sample
+{
+    uint64_t            bandwidth;              /* Bytes per second */
+    lsquic_time_t       rtt;
+    lsquic_time_t       interval;
+    /* Value of the sampler's delivered counter when the packet was sent */
+    uint64_t            prior_delivered;
+    int                 is_app_limited;
+};
+
+struct bw_sampler
+{
+    /* Per-packet state is indexed by packet number: packet N is in slot
+     * N & (bws_ring_sz - 1).  The ring grows when two packets in flight
+     * map to the same slot.
+     */
+    struct bwp_state   *bws_ring;
+    unsigned            bws_ring_sz;
+    unsigned            bws_count;
+    lsquic_cid_t        bws_cid;                /* Used for logging */
+    enum {
+        BWS_APP_LIMITED = 1 << 0,
+    }                   bws_flags;
+    uint64_t            bws_delivered;
+    lsquic_time_t       bws_delivered_time;
+    lsquic_time_t       bws_first_sent_time;
+    lsquic_packno_t     bws_last_sent_packno;
+    lsquic_packno_t     bws_end_of_app_limited;
+};
+
+void
+lsquic_bw_sampler_init (struct bw_sampler *, lsquic_cid_t);
+
+/* Returns -1 if memory could not be allocated, in which case the packet
+ * will not produce a sample.
+ */
+int
+lsquic_bw_sampler_packet_sent (struct bw_sampler *, lsquic_packno_t,
+            unsigned packet_sz, lsquic_time_t now, unsigned bytes_in_flight);
+
+/* Returns 0 and fills in the sample if one can be produced, -1 otherwise */
+int
+lsquic_bw_sampler_packet_acked (struct bw_sampler *, lsquic_packno_t,
+                                    lsquic_time_t now, struct bw_sample *);
+
+void
+lsquic_bw_sampler_packet_lost (struct bw_sampler *, lsquic_packno_t);
+
+/* Mark packets sent from now until the next ACK of a packet sent after
+ * this point as application-limited.
+ */
+void
+lsquic_bw_sampler_app_limited (struct bw_sampler *);
+
+void
+lsquic_bw_sampler_cleanup (struct bw_sampler *);
+
+#define lsquic_bw_sampler_total_acked(bws) (+(bws)->bws_delivered)
+
+#define lsquic_bw_sampler_is_app_limited(bws) \
+                                (!!((bws)->bws_flags & BWS_APP_LIMITED))
+
+#endif
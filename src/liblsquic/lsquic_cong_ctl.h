@@ -0,0 +1,94 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_cong_ctl.h -- Congestion controller interface
+ *
+ * The send controller drives a congestion controller through this
+ * interface.  Packets are identified by their packet numbers; if a
+ * controller needs to keep per-packet state, it keeps it itself.
+ */
+
+#ifndef LSQUIC_CONG_CTL_H
+#define LSQUIC_CONG_CTL_H 1
+
+struct lsquic_conn_public;
+
+struct cong_ctl_if
+{
+    /* Returns 0 on success and -1 on failure */
+    int
+    (*cci_init) (void *cong_ctl, const struct lsquic_conn_public *);
+
+    /* Called for each packet that is sent.  `bytes_in_flight' does not
+     * include this packet.  `app_limited' is true if the sender has
+     * nothing else to send and the congestion window is not full.
+     */
+    void
+    (*cci_sent) (void *cong_ctl, lsquic_packno_t, unsigned packet_sz,
+                 lsquic_time_t now, unsigned bytes_in_flight, int app_limited);
+
+    /* Packets acknowledged by a single ACK frame are reported by calls to
+     * cci_ack() between cci_begin_ack() and cci_end_ack().  Losses
+     * detected as a result of processing the ACK frame are reported
+     * before cci_end_ack() is called.
+     */
+    void
+    (*cci_begin_ack) (void *cong_ctl, lsquic_time_t ack_time,
+                                                    unsigned bytes_in_flight);
+
+    void
+    (*cci_ack) (void *cong_ctl, lsquic_packno_t, unsigned packet_sz,
+                lsquic_time_t sent, lsquic_time_t now, int app_limited);
+
+    void
+    (*cci_end_ack) (void *cong_ctl, unsigned bytes_in_flight);
+
+    /* Called for each packet that is deemed lost */
+    void
+    (*cci_lost) (void *cong_ctl, lsquic_packno_t, unsigned packet_sz);
+
+    /* Called once per loss event (see RFC 6582) */
+    void
+    (*cci_loss) (void *cong_ctl);
+
+    /* Retransmission timeout */
+    void
+    (*cci_timeout) (void *cong_ctl);
+
+    /* Called when all packets declared lost in the last loss event or
+     * retransmission timeout have been acknowledged after all.  The
+     * controller restores the state it had before cci_loss() or
+     * cci_timeout() was called.
+     */
+    void
+    (*cci_undo) (void *cong_ctl);
+
+    /* Called when an ACK arrives after there were no retransmittable
+     * packets in flight.
+     */
+    void
+    (*cci_was_quiet) (void *cong_ctl, lsquic_time_t now);
+
+    /* Congestion window in bytes */
+    unsigned long
+    (*cci_get_cwnd) (void *cong_ctl);
+
+    /* Pacing rate in bytes per second */
+    uint64_t
+    (*cci_pacing_rate) (void *cong_ctl, int in_recovery);
+
+    void
+    (*cci_cleanup) (void *cong_ctl);
+};
+
+/* State of the adapter that drives a user-supplied congestion controller
+ * (see ea_cc_if) through the interface above.
+ */
+struct cong_user
+{
+    const struct lsquic_cong_ctl_if    *cgu_if;
+    void                               *cgu_cc;
+};
+
+extern const struct cong_ctl_if lsquic_cong_user_if;
+
+#endif
@@ -0,0 +1,164 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_cong_user.c -- Adapter for user-supplied congestion controller
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_mm.h"
+#include "lsquic_engine_public.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_SENDCTL
+#define LSQUIC_LOG_CONN_ID conn_pub->lconn->cn_cid
+#include "lsquic_logger.h"
+
+
+static int
+cong_user_init (void *cong_ctl, const struct lsquic_conn_public *conn_pub)
+{
+    struct cong_user *const cgu = cong_ctl;
+
+    cgu->cgu_if = conn_pub->enpub->enp_cc_if;
+    cgu->cgu_cc = cgu->cgu_if->cci_create(conn_pub->enpub->enp_cc_ctx,
+                                                            conn_pub->lconn);
+    if (cgu->cgu_cc)
+        return 0;
+    else
+    {
+        LSQ_WARN("could not create user congestion controller");
+        return -1;
+    }
+}
+
+
+static void
+cong_user_sent (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t now, unsigned bytes_in_flight, int app_limited)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_sent(cgu->cgu_cc, packno, packet_sz, now,
+                                                bytes_in_flight, app_limited);
+}
+
+
+static void
+cong_user_begin_ack (void *cong_ctl, lsquic_time_t ack_time,
+                                                    unsigned bytes_in_flight)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_begin_ack(cgu->cgu_cc, ack_time, bytes_in_flight);
+}
+
+
+static void
+cong_user_ack (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t sent, lsquic_time_t now, int app_limited)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_ack(cgu->cgu_cc, packno, packet_sz, sent, now,
+                                                                app_limited);
+}
+
+
+static void
+cong_user_end_ack (void *cong_ctl, unsigned bytes_in_flight)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_end_ack(cgu->cgu_cc, bytes_in_flight);
+}
+
+
+static void
+cong_user_lost (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_lost(cgu->cgu_cc, packno, packet_sz);
+}
+
+
+static void
+cong_user_loss (void *cong_ctl)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_loss(cgu->cgu_cc);
+}
+
+
+static void
+cong_user_timeout (void *cong_ctl)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_timeout(cgu->cgu_cc);
+}
+
+
+static void
+cong_user_undo (void *cong_ctl)
+{
+    struct cong_user *const cgu = cong_ctl;
+
+    if (cgu->cgu_if->cci_undo)
+        cgu->cgu_if->cci_undo(cgu->cgu_cc);
+}
+
+
+static void
+cong_user_was_quiet (void *cong_ctl, lsquic_time_t now)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_was_quiet(cgu->cgu_cc, now);
+}
+
+
+static unsigned long
+cong_user_get_cwnd (void *cong_ctl)
+{
+    struct cong_user *const cgu = cong_ctl;
+    return cgu->cgu_if->cci_get_cwnd(cgu->cgu_cc);
+}
+
+
+static uint64_t
+cong_user_pacing_rate (void *cong_ctl, int in_recovery)
+{
+    struct cong_user *const cgu = cong_ctl;
+    return cgu->cgu_if->cci_pacing_rate(cgu->cgu_cc, in_recovery);
+}
+
+
+static void
+cong_user_cleanup (void *cong_ctl)
+{
+    struct cong_user *const cgu = cong_ctl;
+    cgu->cgu_if->cci_destroy(cgu->cgu_cc);
+}
+
+
+const struct cong_ctl_if lsquic_cong_user_if =
+{
+    .cci_ack           = cong_user_ack,
+    .cci_begin_ack     = cong_user_begin_ack,
+    .cci_cleanup       = cong_user_cleanup,
+    .cci_end_ack       = cong_user_end_ack,
+    .cci_get_cwnd      = cong_user_get_cwnd,
+    .cci_init          = cong_user_init,
+    .cci_loss          = cong_user_loss,
+    .cci_lost          = cong_user_lost,
+    .cci_pacing_rate   = cong_user_pacing_rate,
+    .cci_sent          = cong_user_sent,
+    .cci_timeout       = cong_user_timeout,
+    .cci_undo          = cong_user_undo,
+    .cci_was_quiet     = cong_user_was_quiet,
+};
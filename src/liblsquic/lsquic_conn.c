@@ -72,6 +72,8 @@ lsquic_conn_copy_and_release_pi_data (const lsquic_conn_t *conn,
           struct lsquic_engine_public *enpub, lsquic_packet_in_t *packet_in)
 {
     assert(!(packet_in->pi_flags & PI_OWN_DATA));
+    if (packet_in->pi_flags & PI_RELEASE_DATA)
+        return 0;   /* Already ours until the packet is put */
     /* The size should be guarded in lsquic_engine_packet_in(): */
     assert(packet_in->pi_data_sz <= QUIC_MAX_PACKET_SZ);
     unsigned char *const copy = lsquic_mm_get_1370(&enpub->enp_mm);
@@ -92,37 +94,65 @@ lsquic_conn_decrypt_packet (lsquic_conn_t *lconn,
                             struct lsquic_engine_public *enpub,
                             lsquic_packet_in_t *packet_in)
 {
-    size_t header_len, data_len;
+    size_t header_len, data_len, out_sz;
     enum enc_level enc_level;
     size_t out_len = 0;
-    unsigned char *copy = lsquic_mm_get_1370(&enpub->enp_mm);
-    if (!copy)
-    {
-        LSQ_WARN("cannot allocate memory to copy incoming packet data");
-        return -1;
-    }
+    unsigned char *out;
+    unsigned char tail[SRST_LENGTH];
 
     header_len = packet_in->pi_header_sz;
     data_len   = packet_in->pi_data_sz - packet_in->pi_header_sz;
+
+    if (packet_in->pi_flags & PI_RELEASE_DATA)
+    {
+        /* The buffer is ours until it is released: decrypt in place.  A
+         * failed attempt may clobber the payload, so save its tail: the
+         * caller checks it for the stateless reset token.
+         */
+        out = packet_in->pi_data;
+        out_sz = packet_in->pi_data_sz;
+        if (packet_in->pi_data_sz >= SRST_LENGTH)
+            memcpy(tail, packet_in->pi_data + packet_in->pi_data_sz
+                                                - SRST_LENGTH, SRST_LENGTH);
+    }
+    else
+    {
+        out = lsquic_mm_get_1370(&enpub->enp_mm);
+        if (!out)
+        {
+            LSQ_WARN("cannot allocate memory to copy incoming packet data");
+            return -1;
+        }
+        out_sz = 1370;
+    }
+
     enc_level = lconn->cn_esf->esf_decrypt(lconn->cn_enc_session,
                         lconn->cn_version, 0,
                         packet_in->pi_packno, packet_in->pi_data,
                         &header_len, data_len,
                         lsquic_packet_in_nonce(packet_in),
-                        copy, 1370, &out_len);
+                        out, out_sz, &out_len);
     if ((enum enc_level) -1 == enc_level)
     {
-        lsquic_mm_put_1370(&enpub->enp_mm, copy);
+        if (out != packet_in->pi_data)
+            lsquic_mm_put_1370(&enpub->enp_mm, out);
+        else if (packet_in->pi_data_sz >= SRST_LENGTH)
+            memcpy(packet_in->pi_data + packet_in->pi_data_sz - SRST_LENGTH,
+                                                        tail, SRST_LENGTH);
         EV_LOG_CONN_EVENT(lconn->cn_cid, "could not decrypt packet %"PRIu64,
                                                         packet_in->pi_packno);
         return -1;
     }
 
-    assert(header_len + out_len <= 1370);
-    if (packet_in->pi_flags & PI_OWN_DATA)
-        lsquic_mm_put_1370(&enpub->enp_mm, packet_in->pi_data);
-    packet_in->pi_data = copy;
-    packet_in->pi_flags |= PI_OWN_DATA | PI_DECRYPTED
+    assert(header_len + out_len <= out_sz);
+    if (out != packet_in->pi_data)
+    {
+        if (packet_in->pi_flags & PI_OWN_DATA)
+            lsquic_mm_put_1370(&enpub->enp_mm, packet_in->pi_data);
+        packet_in->pi_data = out;
+        packet_in->pi_flags |= PI_OWN_DATA;
+    }
+    packet_in->pi_flags |= PI_DECRYPTED
                         | (enc_level << PIBIT_ENC_LEV_SHIFT);
     packet_in->pi_header_sz = header_len;
     packet_in->pi_data_sz   = out_len + header_len;
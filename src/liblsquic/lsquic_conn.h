@@ -106,8 +106,7 @@ struct lsquic_conn
     lsquic_cid_t                 cn_cid;
     STAILQ_ENTRY(lsquic_conn)    cn_next_closed_conn;
     TAILQ_ENTRY(lsquic_conn)     cn_next_ticked;
-    TAILQ_ENTRY(lsquic_conn)     cn_next_out,
-                                 cn_next_hash;
+    TAILQ_ENTRY(lsquic_conn)     cn_next_out;
     const struct conn_iface     *cn_if;
     const struct parse_funcs    *cn_pf;
     struct attq_elem            *cn_attq_elem;
@@ -163,8 +162,13 @@ struct conn_stats {
         unsigned long       stream_data_sz;
         unsigned long       stream_frames;
         unsigned long       acks;
+        unsigned long       ack_only_packets;   /* Packets with nothing but ACK */
         unsigned long       packets;            /* Number of sent packets */
         unsigned long       retx_packets;       /* Number of retransmitted packets */
+        unsigned long       lost_packets;       /* Packets declared lost */
+        unsigned long       spurious_losses;    /* ...that were acked later */
+        unsigned long       loss_undos;         /* Loss events undone */
+        unsigned long       rto_undos;          /* Timeouts undone */
         unsigned long       bytes;              /* Overall bytes out */
         unsigned long       headers_uncomp;     /* Sum of uncompressed header bytes */
         unsigned long       headers_comp;       /* Sum of compressed header bytes */
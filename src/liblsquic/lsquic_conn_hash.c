@@ -14,9 +14,17 @@
 #include "lsquic_logger.h"
 
 
-#define n_buckets(nbits) (1U << (nbits))
-#define conn_hash_mask(conn_hash) ((1 << (conn_hash)->ch_nbits) - 1)
-#define conn_hash_bucket_no(conn_hash, hash) (hash & conn_hash_mask(conn_hash))
+/* Control byte values.  A full slot contains seven high bits of the hash. */
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xFE
+#define hash2ctrl(hash) ((unsigned char) ((hash) >> 25))
+
+#define MIN_NBITS 3
+#define n_slots(nbits) (1U << (nbits))
+#define tab_mask(tab) (n_slots((tab)->cht_nbits) - 1)
+#define tab_max_used(tab) (n_slots((tab)->cht_nbits) \
+                        / CONN_HASH_MAX_LOAD_DEN * CONN_HASH_MAX_LOAD_NUM)
+#define migrating(conn_hash) ((conn_hash)->ch_tabs[1].cht_ctrl != NULL)
 
 #if FULL_LOCAL_ADDR_SUPPORTED
 #define HASHBUF_SZ (2 + sizeof(((struct sockaddr_in6 *) 0)->sin6_addr))
@@ -25,15 +33,6 @@
 #endif
 
 
-static const unsigned char *
-conn2hash_by_cid (const struct lsquic_conn *lconn, unsigned char *buf,
-                                                                size_t *sz)
-{
-    *sz = sizeof(lconn->cn_cid);
-    return (unsigned char *) &lconn->cn_cid;
-}
-
-
 static void
 sockaddr2hash (const struct sockaddr *sa, unsigned char *buf, size_t *sz)
 {
@@ -62,33 +61,174 @@ sockaddr2hash (const struct sockaddr *sa, unsigned char *buf, size_t *sz)
 }
 
 
-static const unsigned char *
-conn2hash_by_addr (const struct lsquic_conn *lconn, unsigned char *buf,
-                                                                size_t *sz)
+static unsigned
+hash_cid (const struct conn_hash *conn_hash, lsquic_cid_t cid)
+{
+    return XXH32(&cid, sizeof(cid), (uintptr_t) conn_hash);
+}
+
+
+static unsigned
+hash_sockaddr (const struct conn_hash *conn_hash, const struct sockaddr *sa)
+{
+    unsigned char hash_buf[HASHBUF_SZ];
+    size_t hash_sz;
+
+    sockaddr2hash(sa, hash_buf, &hash_sz);
+    return XXH32(hash_buf, hash_sz, (uintptr_t) conn_hash);
+}
+
+
+static int
+same_local_addr (const struct lsquic_conn *lconn, const struct sockaddr *sa)
+{
+    unsigned char hash_buf[2][HASHBUF_SZ];
+    size_t hash_sz[2];
+
+    sockaddr2hash(sa, hash_buf[0], &hash_sz[0]);
+    sockaddr2hash((struct sockaddr *) lconn->cn_local_addr, hash_buf[1],
+                                                                &hash_sz[1]);
+    return hash_sz[0] == hash_sz[1]
+                        && 0 == memcmp(hash_buf[0], hash_buf[1], hash_sz[0]);
+}
+
+
+/* In address mode, the key is the hash itself */
+static unsigned
+key2hash (const struct conn_hash *conn_hash, lsquic_cid_t key)
+{
+    if (conn_hash->ch_flags & CHF_USE_ADDR)
+        return (unsigned) key;
+    else
+        return hash_cid(conn_hash, key);
+}
+
+
+static int
+tab_init (struct conn_hash_tab *tab, unsigned nbits)
+{
+    unsigned char *mem;
+
+    /* Slots come first to keep them aligned */
+    mem = malloc((sizeof(tab->cht_slots[0]) + 1) * n_slots(nbits));
+    if (!mem)
+        return -1;
+    tab->cht_slots = (struct conn_hash_slot *) mem;
+    tab->cht_ctrl  = mem + sizeof(tab->cht_slots[0]) * n_slots(nbits);
+    memset(tab->cht_ctrl, CTRL_EMPTY, n_slots(nbits));
+    tab->cht_nbits = nbits;
+    tab->cht_count = 0;
+    tab->cht_used  = 0;
+    return 0;
+}
+
+
+static void
+tab_cleanup (struct conn_hash_tab *tab)
+{
+    free(tab->cht_slots);
+    memset(tab, 0, sizeof(*tab));
+}
+
+
+/* There is always at least one empty slot, so the probe terminates */
+static void
+tab_insert (struct conn_hash_tab *tab, lsquic_cid_t key, unsigned hash,
+                                                    struct lsquic_conn *lconn)
+{
+    const unsigned mask = tab_mask(tab);
+    unsigned idx;
+
+    assert(tab->cht_used < tab_mask(tab));
+    for (idx = hash & mask; tab->cht_ctrl[idx] < CTRL_EMPTY;
+                                                        idx = (idx + 1) & mask)
+        ;
+    if (tab->cht_ctrl[idx] == CTRL_EMPTY)
+        ++tab->cht_used;
+    tab->cht_ctrl[idx] = hash2ctrl(hash);
+    tab->cht_slots[idx].chs_key  = key;
+    tab->cht_slots[idx].chs_conn = lconn;
+    ++tab->cht_count;
+}
+
+
+static void
+tab_delete (struct conn_hash_tab *tab, unsigned idx)
+{
+    /* If the next slot is empty, no probe sequence goes through this slot
+     * and it can be marked empty instead of deleted.
+     */
+    if (tab->cht_ctrl[(idx + 1) & tab_mask(tab)] == CTRL_EMPTY)
+    {
+        tab->cht_ctrl[idx] = CTRL_EMPTY;
+        --tab->cht_used;
+    }
+    else
+        tab->cht_ctrl[idx] = CTRL_DELETED;
+    --tab->cht_count;
+}
+
+
+static struct lsquic_conn *
+tab_find_by_cid (const struct conn_hash_tab *tab, lsquic_cid_t cid,
+                                                                unsigned hash)
+{
+    const unsigned char ctrl = hash2ctrl(hash);
+    const unsigned mask = tab_mask(tab);
+    unsigned idx;
+
+    for (idx = hash & mask; tab->cht_ctrl[idx] != CTRL_EMPTY;
+                                                        idx = (idx + 1) & mask)
+        if (tab->cht_ctrl[idx] == ctrl && tab->cht_slots[idx].chs_key == cid)
+            return tab->cht_slots[idx].chs_conn;
+
+    return NULL;
+}
+
+
+static struct lsquic_conn *
+tab_find_by_addr (const struct conn_hash_tab *tab, const struct sockaddr *sa,
+                                                                unsigned hash)
 {
-    sockaddr2hash((struct sockaddr *) &lconn->cn_local_addr, buf, sz);
-    return buf;
+    const unsigned char ctrl = hash2ctrl(hash);
+    const unsigned mask = tab_mask(tab);
+    unsigned idx;
+
+    for (idx = hash & mask; tab->cht_ctrl[idx] != CTRL_EMPTY;
+                                                        idx = (idx + 1) & mask)
+        if (tab->cht_ctrl[idx] == ctrl && tab->cht_slots[idx].chs_key == hash
+                    && same_local_addr(tab->cht_slots[idx].chs_conn, sa))
+            return tab->cht_slots[idx].chs_conn;
+
+    return NULL;
+}
+
+
+/* Returns slot index or -1 if the connection is not in the table */
+static int
+tab_find_conn (const struct conn_hash_tab *tab,
+                            const struct lsquic_conn *lconn, unsigned hash)
+{
+    const unsigned char ctrl = hash2ctrl(hash);
+    const unsigned mask = tab_mask(tab);
+    unsigned idx;
+
+    for (idx = hash & mask; tab->cht_ctrl[idx] != CTRL_EMPTY;
+                                                        idx = (idx + 1) & mask)
+        if (tab->cht_ctrl[idx] == ctrl && tab->cht_slots[idx].chs_conn == lconn)
+            return (int) idx;
+
+    return -1;
 }
 
 
 int
 conn_hash_init (struct conn_hash *conn_hash, enum conn_hash_flags flags)
 {
-    unsigned n;
-
     memset(conn_hash, 0, sizeof(*conn_hash));
-    conn_hash->ch_nbits = 1;  /* Start small */
-    conn_hash->ch_buckets = malloc(sizeof(conn_hash->ch_buckets[0]) *
-                                                n_buckets(conn_hash->ch_nbits));
-    if (!conn_hash->ch_buckets)
+    if (0 != tab_init(&conn_hash->ch_tabs[0], MIN_NBITS))
         return -1;
-    for (n = 0; n < n_buckets(conn_hash->ch_nbits); ++n)
-        TAILQ_INIT(&conn_hash->ch_buckets[n]);
     conn_hash->ch_flags = flags;
-    if (flags & CHF_USE_ADDR)
-        conn_hash->ch_conn2hash = conn2hash_by_addr;
-    else
-        conn_hash->ch_conn2hash = conn2hash_by_cid;
     LSQ_INFO("initialized");
     return 0;
 }
@@ -97,82 +237,111 @@ conn_hash_init (struct conn_hash *conn_hash, enum conn_hash_flags flags)
 void
 conn_hash_cleanup (struct conn_hash *conn_hash)
 {
-    free(conn_hash->ch_buckets);
+    tab_cleanup(&conn_hash->ch_tabs[0]);
+    if (migrating(conn_hash))
+        tab_cleanup(&conn_hash->ch_tabs[1]);
 }
 
 
 struct lsquic_conn *
 conn_hash_find_by_cid (struct conn_hash *conn_hash, lsquic_cid_t cid)
 {
-    const unsigned hash = XXH32(&cid, sizeof(cid), (uintptr_t) conn_hash);
-    const unsigned buckno = conn_hash_bucket_no(conn_hash, hash);
+    const unsigned hash = hash_cid(conn_hash, cid);
     struct lsquic_conn *lconn;
-    TAILQ_FOREACH(lconn, &conn_hash->ch_buckets[buckno], cn_next_hash)
-        if (lconn->cn_cid == cid)
-            return lconn;
-    return NULL;
+
+    lconn = tab_find_by_cid(&conn_hash->ch_tabs[0], cid, hash);
+    if (!lconn && migrating(conn_hash))
+        lconn = tab_find_by_cid(&conn_hash->ch_tabs[1], cid, hash);
+    return lconn;
 }
 
 
 struct lsquic_conn *
 conn_hash_find_by_addr (struct conn_hash *conn_hash, const struct sockaddr *sa)
 {
-    unsigned char hash_buf[HASHBUF_SZ][2];
+    const unsigned hash = hash_sockaddr(conn_hash, sa);
     struct lsquic_conn *lconn;
-    unsigned hash, buckno;
-    size_t hash_sz[2];
 
-    sockaddr2hash(sa, hash_buf[0], &hash_sz[0]);
-    hash = XXH32(hash_buf, hash_sz[0], (uintptr_t) conn_hash);
-    buckno = conn_hash_bucket_no(conn_hash, hash);
-    TAILQ_FOREACH(lconn, &conn_hash->ch_buckets[buckno], cn_next_hash)
-        if (lconn->cn_hash == hash)
+    lconn = tab_find_by_addr(&conn_hash->ch_tabs[0], sa, hash);
+    if (!lconn && migrating(conn_hash))
+        lconn = tab_find_by_addr(&conn_hash->ch_tabs[1], sa, hash);
+    return lconn;
+}
+
+
+/* Move up to `max_slots' slots' worth of entries from the old table to the
+ * current table.  The old table is freed once it is drained.
+ */
+static void
+migrate_entries (struct conn_hash *conn_hash, unsigned max_slots)
+{
+    struct conn_hash_tab *const new = &conn_hash->ch_tabs[0],
+                         *const old = &conn_hash->ch_tabs[1];
+    const struct conn_hash_slot *slot;
+    unsigned idx, end;
+
+    idx = conn_hash->ch_migrate_pos;
+    if (max_slots < n_slots(old->cht_nbits) - idx)
+        end = idx + max_slots;
+    else
+        end = n_slots(old->cht_nbits);
+
+    for ( ; idx < end && old->cht_count > 0; ++idx)
+        if (old->cht_ctrl[idx] < CTRL_EMPTY)
         {
-            sockaddr2hash((struct sockaddr *) lconn->cn_local_addr, hash_buf[1],
-                          &hash_sz[1]);
-            if (hash_sz[0] == hash_sz[1]
-                        && 0 == memcmp(hash_buf[0], hash_buf[1], hash_sz[0]))
-                return lconn;
+            slot = &old->cht_slots[idx];
+            tab_insert(new, slot->chs_key,
+                                key2hash(conn_hash, slot->chs_key),
+                                slot->chs_conn);
+            /* Lookups in the old table must still be able to probe past
+             * this slot, so do not mark it empty.
+             */
+            old->cht_ctrl[idx] = CTRL_DELETED;
+            --old->cht_count;
         }
 
-    return NULL;
+    conn_hash->ch_migrate_pos = idx;
+    if (old->cht_count == 0)
+    {
+        LSQ_DEBUG("done migrating entries from old table");
+        tab_cleanup(old);
+    }
 }
 
 
 static int
-double_conn_hash_buckets (struct conn_hash *conn_hash)
+start_resize (struct conn_hash *conn_hash)
 {
-    struct lsquic_conn_head *new_buckets, *new[2];
-    struct lsquic_conn *lconn;
-    unsigned n, old_nbits;
-    int idx;
+    struct conn_hash_tab new_tab;
+    unsigned nbits;
+
+    /* Only one resize at a time: finish the previous one first. */
+    if (migrating(conn_hash))
+        migrate_entries(conn_hash, ~0U);
+
+    /* If the table is filled mostly with deleted entries, rehash into a
+     * table of the same size.
+     */
+    nbits = conn_hash->ch_tabs[0].cht_nbits;
+    if (conn_hash->ch_tabs[0].cht_count >= n_slots(nbits) / 2)
+    {
+        if (nbits >= sizeof(unsigned) * 8 - 2)
+            return -1;
+        ++nbits;
+    }
 
-    old_nbits = conn_hash->ch_nbits;
-    LSQ_INFO("doubling number of buckets to %u", n_buckets(old_nbits + 1));
-    new_buckets = malloc(sizeof(conn_hash->ch_buckets[0])
-                                                * n_buckets(old_nbits + 1));
-    if (!new_buckets)
+    LSQ_INFO("resize table to %u slots", n_slots(nbits));
+    if (0 != tab_init(&new_tab, nbits))
     {
         LSQ_WARN("malloc failed: potential trouble ahead");
         return -1;
     }
 
-    for (n = 0; n < n_buckets(old_nbits); ++n)
-    {
-        new[0] = &new_buckets[n];
-        new[1] = &new_buckets[n + n_buckets(old_nbits)];
-        TAILQ_INIT(new[0]);
-        TAILQ_INIT(new[1]);
-        while ((lconn = TAILQ_FIRST(&conn_hash->ch_buckets[n])))
-        {
-            TAILQ_REMOVE(&conn_hash->ch_buckets[n], lconn, cn_next_hash);
-            idx = (lconn->cn_hash >> old_nbits) & 1;
-            TAILQ_INSERT_TAIL(new[idx], lconn, cn_next_hash);
-        }
-    }
-    free(conn_hash->ch_buckets);
-    conn_hash->ch_nbits   = old_nbits + 1;
-    conn_hash->ch_buckets = new_buckets;
+    conn_hash->ch_tabs[1] = conn_hash->ch_tabs[0];
+    conn_hash->ch_tabs[0] = new_tab;
+    conn_hash->ch_migrate_pos = 0;
+    if (conn_hash->ch_tabs[1].cht_count == 0)
+        tab_cleanup(&conn_hash->ch_tabs[1]);
     return 0;
 }
 
@@ -180,23 +349,30 @@ double_conn_hash_buckets (struct conn_hash *conn_hash)
 int
 conn_hash_add (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 {
-    unsigned char hash_buf[HASHBUF_SZ];
-    const unsigned char *key;
-    size_t key_sz;
-    unsigned hash, buckno;
-
-    key = conn_hash->ch_conn2hash(lconn, hash_buf, &key_sz);
-    hash = XXH32(key, key_sz, (uintptr_t) conn_hash);
-    if (conn_hash->ch_count >=
-                n_buckets(conn_hash->ch_nbits) * CONN_HASH_MAX_PER_BUCKET &&
-        conn_hash->ch_nbits < sizeof(hash) * 8 - 1                        &&
-        0 != double_conn_hash_buckets(conn_hash))
+    lsquic_cid_t key;
+    unsigned hash;
+
+    if (conn_hash->ch_flags & CHF_USE_ADDR)
     {
-            return -1;
+        hash = hash_sockaddr(conn_hash,
+                                (struct sockaddr *) lconn->cn_local_addr);
+        key = hash;
     }
-    buckno = conn_hash_bucket_no(conn_hash, hash);
+    else
+    {
+        key = lconn->cn_cid;
+        hash = hash_cid(conn_hash, key);
+    }
+
+    if (migrating(conn_hash))
+        migrate_entries(conn_hash, CONN_HASH_MIGRATE_STEP);
+
+    if (conn_hash->ch_tabs[0].cht_used >= tab_max_used(&conn_hash->ch_tabs[0])
+                                    && 0 != start_resize(conn_hash))
+        return -1;
+
     lconn->cn_hash = hash;
-    TAILQ_INSERT_TAIL(&conn_hash->ch_buckets[buckno], lconn, cn_next_hash);
+    tab_insert(&conn_hash->ch_tabs[0], key, hash, lconn);
     ++conn_hash->ch_count;
     return 0;
 }
@@ -205,17 +381,32 @@ conn_hash_add (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 void
 conn_hash_remove (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 {
-    const unsigned buckno = conn_hash_bucket_no(conn_hash, lconn->cn_hash);
-    TAILQ_REMOVE(&conn_hash->ch_buckets[buckno], lconn, cn_next_hash);
+    struct conn_hash_tab *tab;
+    int idx;
+
+    tab = &conn_hash->ch_tabs[0];
+    idx = tab_find_conn(tab, lconn, lconn->cn_hash);
+    if (idx < 0 && migrating(conn_hash))
+    {
+        tab = &conn_hash->ch_tabs[1];
+        idx = tab_find_conn(tab, lconn, lconn->cn_hash);
+    }
+    assert(idx >= 0);
+    if (idx < 0)
+        return;
+
+    tab_delete(tab, (unsigned) idx);
     --conn_hash->ch_count;
+    if (tab == &conn_hash->ch_tabs[1] && tab->cht_count == 0)
+        tab_cleanup(tab);
 }
 
 
 void
 conn_hash_reset_iter (struct conn_hash *conn_hash)
 {
-    conn_hash->ch_iter.cur_buckno = 0;
-    conn_hash->ch_iter.next_conn  = TAILQ_FIRST(&conn_hash->ch_buckets[0]);
+    conn_hash->ch_iter.tab_idx  = 0;
+    conn_hash->ch_iter.slot_idx = 0;
 }
 
 
@@ -227,19 +418,29 @@ conn_hash_first (struct conn_hash *conn_hash)
 }
 
 
+/* Removal marks slots deleted and does not move other entries, which is
+ * what makes removing the current element during iteration safe.
+ */
 struct lsquic_conn *
 conn_hash_next (struct conn_hash *conn_hash)
 {
-    struct lsquic_conn *lconn = conn_hash->ch_iter.next_conn;
-    while (!lconn)
+    const struct conn_hash_tab *tab;
+    unsigned idx;
+
+    for ( ; conn_hash->ch_iter.tab_idx < 2; ++conn_hash->ch_iter.tab_idx,
+                                            conn_hash->ch_iter.slot_idx = 0)
     {
-        ++conn_hash->ch_iter.cur_buckno;
-        if (conn_hash->ch_iter.cur_buckno >= n_buckets(conn_hash->ch_nbits))
-            return NULL;
-        lconn = TAILQ_FIRST(&conn_hash->ch_buckets[
-                                            conn_hash->ch_iter.cur_buckno]);
+        tab = &conn_hash->ch_tabs[ conn_hash->ch_iter.tab_idx ];
+        if (!tab->cht_ctrl)
+            continue;
+        for (idx = conn_hash->ch_iter.slot_idx;
+                                        idx < n_slots(tab->cht_nbits); ++idx)
+            if (tab->cht_ctrl[idx] < CTRL_EMPTY)
+            {
+                conn_hash->ch_iter.slot_idx = idx + 1;
+                return tab->cht_slots[idx].chs_conn;
+            }
     }
-    if (lconn)
-        conn_hash->ch_iter.next_conn = TAILQ_NEXT(lconn, cn_next_hash);
-    return lconn;
+
+    return NULL;
 }
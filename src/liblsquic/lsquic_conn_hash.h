@@ -6,38 +6,66 @@
 #ifndef LSQUIC_MC_SET_H
 #define LSQUIC_MC_SET_H
 
-#include <sys/queue.h>
-
-/* Once we reach this many per bucket on average, double the number of
- * buckets and redistribute entries.
+/* The hash is an open-addressing table with linear probing.  Each slot
+ * stores the key inline next to the connection pointer, so that a lookup
+ * does not dereference connections that do not match.  A separate array
+ * of control bytes holds seven bits of the hash for each slot: most
+ * mismatches are rejected without touching the slots at all.
  *
- * This value should be a power of two for speed.
+ * When the table needs to grow, a new table is allocated and entries are
+ * migrated from the old table a few at a time on each insertion.  This
+ * way, adding a connection never stalls to rehash the whole table.
  */
-#define CONN_HASH_MAX_PER_BUCKET 2
+
+/* Grow the table when this fraction of slots is used: */
+#define CONN_HASH_MAX_LOAD_NUM 3
+#define CONN_HASH_MAX_LOAD_DEN 4
+
+/* Number of old-table slots to migrate on each insertion */
+#define CONN_HASH_MIGRATE_STEP 32
 
 struct lsquic_conn;
 struct sockaddr;
 
-TAILQ_HEAD(lsquic_conn_head, lsquic_conn);
-
 enum conn_hash_flags
 {
     CHF_USE_ADDR    = 1 << 0,
 };
 
 
+struct conn_hash_slot
+{
+    /* In CID mode, this is the connection ID.  In address mode, this is
+     * the hash of the local address.
+     */
+    lsquic_cid_t             chs_key;
+    struct lsquic_conn      *chs_conn;
+};
+
+
+struct conn_hash_tab
+{
+    unsigned char           *cht_ctrl;
+    struct conn_hash_slot   *cht_slots;
+    unsigned                 cht_nbits;
+    unsigned                 cht_count;     /* Number of live entries */
+    unsigned                 cht_used;      /* Live plus deleted entries */
+};
+
+
 struct conn_hash
 {
-    struct lsquic_conn_head *ch_buckets;
+    /* ch_tabs[0] is the current table.  While a resize is in progress,
+     * ch_tabs[1] is the old table that is being drained.
+     */
+    struct conn_hash_tab     ch_tabs[2];
+    unsigned                 ch_migrate_pos;
     struct {
-        unsigned             cur_buckno;
-        struct lsquic_conn  *next_conn;
+        unsigned             tab_idx;
+        unsigned             slot_idx;
     }                        ch_iter;
     unsigned                 ch_count;
-    unsigned                 ch_nbits;
     enum conn_hash_flags     ch_flags;
-    const unsigned char *  (*ch_conn2hash)(const struct lsquic_conn *,
-                                            unsigned char *, size_t *);
 };
 
 #define conn_hash_count(conn_hash) (+(conn_hash)->ch_count)
@@ -62,7 +90,10 @@ conn_hash_add (struct conn_hash *, struct lsquic_conn *);
 void
 conn_hash_remove (struct conn_hash *, struct lsquic_conn *);
 
-/* Two ways to use the iterator:
+/* Removing the current element while iterating is allowed.  Adding elements
+ * while iterating is not.
+ *
+ * Two ways to use the iterator:
  *  1.
  *      for (conn = conn_hash_first(hash); conn;
  *                      conn = conn_hash_next(hash))
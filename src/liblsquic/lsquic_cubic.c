@@ -8,13 +8,24 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/queue.h>
 #ifdef WIN32
 #include <vc_compat.h>
 #endif
 
+#include "lsquic.h"
 #include "lsquic_int_types.h"
 #include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_mm.h"
+#include "lsquic_engine_public.h"
 #include "lsquic_util.h"
 
 #define LSQUIC_LOGGER_MODULE LSQLM_CUBIC
@@ -28,6 +39,14 @@
 #define ONE_MINUS_BETA          819     /* 819/1024 */
 #define ONE_OVER_C              2560    /* 2560/1024 */
 
+/* HyStart++ parameters, see RFC 9406, Section 4.3 */
+#define HS_MIN_RTT_THRESH       4000    /* Microseconds */
+#define HS_MAX_RTT_THRESH       16000   /* Microseconds */
+#define HS_MIN_RTT_DIVISOR      8
+#define HS_N_RTT_SAMPLE         8
+#define HS_CSS_GROWTH_DIVISOR   4
+#define HS_CSS_ROUNDS           5
+
 static void
 cubic_reset (struct lsquic_cubic *cubic)
 {
@@ -102,6 +121,8 @@ lsquic_cubic_init_ext (struct lsquic_cubic *cubic, lsquic_cid_t cid,
     cubic->cu_ssthresh = 10000 * TCP_MSS; /* Emulate "unbounded" slow start */
     cubic->cu_cid   = cid;
     cubic->cu_flags = flags;
+    memset(&cubic->cu_hs, 0, sizeof(cubic->cu_hs));
+    cubic->cu_hs.state = flags & CU_HYSTART ? HS_SLOW_START : HS_DONE;
 #ifndef NDEBUG
     const char *s;
     s = getenv("LSQUIC_CUBIC_SAMPLING_RATE");
@@ -135,6 +156,73 @@ lsquic_cubic_was_quiet (struct lsquic_cubic *cubic, lsquic_time_t now)
 }
 
 
+/* Called at the start of each round in slow start */
+static void
+cubic_hystart_new_round (struct lsquic_cubic *cubic)
+{
+    cubic->cu_hs.last_round_min_rtt = cubic->cu_hs.cur_round_min_rtt;
+    cubic->cu_hs.cur_round_min_rtt = 0;
+    cubic->cu_hs.n_rtt_samples = 0;
+    cubic->cu_hs.window_end = cubic->cu_hs.last_sent_packno;
+
+    if (cubic->cu_hs.state == HS_CSS
+                    && ++cubic->cu_hs.css_round_count >= HS_CSS_ROUNDS)
+    {
+        cubic->cu_ssthresh = cubic->cu_cwnd;
+        cubic->cu_hs.state = HS_DONE;
+        LSQ_INFO("HyStart++: exit slow start, cwnd: %lu", cubic->cu_cwnd);
+    }
+}
+
+
+/* Delay increase in slow start means that the queue is building up.  When
+ * it is detected, slow start switches to conservative slow start, which
+ * grows cwnd at a quarter of the rate for a few rounds.  If RTT comes back
+ * down in CSS, the increase was spurious and slow start is resumed.
+ */
+static void
+cubic_hystart_sample (struct lsquic_cubic *cubic, lsquic_time_t rtt)
+{
+    lsquic_time_t thresh;
+
+    if (0 == cubic->cu_hs.cur_round_min_rtt
+                                    || rtt < cubic->cu_hs.cur_round_min_rtt)
+        cubic->cu_hs.cur_round_min_rtt = rtt;
+    ++cubic->cu_hs.n_rtt_samples;
+
+    if (cubic->cu_hs.n_rtt_samples < HS_N_RTT_SAMPLE)
+        return;
+
+    if (cubic->cu_hs.state == HS_SLOW_START)
+    {
+        if (0 == cubic->cu_hs.last_round_min_rtt)
+            return;
+        thresh = cubic->cu_hs.last_round_min_rtt / HS_MIN_RTT_DIVISOR;
+        if (thresh < HS_MIN_RTT_THRESH)
+            thresh = HS_MIN_RTT_THRESH;
+        else if (thresh > HS_MAX_RTT_THRESH)
+            thresh = HS_MAX_RTT_THRESH;
+        if (cubic->cu_hs.cur_round_min_rtt
+                            >= cubic->cu_hs.last_round_min_rtt + thresh)
+        {
+            cubic->cu_hs.css_baseline_min_rtt = cubic->cu_hs.cur_round_min_rtt;
+            cubic->cu_hs.css_round_count = 0;
+            cubic->cu_hs.state = HS_CSS;
+            LSQ_INFO("HyStart++: RTT went up from %"PRIu64" to %"PRIu64
+                " usec, enter CSS; cwnd: %lu", cubic->cu_hs.last_round_min_rtt,
+                cubic->cu_hs.cur_round_min_rtt, cubic->cu_cwnd);
+        }
+    }
+    else if (cubic->cu_hs.cur_round_min_rtt
+                                    < cubic->cu_hs.css_baseline_min_rtt)
+    {
+        cubic->cu_hs.state = HS_SLOW_START;
+        LSQ_INFO("HyStart++: RTT went down to %"PRIu64" usec, resume slow "
+            "start", cubic->cu_hs.cur_round_min_rtt);
+    }
+}
+
+
 void
 lsquic_cubic_ack (struct lsquic_cubic *cubic, lsquic_time_t now_time,
                   lsquic_time_t rtt, int app_limited, unsigned n_bytes)
@@ -149,7 +237,12 @@ lsquic_cubic_ack (struct lsquic_cubic *cubic, lsquic_time_t now_time,
 
     if (cubic->cu_cwnd <= cubic->cu_ssthresh)
     {
-        cubic->cu_cwnd += TCP_MSS;
+        if (cubic->cu_hs.state != HS_DONE)
+            cubic_hystart_sample(cubic, rtt);
+        if (cubic->cu_hs.state == HS_CSS)
+            cubic->cu_cwnd += TCP_MSS / HS_CSS_GROWTH_DIVISOR;
+        else
+            cubic->cu_cwnd += TCP_MSS;
         LSQ_DEBUG("ACK: slow threshold, cwnd: %lu", cubic->cu_cwnd);
     }
     else if (!app_limited)
@@ -162,10 +255,21 @@ lsquic_cubic_ack (struct lsquic_cubic *cubic, lsquic_time_t now_time,
 }
 
 
+static void
+cubic_save_prior (struct lsquic_cubic *cubic)
+{
+    cubic->cu_prior_cwnd = cubic->cu_cwnd;
+    cubic->cu_prior_ssthresh = cubic->cu_ssthresh;
+    cubic->cu_prior_last_max_cwnd = cubic->cu_last_max_cwnd;
+}
+
+
 void
 lsquic_cubic_loss (struct lsquic_cubic *cubic)
 {
     LSQ_DEBUG("%s(cubic)", __func__);
+    cubic_save_prior(cubic);
+    cubic->cu_hs.state = HS_DONE;
     cubic->cu_epoch_start = 0;
     if (FAST_CONVERGENCE && cubic->cu_cwnd < cubic->cu_last_max_cwnd)
         cubic->cu_last_max_cwnd = cubic->cu_cwnd * TWO_MINUS_BETA_OVER_TWO / 1024;
@@ -187,6 +291,8 @@ lsquic_cubic_timeout (struct lsquic_cubic *cubic)
 
     cwnd = cubic->cu_cwnd;
     LSQ_DEBUG("%s(cubic)", __func__);
+    cubic_save_prior(cubic);
+    cubic->cu_hs.state = HS_DONE;
     cubic_reset(cubic);
     cubic->cu_ssthresh = cwnd / 2;
     cubic->cu_tcp_cwnd = 2 * TCP_MSS;
@@ -194,3 +300,154 @@ lsquic_cubic_timeout (struct lsquic_cubic *cubic)
     LSQ_INFO("timeout, cwnd: %lu", cubic->cu_cwnd);
     LOG_CWND(cubic);
 }
+
+
+void
+lsquic_cubic_undo (struct lsquic_cubic *cubic)
+{
+    LSQ_DEBUG("%s(cubic)", __func__);
+    if (cubic->cu_cwnd < cubic->cu_prior_cwnd)
+        cubic->cu_cwnd = cubic->cu_prior_cwnd;
+    if (cubic->cu_ssthresh < cubic->cu_prior_ssthresh)
+        cubic->cu_ssthresh = cubic->cu_prior_ssthresh;
+    cubic->cu_last_max_cwnd = cubic->cu_prior_last_max_cwnd;
+    cubic->cu_tcp_cwnd = cubic->cu_cwnd;
+    cubic->cu_epoch_start = 0;
+    LSQ_INFO("spurious loss, undo: cwnd: %lu, ssthresh: %lu",
+        cubic->cu_cwnd, cubic->cu_ssthresh);
+    LOG_CWND(cubic);
+}
+
+
+static int
+cubic_init (void *cong_ctl, const struct lsquic_conn_public *conn_pub)
+{
+    struct lsquic_cubic *const cubic = cong_ctl;
+
+    lsquic_cubic_init_ext(cubic, conn_pub->lconn->cn_cid, DEFAULT_CUBIC_FLAGS
+            | (conn_pub->enpub->enp_settings.es_hystart ? CU_HYSTART : 0));
+    cubic->cu_rtt_stats = &conn_pub->rtt_stats;
+    return 0;
+}
+
+
+static void
+cubic_sent (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t now, unsigned bytes_in_flight, int app_limited)
+{
+    struct lsquic_cubic *const cubic = cong_ctl;
+
+    cubic->cu_hs.last_sent_packno = packno;
+}
+
+
+static void
+cubic_begin_ack (void *cong_ctl, lsquic_time_t ack_time,
+                                                    unsigned bytes_in_flight)
+{
+}
+
+
+static void
+cubic_ack (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz,
+            lsquic_time_t sent, lsquic_time_t now, int app_limited)
+{
+    struct lsquic_cubic *const cubic = cong_ctl;
+
+    if (cubic->cu_hs.state != HS_DONE && packno > cubic->cu_hs.window_end)
+        cubic_hystart_new_round(cubic);
+    lsquic_cubic_ack(cubic, now, now - sent, app_limited, packet_sz);
+}
+
+
+static void
+cubic_end_ack (void *cong_ctl, unsigned bytes_in_flight)
+{
+}
+
+
+static void
+cubic_lost (void *cong_ctl, lsquic_packno_t packno, unsigned packet_sz)
+{
+}
+
+
+static void
+cubic_loss (void *cong_ctl)
+{
+    lsquic_cubic_loss(cong_ctl);
+}
+
+
+static void
+cubic_timeout (void *cong_ctl)
+{
+    lsquic_cubic_timeout(cong_ctl);
+}
+
+
+static void
+cubic_undo (void *cong_ctl)
+{
+    lsquic_cubic_undo(cong_ctl);
+}
+
+
+static void
+cubic_was_quiet (void *cong_ctl, lsquic_time_t now)
+{
+    lsquic_cubic_was_quiet(cong_ctl, now);
+}
+
+
+static unsigned long
+cubic_get_cwnd (void *cong_ctl)
+{
+    return lsquic_cubic_get_cwnd((struct lsquic_cubic *) cong_ctl);
+}
+
+
+static uint64_t
+cubic_pacing_rate (void *cong_ctl, int in_recovery)
+{
+    struct lsquic_cubic *const cubic = cong_ctl;
+    uint64_t bandwidth, pacing_rate;
+    lsquic_time_t srtt;
+
+    srtt = lsquic_rtt_stats_get_srtt(cubic->cu_rtt_stats);
+    if (srtt == 0)
+        srtt = 50000;
+    bandwidth = lsquic_cubic_get_cwnd(cubic) * 1000000 / srtt;
+    if (lsquic_cubic_in_slow_start(cubic))
+        pacing_rate = bandwidth * 2;
+    else if (in_recovery)
+        pacing_rate = bandwidth;
+    else
+        pacing_rate = bandwidth + bandwidth / 4;
+
+    return pacing_rate;
+}
+
+
+static void
+cubic_cleanup (void *cong_ctl)
+{
+}
+
+
+const struct cong_ctl_if lsquic_cong_cubic_if =
+{
+    .cci_ack           = cubic_ack,
+    .cci_begin_ack     = cubic_begin_ack,
+    .cci_cleanup       = cubic_cleanup,
+    .cci_end_ack       = cubic_end_ack,
+    .cci_get_cwnd      = cubic_get_cwnd,
+    .cci_init          = cubic_init,
+    .cci_loss          = cubic_loss,
+    .cci_lost          = cubic_lost,
+    .cci_pacing_rate   = cubic_pacing_rate,
+    .cci_sent          = cubic_sent,
+    .cci_timeout       = cubic_timeout,
+    .cci_undo          = cubic_undo,
+    .cci_was_quiet     = cubic_was_quiet,
+};
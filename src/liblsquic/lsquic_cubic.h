@@ -6,6 +6,8 @@
 #ifndef LSQUIC_CUBIC_H
 #define LSQUIC_CUBIC_H 1
 
+struct lsquic_rtt_stats;
+
 struct lsquic_cubic {
     lsquic_time_t   cu_min_delay;
     lsquic_time_t   cu_epoch_start;
@@ -16,11 +18,36 @@ struct lsquic_cubic {
     unsigned long   cu_tcp_cwnd;
     unsigned long   cu_ssthresh;
     lsquic_cid_t    cu_cid;            /* Used for logging */
+    const struct lsquic_rtt_stats
+                   *cu_rtt_stats;
     enum cubic_flags {
         CU_TCP_FRIENDLY = (1 << 0),
+        CU_HYSTART      = (1 << 1),     /* Use HyStart++ in slow start */
     }               cu_flags;
     unsigned        cu_sampling_rate;
     lsquic_time_t   cu_last_logged;
+    /* Saved on loss and timeout, restored if they turn out spurious */
+    unsigned long   cu_prior_cwnd;
+    unsigned long   cu_prior_ssthresh;
+    unsigned long   cu_prior_last_max_cwnd;
+    /* HyStart++ state (RFC 9406).  Round trips are counted using packet
+     * numbers: a round ends when the packet that was the last one sent
+     * at the beginning of the round is acked.
+     */
+    struct {
+        lsquic_packno_t     last_sent_packno;
+        lsquic_packno_t     window_end;
+        lsquic_time_t       last_round_min_rtt;
+        lsquic_time_t       cur_round_min_rtt;
+        lsquic_time_t       css_baseline_min_rtt;
+        unsigned            n_rtt_samples;
+        unsigned            css_round_count;
+        enum {
+            HS_SLOW_START,
+            HS_CSS,         /* Conservative slow start */
+            HS_DONE,
+        }                   state;
+    }               cu_hs;
 };
 
 #define DEFAULT_CUBIC_FLAGS (CU_TCP_FRIENDLY)
@@ -43,6 +70,9 @@ lsquic_cubic_loss (struct lsquic_cubic *cubic);
 void
 lsquic_cubic_timeout (struct lsquic_cubic *cubic);
 
+void
+lsquic_cubic_undo (struct lsquic_cubic *cubic);
+
 void
 lsquic_cubic_was_quiet (struct lsquic_cubic *, lsquic_time_t now);
 
@@ -51,4 +81,6 @@ lsquic_cubic_was_quiet (struct lsquic_cubic *, lsquic_time_t now);
 #define lsquic_cubic_in_slow_start(cubic) \
                         ((cubic)->cu_cwnd < (cubic)->cu_ssthresh)
 
+extern const struct cong_ctl_if lsquic_cong_cubic_if;
+
 #endif
@@ -7,38 +7,32 @@
  * and packet reference count is decremented, which possibly results in
  * packet being released as well.
  *
- * This approach works well in regular circumstances; there are two scenarios
- * when it does not:
+ * Frames are kept on a list sorted by offset.  To make insertion of
+ * out-of-order frames cheap, the list is indexed by a skip list: about
+ * one in four frames gets an index node that is linked on one or more
+ * levels, each level skipping over about four times as many frames as the
+ * level below it.  This way, finding the position of a new frame takes
+ * O(log n) steps no matter how badly the frames are reordered.  Frames are
+ * always read from the head of the list, so removing an index node is
+ * cheap, too.
  *
- *  A.  If we have many out-of-order frames, insertion into the list becomes
- *      expensive.  In the degenerate case, we'd have to traverse the whole
- *      list to find appropriate position.
+ * Having many frames ties up resources, as each frame keeps a reference
+ * to the packet that contains it.  This is a possible attack vector: send
+ * many one-byte packets; a single hole at the beginning will stop the
+ * server from being able to read the stream, thus tying up resources.
+ * If we detect this, we request that the stream switch to a more robust
+ * incoming stream frame handler by setting DI_SWITCH_IMPL flag.
  *
- *  B.  Having many frames ties up resources, as each frame keeps a reference
- *      to the packet that contains it.  This is a possible attack vector:
- *      send many one-byte packets; a single hole at the beginning will stop
- *      the server from being able to read the stream, thus tying up resources.
+ * For a small number of elements, this does not matter and the checks are
+ * not performed.  This number is defined by EFF_CHECK_THRESH_LOW.  On the
+ * other side of the spectrum, if the number of frames grows very high, we
+ * want to switch to a more memory-efficient implementation regardless.
+ * EFF_CHECK_THRESH_HIGH defines this threshold.
  *
- * If we detect that either (A) or (B) is true, we request that the stream
- * switch to a more robust incoming stream frame handler by setting
- * DI_SWITCH_IMPL flag.
- *
- * For a small number of elements, (A) and (B) do not matter and the checks
- * are not performed.  This number is defined by EFF_CHECK_THRESH_LOW.  On
- * the other side of the spectrum, if the number of frames grows very high,
- * we want to switch to a more memory-efficient implementation even if (A)
- * and (B) are not true.  EFF_CHECK_THRESH_HIGH defines this threshold.
- *
- * Between the low and high thresholds, we detect efficiency problems as
- * follows.
- *
- * To detect (A), we count how many elements we have to traverse during
- * insertion.  If we have to traverse at least half the list
- * EFF_FAR_TRAVERSE_COUNT in a row, DI_SWITCH_IMPL is issued.
- *
- * If average stream frame size is smaller than EFF_TINY_FRAME_SZ bytes,
- * (B) condition is true.  In addition, if there are more than EFF_MAX_HOLES
- * in the stream, this is also indicative of (B).
+ * Between the low and high thresholds, the alert is issued if average
+ * stream frame size is smaller than EFF_TINY_FRAME_SZ bytes.  Frames that
+ * merely arrive out of order, leaving holes in the stream, are not deemed
+ * suspicious: the amount of data they tie up is bounded by flow control.
  */
 
 
@@ -47,6 +41,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/queue.h>
 
 #include "lsquic.h"
@@ -81,32 +76,41 @@
  */
 #define EFF_CHECK_THRESH_HIGH   1000
 
-/* Maximum number of consecutive far traversals */
-#define EFF_FAR_TRAVERSE_COUNT  4
-
-/* Maximum number of holes that is not deemed suspicious */
-#define EFF_MAX_HOLES           5
-
 /* What is deemed a tiny frame, in bytes.  If it is a power of two, calculation
  * is cheaper.
  */
 #define EFF_TINY_FRAME_SZ       64
 
 
+/* Number of index levels in the skip list.  With one in four frames
+ * promoted to the next level, this is enough for EFF_CHECK_THRESH_HIGH
+ * frames several times over.
+ */
+#define SKIP_MAX_LEVEL          8
+
+
 TAILQ_HEAD(stream_frames_tailq, stream_frame);
 
 
+struct skip_node
+{
+    struct stream_frame        *sn_frame;
+    unsigned                    sn_level;       /* Number of levels */
+    struct skip_node           *sn_next[];
+};
+
+
 struct nocopy_data_in
 {
     struct stream_frames_tailq  ncdi_frames_in;
     struct data_in              ncdi_data_in;
     struct lsquic_conn_public  *ncdi_conn_pub;
+    struct skip_node           *ncdi_skip[SKIP_MAX_LEVEL];  /* Level heads */
     uint64_t                    ncdi_byteage;
     uint64_t                    ncdi_fin_off;
     uint32_t                    ncdi_stream_id;
+    uint32_t                    ncdi_skip_rand;
     unsigned                    ncdi_n_frames;
-    unsigned                    ncdi_n_holes;
-    unsigned                    ncdi_cons_far;
     enum {
         NCDI_FIN_SET        = 1 << 0,
         NCDI_FIN_REACHED    = 1 << 1,
@@ -140,10 +144,10 @@ data_in_nocopy_new (struct lsquic_conn_public *conn_pub, uint32_t stream_id)
     ncdi->ncdi_stream_id        = stream_id;
     ncdi->ncdi_byteage          = 0;
     ncdi->ncdi_n_frames         = 0;
-    ncdi->ncdi_n_holes          = 0;
-    ncdi->ncdi_cons_far         = 0;
     ncdi->ncdi_fin_off          = 0;
     ncdi->ncdi_flags            = 0;
+    ncdi->ncdi_skip_rand        = stream_id ^ (uint32_t) (uintptr_t) ncdi;
+    memset(ncdi->ncdi_skip, 0, sizeof(ncdi->ncdi_skip));
     LSQ_DEBUG("initialized");
     return &ncdi->ncdi_data_in;
 }
@@ -154,12 +158,18 @@ nocopy_di_destroy (struct data_in *data_in)
 {
     struct nocopy_data_in *const ncdi = NCDI_PTR(data_in);
     stream_frame_t *frame;
+    struct skip_node *node, *next;
     while ((frame = TAILQ_FIRST(&ncdi->ncdi_frames_in)))
     {
         TAILQ_REMOVE(&ncdi->ncdi_frames_in, frame, next_frame);
         lsquic_packet_in_put(ncdi->ncdi_conn_pub->mm, frame->packet_in);
         lsquic_malo_put(frame);
     }
+    for (node = ncdi->ncdi_skip[0]; node; node = next)
+    {
+        next = node->sn_next[0];
+        free(node);
+    }
     free(ncdi);
 }
 
@@ -175,8 +185,10 @@ static int
 frame_list_is_sane (const struct nocopy_data_in *ncdi)
 {
     const stream_frame_t *frame;
+    const struct skip_node *node;
     uint64_t prev_off = 0, prev_end = 0;
     int ordered = 1, overlaps = 0;
+    unsigned level;
     TAILQ_FOREACH(frame, &ncdi->ncdi_frames_in, next_frame)
     {
         ordered &= prev_off <= DF_OFF(frame);
@@ -184,6 +196,16 @@ frame_list_is_sane (const struct nocopy_data_in *ncdi)
         prev_off = DF_OFF(frame);
         prev_end = DF_END(frame);
     }
+    for (level = 0; level < SKIP_MAX_LEVEL; ++level)
+    {
+        prev_off = 0;
+        for (node = ncdi->ncdi_skip[level]; node; node = node->sn_next[level])
+        {
+            ordered &= prev_off <= DF_OFF(node->sn_frame);
+            ordered &= node->sn_level > level;
+            prev_off = DF_OFF(node->sn_frame);
+        }
+    }
     return ordered && !overlaps;
 }
 
@@ -194,6 +216,117 @@ frame_list_is_sane (const struct nocopy_data_in *ncdi)
 #endif
 
 
+/* Promote one in four frames to the next level */
+static unsigned
+skip_random_level (struct nocopy_data_in *ncdi)
+{
+    unsigned level, bits;
+
+    ncdi->ncdi_skip_rand = ncdi->ncdi_skip_rand * 1103515245 + 12345;
+    bits = ncdi->ncdi_skip_rand >> 16;
+    for (level = 0; level < SKIP_MAX_LEVEL && 0 == (bits & 3); ++level)
+        bits >>= 2;
+    return level;
+}
+
+
+/* Return the last frame whose offset is at or below `off', or NULL if there
+ * is no such frame.  For each level, `update' is set to the last node that
+ * precedes the insertion point.
+ */
+static struct stream_frame *
+skip_find_prev (struct nocopy_data_in *ncdi, uint64_t off,
+                                                    struct skip_node **update)
+{
+    struct skip_node *node, *next;
+    struct stream_frame *frame, *next_frame;
+    int level;
+
+    node = NULL;
+    for (level = SKIP_MAX_LEVEL - 1; level >= 0; --level)
+    {
+        next = node ? node->sn_next[level] : ncdi->ncdi_skip[level];
+        while (next && DF_OFF(next->sn_frame) <= off)
+        {
+            node = next;
+            next = node->sn_next[level];
+        }
+        update[level] = node;
+    }
+
+    if (node)
+        frame = node->sn_frame;
+    else
+    {
+        frame = TAILQ_FIRST(&ncdi->ncdi_frames_in);
+        if (!frame || DF_OFF(frame) > off)
+            return NULL;
+    }
+
+    while ((next_frame = TAILQ_NEXT(frame, next_frame))
+                                            && DF_OFF(next_frame) <= off)
+        frame = next_frame;
+
+    return frame;
+}
+
+
+/* The index is only an optimization: if memory cannot be allocated, the
+ * frame is simply not indexed.
+ */
+static void
+skip_insert (struct nocopy_data_in *ncdi, struct stream_frame *frame,
+                                                    struct skip_node **update)
+{
+    struct skip_node *node;
+    unsigned level, i;
+
+    level = skip_random_level(ncdi);
+    if (0 == level)
+        return;
+
+    node = malloc(sizeof(*node) + sizeof(node->sn_next[0]) * level);
+    if (!node)
+        return;
+
+    node->sn_frame = frame;
+    node->sn_level = level;
+    for (i = 0; i < level; ++i)
+        if (update[i])
+        {
+            node->sn_next[i] = update[i]->sn_next[i];
+            update[i]->sn_next[i] = node;
+        }
+        else
+        {
+            node->sn_next[i] = ncdi->ncdi_skip[i];
+            ncdi->ncdi_skip[i] = node;
+        }
+}
+
+
+/* Frames are removed from the head of the list.  If the frame is indexed,
+ * its node is at the head of every level it is linked on.
+ */
+static void
+skip_remove_first (struct nocopy_data_in *ncdi,
+                                        const struct stream_frame *frame)
+{
+    struct skip_node *const node = ncdi->ncdi_skip[0];
+    unsigned i;
+
+    if (node && node->sn_frame == frame)
+    {
+        for (i = 0; i < node->sn_level; ++i)
+        {
+            assert(ncdi->ncdi_skip[i] == node);
+            ncdi->ncdi_skip[i] = node->sn_next[i];
+        }
+        free(node);
+    }
+}
+
+
 #define CASE(letter) ((int) (letter) << 8)
 
 /* Not all errors are picked up by this function, as it is expensive (and
@@ -203,10 +336,10 @@ frame_list_is_sane (const struct nocopy_data_in *ncdi)
  */
 static int
 insert_frame (struct nocopy_data_in *ncdi, struct stream_frame *new_frame,
-                                    uint64_t read_offset, unsigned *p_n_frames)
+                                                        uint64_t read_offset)
 {
     stream_frame_t *prev_frame, *next_frame;
-    unsigned count;
+    struct skip_node *update[SKIP_MAX_LEVEL];
 
     if (read_offset > DF_END(new_frame))
     {
@@ -231,34 +364,12 @@ insert_frame (struct nocopy_data_in *ncdi, struct stream_frame *new_frame,
             return INS_FRAME_DUP                                | CASE('L');
     }
 
-    /* Find position in the list, going backwards.  We go backwards because
-     * that is the most likely scenario.
-     */
-    next_frame = TAILQ_LAST(&ncdi->ncdi_frames_in, stream_frames_tailq);
-    if (next_frame && DF_OFF(new_frame) < DF_OFF(next_frame))
-    {
-        count = 1;
-        prev_frame = TAILQ_PREV(next_frame, stream_frames_tailq, next_frame);
-        for ( ; prev_frame && DF_OFF(new_frame) < DF_OFF(next_frame);
-                next_frame = prev_frame,
-                    prev_frame = TAILQ_PREV(prev_frame, stream_frames_tailq, next_frame))
-        {
-            if (DF_OFF(new_frame) >= DF_OFF(prev_frame))
-                break;
-            ++count;
-        }
-    }
+    /* Find position in the list */
+    prev_frame = skip_find_prev(ncdi, DF_OFF(new_frame), update);
+    if (prev_frame)
+        next_frame = TAILQ_NEXT(prev_frame, next_frame);
     else
-    {
-        count = 0;
-        prev_frame = NULL;
-    }
-
-    if (!prev_frame && next_frame && DF_OFF(new_frame) >= DF_OFF(next_frame))
-    {
-        prev_frame = next_frame;
-        next_frame = TAILQ_NEXT(next_frame, next_frame);
-    }
+        next_frame = TAILQ_FIRST(&ncdi->ncdi_frames_in);
 
     const int select = !!prev_frame << 1 | !!next_frame;
     switch (select)
@@ -306,20 +417,13 @@ insert_frame (struct nocopy_data_in *ncdi, struct stream_frame *new_frame,
     {
   have_prev:
         TAILQ_INSERT_AFTER(&ncdi->ncdi_frames_in, prev_frame, new_frame, next_frame);
-        ncdi->ncdi_n_holes += DF_END(prev_frame) != DF_OFF(new_frame);
-        if (next_frame)
-        {
-            ncdi->ncdi_n_holes += DF_END(new_frame) != DF_OFF(next_frame);
-            --ncdi->ncdi_n_holes;
-        }
     }
     else
     {
-        ncdi->ncdi_n_holes += next_frame
-                           && DF_END(new_frame) != DF_OFF(next_frame);
   list_was_empty:
         TAILQ_INSERT_HEAD(&ncdi->ncdi_frames_in, new_frame, next_frame);
     }
+    skip_insert(ncdi, new_frame, update);
     CHECK_ORDER(ncdi);
 
     if (DF_FIN(new_frame))
@@ -331,32 +435,18 @@ insert_frame (struct nocopy_data_in *ncdi, struct stream_frame *new_frame,
 
     ++ncdi->ncdi_n_frames;
     ncdi->ncdi_byteage += DF_SIZE(new_frame);
-    *p_n_frames = count;
 
     return INS_FRAME_OK                                         | CASE('Z');
 }
 
 
 static int
-check_efficiency (struct nocopy_data_in *ncdi, unsigned count)
+check_efficiency (struct nocopy_data_in *ncdi)
 {
     if (ncdi->ncdi_n_frames <= EFF_CHECK_THRESH_LOW)
-    {
-        ncdi->ncdi_cons_far = 0;
         return 0;
-    }
     if (ncdi->ncdi_n_frames > EFF_CHECK_THRESH_HIGH)
         return 1;
-    if (count >= ncdi->ncdi_n_frames / 2)
-    {
-        ++ncdi->ncdi_cons_far;
-        if (ncdi->ncdi_cons_far > EFF_FAR_TRAVERSE_COUNT)
-            return 1;
-    }
-    else
-        ncdi->ncdi_cons_far = 0;
-    if (ncdi->ncdi_n_holes > EFF_MAX_HOLES)
-        return 1;
     if (ncdi->ncdi_byteage / EFF_TINY_FRAME_SZ < ncdi->ncdi_n_frames)
         return 1;
     return 0;
@@ -366,9 +456,8 @@ check_efficiency (struct nocopy_data_in *ncdi, unsigned count)
 static void
 set_eff_alert (struct nocopy_data_in *ncdi)
 {
-    LSQ_DEBUG("low efficiency: n_frames: %u; n_holes: %u; cons_far: %u; "
-              "byteage: %"PRIu64, ncdi->ncdi_n_frames, ncdi->ncdi_n_holes,
-              ncdi->ncdi_cons_far, ncdi->ncdi_byteage);
+    LSQ_DEBUG("low efficiency: n_frames: %u; byteage: %"PRIu64,
+                                    ncdi->ncdi_n_frames, ncdi->ncdi_byteage);
     ncdi->ncdi_data_in.di_flags |= DI_SWITCH_IMPL;
 }
 
@@ -378,19 +467,18 @@ nocopy_di_insert_frame (struct data_in *data_in,
                         struct stream_frame *new_frame, uint64_t read_offset)
 {
     struct nocopy_data_in *const ncdi = NCDI_PTR(data_in);
-    unsigned count;
     enum ins_frame ins;
     int ins_case;
 
     assert(0 == (new_frame->data_frame.df_fin & ~1));
-    ins_case = insert_frame(ncdi, new_frame, read_offset, &count);
+    ins_case = insert_frame(ncdi, new_frame, read_offset);
     ins = ins_case & 0xFF;
     ins_case >>= 8;
     LSQ_DEBUG("%s: ins: %d (case '%c')", __func__, ins, (char) ins_case);
     switch (ins)
     {
     case INS_FRAME_OK:
-        if (check_efficiency(ncdi, count))
+        if (check_efficiency(ncdi))
             set_eff_alert(ncdi);
         break;
     case INS_FRAME_DUP:
@@ -431,12 +519,11 @@ static void
 nocopy_di_frame_done (struct data_in *data_in, struct data_frame *data_frame)
 {
     struct nocopy_data_in *const ncdi = NCDI_PTR(data_in);
-    struct stream_frame *const frame = STREAM_FRAME_PTR(data_frame), *first;
+    struct stream_frame *const frame = STREAM_FRAME_PTR(data_frame);
     assert(data_frame->df_read_off == data_frame->df_size);
+    assert(frame == TAILQ_FIRST(&ncdi->ncdi_frames_in));
+    skip_remove_first(ncdi, frame);
     TAILQ_REMOVE(&ncdi->ncdi_frames_in, frame, next_frame);
-    first = TAILQ_FIRST(&ncdi->ncdi_frames_in);
-    ncdi->ncdi_n_holes -= first && frame->data_frame.df_offset +
-                    frame->data_frame.df_size != first->data_frame.df_offset;
     --ncdi->ncdi_n_frames;
     ncdi->ncdi_byteage -= frame->data_frame.df_size;
     if (DF_FIN(frame))
@@ -502,11 +589,14 @@ nocopy_di_mem_used (struct data_in *data_in)
 {
     struct nocopy_data_in *const ncdi = NCDI_PTR(data_in);
     const stream_frame_t *frame;
+    const struct skip_node *node;
     size_t size;
 
     size = sizeof(*data_in);
     TAILQ_FOREACH(frame, &ncdi->ncdi_frames_in, next_frame)
         size += lsquic_packet_in_mem_used(frame->packet_in);
+    for (node = ncdi->ncdi_skip[0]; node; node = node->sn_next[0])
+        size += sizeof(*node) + sizeof(node->sn_next[0]) * node->sn_level;
 
     return size;
 }
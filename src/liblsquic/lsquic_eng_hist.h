@@ -83,12 +83,19 @@ eng_hist_log (const struct eng_hist *);
     ++(eh)->eh_slices[(eh)->eh_cur_idx].what;                               \
 } while (0)
 
+/* Add `n' to element `what'. */
+#define eng_hist_add(eh, now, what, n) do {                                 \
+    eng_hist_tick(eh, now);                                                 \
+    (eh)->eh_slices[(eh)->eh_cur_idx].what += (n);                          \
+} while (0)
+
 #else /* !ENG_HIST_ENABLED */
 
 #define eng_hist_init(eh)
 #define eng_hist_clear_cur(eh)
 #define eng_hist_tick(eh, now)
 #define eng_hist_inc(eh, now, what)
+#define eng_hist_add(eh, now, what, n)
 #define eng_hist_log(eh)
 
 #endif  /* ENG_HIST_ENABLED */
@@ -34,7 +34,9 @@
 #include "lsquic_packet_out.h"
 #include "lsquic_senhist.h"
 #include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
 #include "lsquic_pacer.h"
 #include "lsquic_send_ctl.h"
 #include "lsquic_set.h"
@@ -69,10 +71,26 @@
 #define MIN_OUT_BATCH_SIZE 4
 #define INITIAL_OUT_BATCH_SIZE 32
 
+/* Incoming packets passed to lsquic_engine_packets_in() are processed in
+ * chunks of this size.
+ */
+#define MAX_IN_BATCH_SIZE 64
+
+/* Linux allows up to 64 segments (UDP_MAX_SEGMENTS) per GSO send and the
+ * total must fit into a single UDP datagram.
+ */
+#define MAX_GSO_SEGS 64
+#define MAX_GSO_SZ (0xFFFF - 8 /* UDP header */ - 40 /* IPv6 header */)
+
+/* `conns', `packets', and `iov' are indexed by packet, while `outs' is
+ * indexed by spec.  Each spec references one or more consecutive elements
+ * of the `iov' array.
+ */
 struct out_batch
 {
     lsquic_conn_t           *conns  [MAX_OUT_BATCH_SIZE];
     lsquic_packet_out_t     *packets[MAX_OUT_BATCH_SIZE];
+    struct iovec             iov    [MAX_OUT_BATCH_SIZE];
     struct lsquic_out_spec   outs   [MAX_OUT_BATCH_SIZE];
 };
 
@@ -92,6 +110,11 @@ engine_decref_conn (lsquic_engine_t *engine, lsquic_conn_t *conn,
 static void
 force_close_conn (lsquic_engine_t *engine, lsquic_conn_t *conn);
 
+static void
+pass_packet_to_conn (lsquic_engine_t *engine, lsquic_conn_t *conn,
+        lsquic_packet_in_t *packet_in, const struct sockaddr *sa_local,
+        const struct sockaddr *sa_peer, void *peer_ctx);
+
 /* Nested calls to LSQUIC are not supported */
 #define ENGINE_IN(e) do {                               \
     assert(!((e)->pub.enp_flags & ENPUB_PROC));         \
@@ -220,6 +243,14 @@ lsquic_engine_init_settings (struct lsquic_engine_settings *settings,
     settings->es_proc_time_thresh= LSQUIC_DF_PROC_TIME_THRESH;
     settings->es_pace_packets    = LSQUIC_DF_PACE_PACKETS;
     settings->es_clock_granularity = LSQUIC_DF_CLOCK_GRANULARITY;
+    settings->es_txtime_horizon  = LSQUIC_DF_TXTIME_HORIZON;
+    settings->es_gso             = LSQUIC_DF_GSO;
+    settings->es_attq_wheel      = LSQUIC_DF_ATTQ_WHEEL;
+    settings->es_cc_algo         = LSQUIC_DF_CC_ALGO;
+    settings->es_hystart         = LSQUIC_DF_HYSTART;
+    settings->es_ack_freq        = LSQUIC_DF_ACK_FREQ;
+    settings->es_ack_decimation  = LSQUIC_DF_ACK_DECIMATION;
+    settings->es_max_recv_ranges = LSQUIC_DF_MAX_RECV_RANGES;
 }
 
 
@@ -251,6 +282,19 @@ lsquic_engine_check_settings (const struct lsquic_engine_settings *settings,
                         "one or more unsupported QUIC version is specified");
         return -1;
     }
+    if (settings->es_cc_algo > 2)
+    {
+        if (err_buf)
+            snprintf(err_buf, err_buf_sz, "Invalid congestion control "
+                "algorithm value %u", settings->es_cc_algo);
+        return -1;
+    }
+    if (settings->es_ack_freq < 1)
+    {
+        if (err_buf)
+            snprintf(err_buf, err_buf_sz, "ACK frequency must be at least 1");
+        return -1;
+    }
     return 0;
 }
 
@@ -308,6 +352,18 @@ lsquic_engine_new (unsigned flags,
         return NULL;
     }
 
+    if (api->ea_cc_if && !(api->ea_cc_if->cci_create
+            && api->ea_cc_if->cci_sent && api->ea_cc_if->cci_begin_ack
+            && api->ea_cc_if->cci_ack && api->ea_cc_if->cci_end_ack
+            && api->ea_cc_if->cci_lost && api->ea_cc_if->cci_loss
+            && api->ea_cc_if->cci_timeout && api->ea_cc_if->cci_was_quiet
+            && api->ea_cc_if->cci_get_cwnd && api->ea_cc_if->cci_pacing_rate
+            && api->ea_cc_if->cci_destroy))
+    {
+        LSQ_ERROR("congestion controller interface is incomplete");
+        return NULL;
+    }
+
     engine = calloc(1, sizeof(*engine));
     if (!engine)
         return NULL;
@@ -349,10 +405,19 @@ lsquic_engine_new (unsigned flags,
     }
     engine->pub.enp_verify_cert  = api->ea_verify_cert;
     engine->pub.enp_verify_ctx   = api->ea_verify_ctx;
+    engine->pub.enp_mm.packin_release     = api->ea_packin_release;
+    engine->pub.enp_mm.packin_release_ctx = api->ea_packin_release_ctx;
+    engine->pub.enp_cc_if  = api->ea_cc_if;
+    engine->pub.enp_cc_ctx = api->ea_cc_ctx;
     engine->pub.enp_engine = engine;
     conn_hash_init(&engine->conns_hash,
                         hash_conns_by_addr(engine) ?  CHF_USE_ADDR : 0);
-    engine->attq = attq_create();
+    if (engine->pub.enp_settings.es_attq_wheel)
+        engine->attq = attq_wheel_create(
+                            engine->pub.enp_settings.es_clock_granularity,
+                            lsquic_time_now());
+    else
+        engine->attq = attq_create();
     eng_hist_init(&engine->history);
     engine->batch_size = INITIAL_OUT_BATCH_SIZE;
 
@@ -553,8 +618,6 @@ process_packet_in (lsquic_engine_t *engine, lsquic_packet_in_t *packet_in,
        const struct sockaddr *sa_peer, void *peer_ctx)
 {
     lsquic_conn_t *conn;
-    const unsigned char *packet_in_data;
-    size_t packet_in_size;
 
     if (lsquic_packet_in_is_gquic_prst(packet_in)
                                 && !engine->pub.enp_settings.es_honor_prst)
@@ -572,6 +635,19 @@ process_packet_in (lsquic_engine_t *engine, lsquic_packet_in_t *packet_in,
         return 1;
     }
 
+    pass_packet_to_conn(engine, conn, packet_in, sa_local, sa_peer, peer_ctx);
+    return 0;
+}
+
+
+static void
+pass_packet_to_conn (lsquic_engine_t *engine, lsquic_conn_t *conn,
+        lsquic_packet_in_t *packet_in, const struct sockaddr *sa_local,
+        const struct sockaddr *sa_peer, void *peer_ctx)
+{
+    const unsigned char *packet_in_data;
+    size_t packet_in_size;
+
     if (0 == (conn->cn_flags & LSCONN_TICKABLE))
     {
         lsquic_mh_insert(&engine->conns_tickable, conn, conn->cn_last_ticked);
@@ -601,7 +677,15 @@ process_packet_in (lsquic_engine_t *engine, lsquic_packet_in_t *packet_in,
     conn->cn_if->ci_packet_in(conn, packet_in);
     QLOG_PACKET_RX(conn->cn_cid, packet_in, packet_in_data, packet_in_size);
     lsquic_packet_in_put(&engine->pub.enp_mm, packet_in);
-    return 0;
+}
+
+
+void
+lsquic_engine_set_shard (lsquic_engine_t *engine, unsigned shard)
+{
+    assert(shard <= ENPUB_SHARD_MASK);
+    engine->pub.enp_shard = shard;
+    engine->pub.enp_flags |= ENPUB_SHARDED;
 }
 
 
@@ -667,6 +751,10 @@ lsquic_engine_destroy (lsquic_engine_t *engine)
         fprintf(engine->stats_fh, "    Total bytes: %lu\n", stats->out.bytes);
         fprintf(engine->stats_fh, "    packets: %lu\n", stats->out.packets);
         fprintf(engine->stats_fh, "    retx packets: %lu\n", stats->out.retx_packets);
+        fprintf(engine->stats_fh, "    lost packets: %lu; spurious losses: %lu\n",
+            stats->out.lost_packets, stats->out.spurious_losses);
+        fprintf(engine->stats_fh, "    cwnd undos after loss: %lu; after RTO: %lu\n",
+            stats->out.loss_undos, stats->out.rto_undos);
         fprintf(engine->stats_fh, "    STREAM frame count: %lu\n", stats->out.stream_frames);
         fprintf(engine->stats_fh, "    STREAM payload size: %lu\n", stats->out.stream_data_sz);
         fprintf(engine->stats_fh, "    Header bytes: %lu; uncompressed: %lu; ratio %.3lf\n",
@@ -674,7 +762,8 @@ lsquic_engine_destroy (lsquic_engine_t *engine)
             stats->out.headers_uncomp ?
             (double) stats->out.headers_comp / (double) stats->out.headers_uncomp
             : 0);
-        fprintf(engine->stats_fh, "    ACKs: %lu\n", stats->out.acks);
+        fprintf(engine->stats_fh, "    ACKs: %lu; ACK-only packets: %lu\n",
+            stats->out.acks, stats->out.ack_only_packets);
     }
 #endif
     free(engine);
@@ -1102,33 +1191,49 @@ coi_reheap (struct conns_out_iter *iter, lsquic_engine_t *engine)
 }
 
 
+/* Returns number of packets (not specs) sent */
 static unsigned
 send_batch (lsquic_engine_t *engine, struct conns_out_iter *conns_iter,
-                  struct out_batch *batch, unsigned n_to_send)
+            struct out_batch *batch, unsigned n_to_send, unsigned n_specs)
 {
-    int n_sent, i;
+    int n_sent, n_specs_sent, i;
     lsquic_time_t now;
 
-    /* Set sent time before the write to avoid underestimating RTT */
+    /* Set sent time before the write to avoid underestimating RTT.  A
+     * packet with departure time in the future is sent at that time.
+     */
     now = lsquic_time_now();
     for (i = 0; i < (int) n_to_send; ++i)
-        batch->packets[i]->po_sent = now;
-    n_sent = engine->packets_out(engine->packets_out_ctx, batch->outs,
-                                                                n_to_send);
-    if (n_sent < (int) n_to_send)
+        if (batch->packets[i]->po_flags & PO_TXTIME)
+        {
+            batch->packets[i]->po_flags &= ~PO_TXTIME;
+            if (batch->packets[i]->po_sent < now)
+                batch->packets[i]->po_sent = now;
+        }
+        else
+            batch->packets[i]->po_sent = now;
+    n_specs_sent = engine->packets_out(engine->packets_out_ctx, batch->outs,
+                                                                    n_specs);
+    if (n_specs_sent < (int) n_specs)
     {
         engine->pub.enp_flags &= ~ENPUB_CAN_SEND;
         engine->resume_sending_at = now + 1000000;
         LSQ_DEBUG("cannot send packets");
         EV_LOG_GENERIC_EVENT("cannot send packets");
     }
-    if (n_sent >= 0)
-        LSQ_DEBUG("packets out returned %d (out of %u)", n_sent, n_to_send);
+    if (n_specs_sent >= 0)
+        LSQ_DEBUG("packets out returned %d (out of %u)", n_specs_sent,
+                                                                n_specs);
     else
     {
         LSQ_DEBUG("packets out returned an error: %s", strerror(errno));
-        n_sent = 0;
+        n_specs_sent = 0;
     }
+    if (n_specs_sent == (int) n_specs)
+        n_sent = (int) n_to_send;
+    else
+        for (n_sent = 0, i = 0; i < n_specs_sent; ++i)
+            n_sent += (int) batch->outs[i].iovlen;
     if (n_sent > 0)
         engine->last_sent = now + n_sent;
     for (i = 0; i < n_sent; ++i)
@@ -1186,21 +1291,28 @@ send_packets_out (struct lsquic_engine *engine,
                   struct conns_tailq *ticked_conns,
                   struct conns_stailq *closed_conns)
 {
-    unsigned n, w, n_sent, n_batches_sent;
+    unsigned n, n_specs, w, n_sent, n_batches_sent;
     lsquic_packet_out_t *packet_out;
-    lsquic_conn_t *conn;
+    lsquic_conn_t *conn, *gso_conn;
     struct out_batch *const batch = &engine->out_batch;
+    struct lsquic_out_spec *spec;
     struct conns_out_iter conns_iter;
     int shrink, deadline_exceeded;
+    const int gso = engine->pub.enp_settings.es_gso;
 
     coi_init(&conns_iter, engine);
     n_batches_sent = 0;
-    n_sent = 0, n = 0;
+    n_sent = 0, n = 0, n_specs = 0;
     shrink = 0;
     deadline_exceeded = 0;
+    /* When GSO is on, keep taking packets from the same connection for as
+     * long as they can be added to its current spec.
+     */
+    gso_conn = NULL;
 
-    while ((conn = coi_next(&conns_iter)))
+    while ((conn = gso_conn ? gso_conn : coi_next(&conns_iter)))
     {
+        gso_conn = NULL;
         packet_out = conn->cn_if->ci_next_packet_to_send(conn);
         if (!packet_out) {
             LSQ_DEBUG("batched all outgoing packets for conn %"PRIu64,
@@ -1254,24 +1366,54 @@ send_packets_out (struct lsquic_engine *engine,
         assert(conn->cn_flags & LSCONN_HAS_PEER_SA);
         if (packet_out->po_flags & PO_ENCRYPTED)
         {
-            batch->outs[n].buf     = packet_out->po_enc_data;
-            batch->outs[n].sz      = packet_out->po_enc_data_sz;
+            batch->iov[n].iov_base = packet_out->po_enc_data;
+            batch->iov[n].iov_len  = packet_out->po_enc_data_sz;
         }
         else
         {
-            batch->outs[n].buf     = packet_out->po_data;
-            batch->outs[n].sz      = packet_out->po_data_sz;
+            batch->iov[n].iov_base = packet_out->po_data;
+            batch->iov[n].iov_len  = packet_out->po_data_sz;
+        }
+        spec = n_specs ? &batch->outs[n_specs - 1] : NULL;
+        if (gso && spec && batch->conns[n - 1] == conn
+                && batch->iov[n - 1].iov_len == spec->segsz
+                && batch->iov[n].iov_len <= spec->segsz
+                && spec->iovlen < MAX_GSO_SEGS
+                && spec->segsz * spec->iovlen + batch->iov[n].iov_len
+                                                            <= MAX_GSO_SZ
+                /* Paced packets leave one at a time */
+                && !(packet_out->po_flags & PO_TXTIME) && !spec->txtime)
+        {
+            ++spec->iovlen;
+            LSQ_DEBUG("coalesced packet %"PRIu64" into spec of %zu packets",
+                                            packet_out->po_packno, spec->iovlen);
+        }
+        else
+        {
+            spec = &batch->outs[n_specs++];
+            spec->buf      = batch->iov[n].iov_base;
+            spec->sz       = batch->iov[n].iov_len;
+            spec->peer_ctx = conn->cn_peer_ctx;
+            spec->local_sa = (struct sockaddr *) conn->cn_local_addr;
+            spec->dest_sa  = (struct sockaddr *) conn->cn_peer_addr;
+            spec->iov      = &batch->iov[n];
+            spec->iovlen   = 1;
+            spec->segsz    = batch->iov[n].iov_len;
+            spec->txtime   = packet_out->po_flags & PO_TXTIME
+                                                ? packet_out->po_sent : 0;
         }
-        batch->outs   [n].peer_ctx = conn->cn_peer_ctx;
-        batch->outs   [n].local_sa = (struct sockaddr *) conn->cn_local_addr;
-        batch->outs   [n].dest_sa  = (struct sockaddr *) conn->cn_peer_addr;
         batch->conns  [n]          = conn;
         batch->packets[n]          = packet_out;
         ++n;
+        if (gso && batch->iov[n - 1].iov_len == spec->segsz
+                                        && spec->iovlen < MAX_GSO_SEGS)
+            gso_conn = conn;
         if (n == engine->batch_size)
         {
             n = 0;
-            w = send_batch(engine, &conns_iter, batch, engine->batch_size);
+            w = send_batch(engine, &conns_iter, batch, engine->batch_size,
+                                                                    n_specs);
+            n_specs = 0;
             ++n_batches_sent;
             n_sent += w;
             if (w < engine->batch_size)
@@ -1288,7 +1430,7 @@ send_packets_out (struct lsquic_engine *engine,
   end_for:
 
     if (n > 0) {
-        w = send_batch(engine, &conns_iter, batch, n);
+        w = send_batch(engine, &conns_iter, batch, n, n_specs);
         n_sent += w;
         shrink = w < n;
         ++n_batches_sent;
@@ -1444,11 +1586,31 @@ process_connections (lsquic_engine_t *engine, conn_iter_f next_conn,
 /* Return 0 if packet is being processed by a real connection, 1 if the
  * packet was processed, but not by a connection, and -1 on error.
  */
-int
-lsquic_engine_packet_in (lsquic_engine_t *engine,
+/* If the user owns incoming packet buffers, give it back */
+static void
+release_packet_in_data (lsquic_engine_t *engine, const unsigned char *data)
+{
+    if (engine->pub.enp_mm.packin_release)
+        engine->pub.enp_mm.packin_release(engine->pub.enp_mm.packin_release_ctx,
+                                                        (unsigned char *) data);
+}
+
+
+static void
+set_packet_in_data (lsquic_engine_t *engine, lsquic_packet_in_t *packet_in,
+                                                const unsigned char *data)
+{
+    packet_in->pi_data = (unsigned char *) data;
+    if (engine->pub.enp_mm.packin_release)
+        packet_in->pi_flags |= PI_RELEASE_DATA;
+}
+
+
+static int
+engine_packet_in (lsquic_engine_t *engine,
     const unsigned char *packet_in_data, size_t packet_in_size,
     const struct sockaddr *sa_local, const struct sockaddr *sa_peer,
-    void *peer_ctx)
+    void *peer_ctx, lsquic_time_t now)
 {
     struct packin_parse_state ppstate;
     lsquic_packet_in_t *packet_in;
@@ -1459,6 +1621,7 @@ lsquic_engine_packet_in (lsquic_engine_t *engine,
     {
         LSQ_DEBUG("Cannot handle packet_in_size(%zd) > %d packet incoming "
             "packet's header", packet_in_size, QUIC_MAX_PACKET_SZ);
+        release_packet_in_data(engine, packet_in_data);
         errno = E2BIG;
         return -1;
     }
@@ -1468,7 +1631,10 @@ lsquic_engine_packet_in (lsquic_engine_t *engine,
         const struct lsquic_conn *conn;
         conn = conn_hash_find_by_addr(&engine->conns_hash, sa_local);
         if (!conn)
+        {
+            release_packet_in_data(engine, packet_in_data);
             return -1;
+        }
         if ((1 << conn->cn_version) & LSQUIC_GQUIC_HEADER_VERSIONS)
             parse_packet_in_begin = lsquic_gquic_parse_packet_in_begin;
         else
@@ -1479,13 +1645,17 @@ lsquic_engine_packet_in (lsquic_engine_t *engine,
 
     packet_in = lsquic_mm_get_packet_in(&engine->pub.enp_mm);
     if (!packet_in)
+    {
+        release_packet_in_data(engine, packet_in_data);
         return -1;
+    }
 
-    /* Library does not modify packet_in_data, it is not referenced after
-     * this function returns and subsequent release of pi_data is guarded
-     * by PI_OWN_DATA flag.
+    /* Unless the user gave us the buffer (see ea_packin_release), library
+     * does not modify packet_in_data, it is not referenced after this
+     * function returns and subsequent release of pi_data is guarded by
+     * PI_OWN_DATA flag.
      */
-    packet_in->pi_data = (unsigned char *) packet_in_data;
+    set_packet_in_data(engine, packet_in, packet_in_data);
     if (0 != parse_packet_in_begin(packet_in, packet_in_size,
                                         engine->flags & ENG_SERVER, &ppstate))
     {
@@ -1495,13 +1665,235 @@ lsquic_engine_packet_in (lsquic_engine_t *engine,
         return -1;
     }
 
-    packet_in->pi_received = lsquic_time_now();
-    eng_hist_inc(&engine->history, packet_in->pi_received, sl_packets_in);
+    packet_in->pi_received = now;
+    eng_hist_inc(&engine->history, now, sl_packets_in);
     return process_packet_in(engine, packet_in, &ppstate, sa_local, sa_peer,
                                                                     peer_ctx);
 }
 
 
+int
+lsquic_engine_packet_in (lsquic_engine_t *engine,
+    const unsigned char *packet_in_data, size_t packet_in_size,
+    const struct sockaddr *sa_local, const struct sockaddr *sa_peer,
+    void *peer_ctx)
+{
+    return engine_packet_in(engine, packet_in_data, packet_in_size, sa_local,
+                                    sa_peer, peer_ctx, lsquic_time_now());
+}
+
+
+struct in_batch_elem
+{
+    lsquic_packet_in_t             *packet_in;
+    const struct lsquic_in_spec    *spec;
+    struct packin_parse_state       ppstate;
+};
+
+
+/* Packets from the same connection tend to arrive next to each other and
+ * the batch is small, so insertion sort is cheap.  It is also stable,
+ * which preserves the arrival order of packets within a connection.
+ */
+static void
+sort_in_batch (struct in_batch_elem *elems, unsigned count)
+{
+    struct in_batch_elem tmp;
+    unsigned i, j;
+
+    for (i = 1; i < count; ++i)
+        if (elems[i].packet_in->pi_conn_id
+                                    < elems[i - 1].packet_in->pi_conn_id)
+        {
+            tmp = elems[i];
+            j = i;
+            do
+            {
+                elems[j] = elems[j - 1];
+                --j;
+            }
+            while (j > 0 && tmp.packet_in->pi_conn_id
+                                    < elems[j - 1].packet_in->pi_conn_id);
+            elems[j] = tmp;
+        }
+}
+
+
+/* Parse headers of up to MAX_IN_BATCH_SIZE packets, group them by
+ * connection ID, and pass each group to its connection.  Returns number
+ * of packets processed by real connections.
+ */
+static unsigned
+process_in_batch (lsquic_engine_t *engine, const struct lsquic_in_spec *specs,
+                  unsigned n_specs, lsquic_time_t now)
+{
+    struct in_batch_elem elems[MAX_IN_BATCH_SIZE];
+    const struct lsquic_in_spec *spec;
+    lsquic_packet_in_t *packet_in;
+    lsquic_conn_t *conn;
+    lsquic_cid_t cid;
+    unsigned i, n, n_proc;
+
+    assert(n_specs <= MAX_IN_BATCH_SIZE);
+
+    n = 0;
+    for (spec = specs; spec < specs + n_specs; ++spec)
+    {
+        if (spec->sz > QUIC_MAX_PACKET_SZ)
+        {
+            LSQ_DEBUG("Cannot handle packet_in_size(%zd) > %d packet "
+                "incoming packet's header", spec->sz, QUIC_MAX_PACKET_SZ);
+            release_packet_in_data(engine, spec->buf);
+            continue;
+        }
+        packet_in = lsquic_mm_get_packet_in(&engine->pub.enp_mm);
+        if (!packet_in)
+        {
+            release_packet_in_data(engine, spec->buf);
+            continue;
+        }
+        set_packet_in_data(engine, packet_in, spec->buf);
+        if (0 != lsquic_parse_packet_in_begin(packet_in, spec->sz,
+                            engine->flags & ENG_SERVER, &elems[n].ppstate))
+        {
+            LSQ_DEBUG("Cannot parse incoming packet's header");
+            lsquic_mm_put_packet_in(&engine->pub.enp_mm, packet_in);
+            continue;
+        }
+        if (lsquic_packet_in_is_gquic_prst(packet_in)
+                                && !engine->pub.enp_settings.es_honor_prst)
+        {
+            LSQ_DEBUG("public reset packet: discarding");
+            lsquic_mm_put_packet_in(&engine->pub.enp_mm, packet_in);
+            continue;
+        }
+        if (!(packet_in->pi_flags & PI_CONN_ID))
+        {
+            LSQ_DEBUG("packet header does not have connection ID: "
+                                                            "discarding");
+            lsquic_mm_put_packet_in(&engine->pub.enp_mm, packet_in);
+            continue;
+        }
+        packet_in->pi_received = now;
+        elems[n].packet_in = packet_in;
+        elems[n].spec      = spec;
+        ++n;
+    }
+
+    if (n == 0)
+        return 0;
+
+    eng_hist_add(&engine->history, now, sl_packets_in, n);
+    sort_in_batch(elems, n);
+
+    n_proc = 0;
+    conn = NULL;
+    cid = elems[0].packet_in->pi_conn_id;
+    for (i = 0; i < n; ++i)
+    {
+        packet_in = elems[i].packet_in;
+        if (i == 0 || packet_in->pi_conn_id != cid)
+        {
+            cid = packet_in->pi_conn_id;
+            conn = conn_hash_find_by_cid(&engine->conns_hash, cid);
+        }
+        if (!conn)
+        {
+            lsquic_mm_put_packet_in(&engine->pub.enp_mm, packet_in);
+            continue;
+        }
+        conn->cn_pf->pf_parse_packet_in_finish(packet_in, &elems[i].ppstate);
+        pass_packet_to_conn(engine, conn, packet_in, elems[i].spec->local_sa,
+                            elems[i].spec->peer_sa, elems[i].spec->peer_ctx);
+        ++n_proc;
+    }
+
+    return n_proc;
+}
+
+
+static unsigned
+engine_packets_in (lsquic_engine_t *engine, const struct lsquic_in_spec *specs,
+                   unsigned n_specs, lsquic_time_t now)
+{
+    const struct lsquic_in_spec *spec;
+    unsigned n, n_proc;
+
+    n_proc = 0;
+
+    if (conn_hash_using_addr(&engine->conns_hash))
+    {
+        /* The parser depends on the connection, which is looked up by
+         * local address: there is nothing to group.
+         */
+        for (spec = specs; spec < specs + n_specs; ++spec)
+            n_proc += 0 == engine_packet_in(engine, spec->buf, spec->sz,
+                        spec->local_sa, spec->peer_sa, spec->peer_ctx, now);
+        return n_proc;
+    }
+
+    for (spec = specs; spec < specs + n_specs; spec += n)
+    {
+        n = MIN(MAX_IN_BATCH_SIZE, (unsigned) (specs + n_specs - spec));
+        n_proc += process_in_batch(engine, spec, n, now);
+    }
+
+    return n_proc;
+}
+
+
+int
+lsquic_engine_packets_in (lsquic_engine_t *engine,
+                const struct lsquic_in_spec *specs, unsigned n_specs)
+{
+    return (int) engine_packets_in(engine, specs, n_specs, lsquic_time_now());
+}
+
+
+int
+lsquic_engine_packet_in_gro (lsquic_engine_t *engine,
+    const unsigned char *buf, size_t bufsz, size_t segsz,
+    const struct sockaddr *sa_local, const struct sockaddr *sa_peer,
+    void *peer_ctx)
+{
+    struct lsquic_in_spec specs[MAX_IN_BATCH_SIZE];
+    const unsigned char *const end = buf + bufsz;
+    lsquic_time_t now;
+    unsigned n, n_proc;
+
+    if (segsz == 0)
+    {
+        LSQ_DEBUG("%s: segment size is zero", __func__);
+        release_packet_in_data(engine, buf);
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* Segments reference the user buffer directly: like in the regular
+     * case, packet data is not referenced after this function returns --
+     * unless ea_packin_release is set, in which case each segment is
+     * released separately.
+     */
+    now = lsquic_time_now();
+    n_proc = 0;
+    while (buf < end)
+    {
+        for (n = 0; n < MAX_IN_BATCH_SIZE && buf < end; ++n)
+        {
+            specs[n].buf      = buf;
+            specs[n].sz       = MIN(segsz, (size_t) (end - buf));
+            specs[n].local_sa = sa_local;
+            specs[n].peer_sa  = sa_peer;
+            specs[n].peer_ctx = peer_ctx;
+            buf += specs[n].sz;
+        }
+        n_proc += engine_packets_in(engine, specs, n, now);
+    }
+
+    return (int) n_proc;
+}
+
+
 #if __GNUC__ && !defined(NDEBUG)
 __attribute__((weak))
 #endif
@@ -0,0 +1,154 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_engine_group.c -- Group of engines, one per thread
+ *
+ * Each engine in the group encodes its index into the connection IDs it
+ * generates.  This lets the user steer incoming packets to the right
+ * engine by looking at the connection ID in the packet header.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_in.h"
+#include "lsquic_parse_common.h"
+#include "lsquic_mm.h"
+#include "lsquic_engine_public.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_ENGINE
+#include "lsquic_logger.h"
+
+
+struct lsquic_engine_group
+{
+    unsigned                 eg_n_engines;
+    lsquic_engine_t        **eg_engines;     /* Follows the struct */
+};
+
+
+lsquic_engine_group_t *
+lsquic_engine_group_new (unsigned flags,
+                    const struct lsquic_engine_api *apis, unsigned n_engines)
+{
+    struct lsquic_engine_group *group;
+    struct lsquic_engine_settings settings;
+    struct lsquic_engine_api api;
+    unsigned i;
+
+    if (flags & LSENG_SERVER)
+    {
+        LSQ_ERROR("engine group is only supported in client mode");
+        errno = EINVAL;
+        return NULL;
+    }
+
+    if (n_engines == 0 || n_engines > LSQUIC_MAX_ENGINES_IN_GROUP)
+    {
+        LSQ_ERROR("invalid number of engines in group: %u", n_engines);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    group = calloc(1, sizeof(*group)
+                                + n_engines * sizeof(group->eg_engines[0]));
+    if (!group)
+        return NULL;
+    group->eg_engines = (lsquic_engine_t **) (group + 1);
+
+    for (i = 0; i < n_engines; ++i)
+    {
+        api = apis[i];
+        if (api.ea_settings)
+            settings = *api.ea_settings;
+        else
+            lsquic_engine_init_settings(&settings, flags);
+        /* Steering requires connection ID in every incoming packet */
+        settings.es_support_tcid0 = 0;
+        settings.es_versions &= ~LSQUIC_FORCED_TCID0_VERSIONS;
+        if (!settings.es_versions)
+        {
+            LSQ_ERROR("engine %u: no versions left that support connection "
+                                                            "IDs", i);
+            errno = EINVAL;
+            goto err;
+        }
+        api.ea_settings = &settings;
+        group->eg_engines[i] = lsquic_engine_new(flags, &api);
+        if (!group->eg_engines[i])
+            goto err;
+        lsquic_engine_set_shard(group->eg_engines[i], i);
+    }
+
+    group->eg_n_engines = n_engines;
+    LSQ_INFO("instantiated group of %u engines", n_engines);
+    return group;
+
+  err:
+    while (i-- > 0)
+        lsquic_engine_destroy(group->eg_engines[i]);
+    free(group);
+    return NULL;
+}
+
+
+unsigned
+lsquic_engine_group_count (const lsquic_engine_group_t *group)
+{
+    return group->eg_n_engines;
+}
+
+
+lsquic_engine_t *
+lsquic_engine_group_get (lsquic_engine_group_t *group, unsigned idx)
+{
+    if (idx < group->eg_n_engines)
+        return group->eg_engines[idx];
+    else
+        return NULL;
+}
+
+
+int
+lsquic_engine_group_steer (const lsquic_engine_group_t *group,
+                                    const unsigned char *buf, size_t bufsz)
+{
+    struct lsquic_packet_in packet_in;
+    struct packin_parse_state ppstate;
+    unsigned shard;
+
+    if (bufsz > QUIC_MAX_PACKET_SZ)
+        return -1;
+
+    /* The parser does not modify packet data */
+    memset(&packet_in, 0, sizeof(packet_in));
+    packet_in.pi_data = (unsigned char *) buf;
+    if (0 != lsquic_parse_packet_in_begin(&packet_in, bufsz, 0, &ppstate))
+        return -1;
+
+    if (!(packet_in.pi_flags & PI_CONN_ID))
+        return -1;
+
+    shard = lsquic_cid_get_shard(packet_in.pi_conn_id);
+    if (shard < group->eg_n_engines)
+        return (int) shard;
+    else
+        return -1;
+}
+
+
+void
+lsquic_engine_group_destroy (lsquic_engine_group_t *group)
+{
+    unsigned i;
+
+    for (i = 0; i < group->eg_n_engines; ++i)
+        lsquic_engine_destroy(group->eg_engines[i]);
+    free(group);
+}
@@ -22,15 +22,26 @@ struct lsquic_engine_public {
     const struct lsquic_packout_mem_if
                                    *enp_pmi;
     void                           *enp_pmi_ctx;
+    const struct lsquic_cong_ctl_if
+                                   *enp_cc_if;     /* May be NULL */
+    void                           *enp_cc_ctx;
     struct lsquic_engine           *enp_engine;
     enum {
         ENPUB_PROC  = (1 << 0), /* Being processed by one of the user-facing
                                  * functions.
                                  */
         ENPUB_CAN_SEND = (1 << 1),
+        ENPUB_SHARDED  = (1 << 2), /* Engine is part of engine group */
     }                               enp_flags;
+    unsigned                        enp_shard;  /* Valid if ENPUB_SHARDED */
 };
 
+/* Engine index is stored in the lowest byte of the connection ID */
+#define ENPUB_SHARD_MASK 0xFF
+#define lsquic_cid_get_shard(cid) ((unsigned) ((cid) & ENPUB_SHARD_MASK))
+#define lsquic_cid_set_shard(cid, shard) \
+    (((cid) & ~(lsquic_cid_t) ENPUB_SHARD_MASK) | (lsquic_cid_t) (shard))
+
 /* Put connection onto the Tickable Queue if it is not already on it.  If
  * connection is being destroyed, this is a no-op.
  */
@@ -44,4 +55,10 @@ void
 lsquic_engine_add_conn_to_attq (struct lsquic_engine_public *enpub,
                                             lsquic_conn_t *, lsquic_time_t);
 
+/* Make engine encode `shard' into the connection IDs it generates.  Used
+ * by the engine group.
+ */
+void
+lsquic_engine_set_shard (struct lsquic_engine *, unsigned shard);
+
 #endif
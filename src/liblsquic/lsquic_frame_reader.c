@@ -107,6 +107,7 @@ struct lsquic_frame_reader
     struct lshpack_dec              *fr_hdec;
     struct lsquic_stream            *fr_stream;
     fr_stream_read_f                 fr_read;
+    fr_stream_readf_f                fr_readf;
     const struct frame_reader_callbacks
                                     *fr_callbacks;
     void                            *fr_cb_ctx;
@@ -176,7 +177,7 @@ lsquic_frame_reader_new (enum frame_reader_flags flags,
                     unsigned max_headers_sz,
                     struct lsquic_mm *mm,
                     struct lsquic_stream *stream, fr_stream_read_f read,
-                    struct lshpack_dec *hdec,
+                    fr_stream_readf_f readf, struct lshpack_dec *hdec,
                     const struct frame_reader_callbacks *cb,
                     void *frame_reader_cb_ctx,
 #if LSQUIC_CONN_STATS
@@ -192,6 +193,7 @@ lsquic_frame_reader_new (enum frame_reader_flags flags,
     fr->fr_flags          = flags;
     fr->fr_stream         = stream;
     fr->fr_read           = read;
+    fr->fr_readf          = readf;
     fr->fr_callbacks      = cb;
     fr->fr_cb_ctx         = frame_reader_cb_ctx;
     fr->fr_header_block   = NULL;
@@ -507,8 +509,57 @@ skip_headers_padding (struct lsquic_frame_reader *fr)
 }
 
 
+/* Largest buffer a single header is decoded into.  This is the size of
+ * the buffer used when the header set does not provide its own.
+ */
+#define MAX_DECODE_SPACE (16 * 1024)
+
+
+/* Decode next header into memory provided by the header set.  If the
+ * header does not fit, ask the header set for a larger buffer and decode
+ * again from the same position.  The decoder adds an entry to the dynamic
+ * table only after the header has been decoded.  A dynamic table size
+ * update preceding the header is applied before decoding, so it is applied
+ * again on retry; this is harmless, as setting the same size is idempotent.
+ */
+static enum frame_reader_error
+decode_into_hset (struct lsquic_frame_reader *fr, void *hset,
+        const unsigned char **comp, const unsigned char *end, char **name,
+        unsigned *name_len, unsigned *val_len, uint32_t *name_idx)
+{
+    const unsigned char *const comp_orig = *comp;
+    unsigned min_space, space;
+    char *buf;
+
+    min_space = 0;
+    while (1)
+    {
+        buf = fr->fr_hsi_if->hsi_prepare_decode(hset, min_space, &space);
+        if (!buf)
+            return FR_ERR_NOMEM;
+        assert(space >= min_space);
+        if (space > MAX_DECODE_SPACE)
+            space = MAX_DECODE_SPACE;
+        if (0 == lshpack_dec_decode(fr->fr_hdec, comp, end, buf, buf + space,
+                                                name_len, val_len, name_idx))
+        {
+            *name = buf;
+            return 0;
+        }
+        if (space >= MAX_DECODE_SPACE)
+            return FR_ERR_DECOMPRESS;
+        LSQ_DEBUG("header does not fit into %u bytes, retry", space);
+        *comp = comp_orig;
+        min_space = space < MAX_DECODE_SPACE / 2 ? space * 2 : MAX_DECODE_SPACE;
+        if (min_space < 64)
+            min_space = 64;
+    }
+}
+
+
 static int
-decode_and_pass_payload (struct lsquic_frame_reader *fr)
+decode_and_pass_payload (struct lsquic_frame_reader *fr,
+                    const unsigned char *block, unsigned block_sz)
 {
     struct headers_state *hs = &fr->fr_state.by_type.headers_state;
     const unsigned char *comp, *end;
@@ -516,15 +567,18 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
     int s;
     uint32_t name_idx;
     unsigned name_len, val_len;
-    char *buf;
+    char *buf = NULL, *name;
     struct uncompressed_headers *uh = NULL;
     void *hset = NULL;
 
-    buf = lsquic_mm_get_16k(fr->fr_mm);
-    if (!buf)
+    if (!fr->fr_hsi_if->hsi_prepare_decode)
     {
-        err = FR_ERR_NOMEM;
-        goto stream_error;
+        buf = lsquic_mm_get_16k(fr->fr_mm);
+        if (!buf)
+        {
+            err = FR_ERR_NOMEM;
+            goto stream_error;
+        }
     }
 
     hset = fr->fr_hsi_if->hsi_create_header_set(fr->fr_hsi_ctx,
@@ -535,18 +589,26 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
         goto stream_error;
     }
 
-    comp = fr->fr_header_block;
-    end = comp + fr->fr_header_block_sz;
+    comp = block;
+    end = comp + block_sz;
 
     while (comp < end)
     {
-        s = lshpack_dec_decode(fr->fr_hdec, &comp, end,
-                    buf, buf + 16 * 1024, &name_len, &val_len, &name_idx);
-        if (s == 0)
+        if (buf)
+        {
+            s = lshpack_dec_decode(fr->fr_hdec, &comp, end,
+                buf, buf + MAX_DECODE_SPACE, &name_len, &val_len, &name_idx);
+            err = s == 0 ? 0 : FR_ERR_DECOMPRESS;
+            name = buf;
+        }
+        else
+            err = decode_into_hset(fr, hset, &comp, end, &name, &name_len,
+                                                        &val_len, &name_idx);
+        if (err == 0)
         {
             err = (enum frame_reader_error)
-                fr->fr_hsi_if->hsi_process_header(hset, name_idx, buf,
-                                        name_len, buf + name_len, val_len);
+                fr->fr_hsi_if->hsi_process_header(hset, name_idx, name,
+                                        name_len, name + name_len, val_len);
             if (err == 0)
             {
 #if LSQUIC_CONN_STATS
@@ -555,13 +617,14 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
                 continue;
             }
         }
-        else
-            err = FR_ERR_DECOMPRESS;
         goto stream_error;
     }
     assert(comp == end);
-    lsquic_mm_put_16k(fr->fr_mm, buf);
-    buf = NULL;
+    if (buf)
+    {
+        lsquic_mm_put_16k(fr->fr_mm, buf);
+        buf = NULL;
+    }
 
     err = (enum frame_reader_error)
         fr->fr_hsi_if->hsi_process_header(hset, 0, 0, 0, 0, 0);
@@ -605,7 +668,7 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
     else
         fr->fr_callbacks->frc_on_push_promise(fr->fr_cb_ctx, uh);
 #if LSQUIC_CONN_STATS
-    fr->fr_conn_stats->in.headers_comp += fr->fr_header_block_sz;
+    fr->fr_conn_stats->in.headers_comp += block_sz;
 #endif
 
     return 0;
@@ -623,13 +686,71 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
 }
 
 
+struct in_place_ctx
+{
+    struct lsquic_frame_reader  *fr;
+    unsigned                     block_sz;
+    int                          decoded;
+    int                          rv;
+};
+
+
+static size_t
+decode_in_place (void *ctx, const unsigned char *buf, size_t len, int fin)
+{
+    struct in_place_ctx *const ipc = ctx;
+
+    if (ipc->decoded || len < ipc->block_sz)
+        return 0;
+
+    ipc->decoded = 1;
+    ipc->rv = decode_and_pass_payload(ipc->fr, buf, ipc->block_sz);
+    return ipc->block_sz;
+}
+
+
+/* If the whole header block is contiguous in the stream's incoming data,
+ * decode it from there without copying it into fr_header_block.  Returns
+ * true if the block was decoded.
+ */
+static int
+read_headers_block_in_place (struct lsquic_frame_reader *fr, int *rv)
+{
+    struct headers_state *hs = &fr->fr_state.by_type.headers_state;
+    struct in_place_ctx ipc = {
+        .fr       = fr,
+        .block_sz = fr->fr_state.payload_length - hs->pesw_size
+                                                            - hs->pad_length,
+        .decoded  = 0,
+    };
+
+    (void) fr->fr_readf(fr->fr_stream, decode_in_place, &ipc);
+    if (!ipc.decoded)
+        return 0;
+
+    LSQ_DEBUG("decoded %u-byte header block in place", ipc.block_sz);
+    hs->nread += ipc.block_sz;
+    *rv = ipc.rv;
+    return 1;
+}
+
+
 static int
 read_headers_block_fragment (struct lsquic_frame_reader *fr)
 {
     struct headers_state *hs = &fr->fr_state.by_type.headers_state;
     ssize_t nr;
+    int rv;
     unsigned payload_length = fr->fr_state.payload_length - hs->pesw_size -
                                                                 hs->pad_length;
+    /* Fragmented blocks -- those followed by CONTINUATION frames or those
+     * whose beginning has already been read -- are reassembled.
+     */
+    if (fr->fr_readf && hs->nread == 0
+            && (fr->fr_state.header.hfh_flags & HFHF_END_HEADERS)
+            && read_headers_block_in_place(fr, &rv))
+        return rv;
+
     if (!fr->fr_header_block)
     {
         fr->fr_header_block_sz = payload_length;
@@ -649,7 +770,8 @@ read_headers_block_fragment (struct lsquic_frame_reader *fr)
     if (hs->nread == payload_length &&
                 (fr->fr_state.header.hfh_flags & HFHF_END_HEADERS))
     {
-        int rv = decode_and_pass_payload(fr);
+        rv = decode_and_pass_payload(fr, fr->fr_header_block,
+                                                    fr->fr_header_block_sz);
         free(fr->fr_header_block);
         fr->fr_header_block = NULL;
         return rv;
@@ -789,7 +911,8 @@ read_contin (struct lsquic_frame_reader *fr)
     {
         if (fr->fr_state.header.hfh_flags & HFHF_END_HEADERS)
         {
-            int rv = decode_and_pass_payload(fr);
+            int rv = decode_and_pass_payload(fr, fr->fr_header_block,
+                                                    fr->fr_header_block_sz);
             free(fr->fr_header_block);
             fr->fr_header_block = NULL;
             reset_state(fr);
@@ -77,10 +77,17 @@ struct frame_reader_callbacks
 
 typedef ssize_t (*fr_stream_read_f)(struct lsquic_stream *, void *, size_t);
 
+/* Same signature as lsquic_stream_readf().  Optional: if specified, header
+ * blocks that arrive contiguously in a single frame are decoded in place.
+ */
+typedef ssize_t (*fr_stream_readf_f)(struct lsquic_stream *,
+        size_t (*)(void *, const unsigned char *, size_t, int), void *);
+
 struct lsquic_frame_reader *
 lsquic_frame_reader_new (enum frame_reader_flags, unsigned max_headers_sz,
                          struct lsquic_mm *, struct lsquic_stream *,
-                         fr_stream_read_f, struct lshpack_dec *,
+                         fr_stream_read_f, fr_stream_readf_f,
+                         struct lshpack_dec *,
                          const struct frame_reader_callbacks *, void *fr_cb_ctx,
 #if LSQUIC_CONN_STATS
                          struct conn_stats *conn_stats,
@@ -32,7 +32,9 @@
 #include "lsquic_stream.h"
 #include "lsquic_senhist.h"
 #include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
 #include "lsquic_pacer.h"
 #include "lsquic_send_ctl.h"
 #include "lsquic_set.h"
@@ -67,8 +69,6 @@
 enum { STREAM_IF_STD, STREAM_IF_HSK, STREAM_IF_HDR, N_STREAM_IFS };
 
 #define MAX_ANY_PACKETS_SINCE_LAST_ACK  20
-#define MAX_RETR_PACKETS_SINCE_LAST_ACK 2
-#define ACK_TIMEOUT                     25000
 #define TIME_BETWEEN_PINGS              15000000
 #define IDLE_TIMEOUT                    30000000
 
@@ -588,7 +588,8 @@ new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
     conn->fc_pub.all_streams = lsquic_hash_create();
     if (!conn->fc_pub.all_streams)
         goto cleanup_on_error;
-    lsquic_rechist_init(&conn->fc_rechist, cid);
+    lsquic_rechist_init(&conn->fc_rechist, cid,
+                                    conn->fc_settings->es_max_recv_ranges);
     if (conn->fc_flags & FC_HTTP)
     {
         conn->fc_pub.hs = lsquic_headers_stream_new(
@@ -638,6 +639,9 @@ new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
 }
 
 
+#if !defined(NDEBUG) && __GNUC__
+__attribute__((weak))
+#endif
 struct lsquic_conn *
 full_conn_client_new (struct lsquic_engine_public *enpub,
                       const struct lsquic_stream_if *stream_if,
@@ -660,6 +664,8 @@ full_conn_client_new (struct lsquic_engine_public *enpub,
     }
     esf = select_esf_by_ver(version);
     cid = esf->esf_generate_cid();
+    if (enpub->enp_flags & ENPUB_SHARDED)
+        cid = lsquic_cid_set_shard(cid, enpub->enp_shard);
     conn = new_conn_common(cid, enpub, stream_if, stream_if_ctx, flags,
                                                             max_packet_size);
     if (!conn)
@@ -702,6 +708,9 @@ full_conn_client_new (struct lsquic_engine_public *enpub,
 }
 
 
+#if !defined(NDEBUG) && __GNUC__
+__attribute__((weak))
+#endif
 void
 full_conn_client_call_on_new (struct lsquic_conn *lconn)
 {
@@ -826,6 +835,8 @@ full_conn_ci_destroy (lsquic_conn_t *lconn)
     LSQ_NOTICE("ACKs: in: %lu; processed: %lu; merged to: new %lu, old %lu",
         conn->fc_stats.in.n_acks, conn->fc_stats.in.n_acks_proc,
         conn->fc_stats.in.n_acks_merged[0], conn->fc_stats.in.n_acks_merged[1]);
+    LSQ_NOTICE("ACKs out: %lu; ACK-only packets: %lu",
+        conn->fc_stats.out.acks, conn->fc_stats.out.ack_only_packets);
 #endif
     while ((sitr = STAILQ_FIRST(&conn->fc_stream_ids_to_reset)))
     {
@@ -860,11 +871,32 @@ conn_is_stream_closed (struct full_conn *conn, uint32_t stream_id)
 }
 
 
+/* ACK decimation kicks in once the peer has sent enough packets to be out
+ * of slow start.
+ */
+static int
+ack_decimation_on (const struct full_conn *conn)
+{
+    return conn->fc_settings->es_ack_decimation
+        && lsquic_rechist_largest_packno(&conn->fc_rechist)
+                                            >= ACK_DECIMATION_MIN_PACKNO;
+}
+
+
 static void
 set_ack_timer (struct full_conn *conn, lsquic_time_t now)
 {
-    lsquic_alarmset_set(&conn->fc_alset, AL_ACK, now + ACK_TIMEOUT);
-    LSQ_DEBUG("ACK alarm set to %"PRIu64, now + ACK_TIMEOUT);
+    lsquic_time_t delay, srtt;
+
+    delay = ACK_TIMEOUT;
+    if (ack_decimation_on(conn))
+    {
+        srtt = lsquic_rtt_stats_get_srtt(&conn->fc_pub.rtt_stats);
+        if (srtt && srtt / ACK_DECIMATION_DELAY_DIVISOR < delay)
+            delay = srtt / ACK_DECIMATION_DELAY_DIVISOR;
+    }
+    lsquic_alarmset_set(&conn->fc_alset, AL_ACK, now + delay);
+    LSQ_DEBUG("ACK alarm set to %"PRIu64, now + delay);
 }
 
 
@@ -878,10 +910,21 @@ ack_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now)
 }
 
 
+static unsigned
+ack_freq (const struct full_conn *conn)
+{
+    if (ack_decimation_on(conn)
+                && conn->fc_settings->es_ack_freq < ACK_DECIMATION_FREQ)
+        return ACK_DECIMATION_FREQ;
+    else
+        return conn->fc_settings->es_ack_freq;
+}
+
+
 static void
 try_queueing_ack (struct full_conn *conn, int was_missing, lsquic_time_t now)
 {
-    if (conn->fc_n_slack_akbl >= MAX_RETR_PACKETS_SINCE_LAST_ACK ||
+    if (conn->fc_n_slack_akbl >= ack_freq(conn) ||
         (conn->fc_conn.cn_version < LSQVER_039 /* Since Q039 do not ack ACKs */
             && conn->fc_n_slack_all >= MAX_ANY_PACKETS_SINCE_LAST_ACK) ||
         ((conn->fc_flags & FC_ACK_HAD_MISS) && was_missing)      ||
@@ -969,7 +1012,8 @@ full_conn_ci_write_ack (struct lsquic_conn *lconn,
             (gaf_rechist_first_f)        lsquic_rechist_first,
             (gaf_rechist_next_f)         lsquic_rechist_next,
             (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-            &conn->fc_rechist, now, &has_missing, &packet_out->po_ack2ed);
+            &conn->fc_rechist, now, &has_missing, &packet_out->po_ack2ed,
+            lsquic_rechist_ack_cache(&conn->fc_rechist));
     if (w < 0) {
         ABORT_ERROR("generating ACK frame failed: %d", errno);
         return;
@@ -3153,6 +3197,9 @@ full_conn_ci_packet_sent (lsquic_conn_t *lconn, lsquic_packet_out_t *packet_out)
     if (s != 0)
         ABORT_ERROR("sent packet failed: %s", strerror(errno));
 #if LSQUIC_CONN_STATS
+    if ((packet_out->po_frame_types & (1 << QUIC_FRAME_ACK))
+                && !(packet_out->po_frame_types & QFRAME_ACKABLE_MASK))
+        ++conn->fc_stats.out.ack_only_packets;
     ++conn->fc_stats.out.packets;
     conn->fc_stats.out.bytes += lsquic_packet_out_sent_sz(lconn, packet_out);
 #endif
@@ -3483,6 +3530,9 @@ lsquic_conn_get_ctx (const lsquic_conn_t *lconn)
 }
 
 
+#if !defined(NDEBUG) && __GNUC__
+__attribute__((weak))
+#endif
 void lsquic_conn_set_ctx (lsquic_conn_t *lconn, lsquic_conn_ctx_t *ctx)
 {
     struct full_conn *const conn = (struct full_conn *) lconn;
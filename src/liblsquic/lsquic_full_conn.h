@@ -2,6 +2,12 @@
 #ifndef LSQUIC_FULL_CONN_H
 #define LSQUIC_FULL_CONN_H
 
+#define ACK_TIMEOUT                     25000
+/* ACK decimation parameters are the same as Chromium's */
+#define ACK_DECIMATION_MIN_PACKNO       100
+#define ACK_DECIMATION_FREQ             10
+#define ACK_DECIMATION_DELAY_DIVISOR    4
+
 struct lsquic_conn;
 struct lsquic_stream_if;
 struct lsquic_engine_public;
@@ -189,6 +189,10 @@ static int
 lsquic_handshake_init(int flags)
 {
     crypto_init();
+    /* Build it now rather than lazily, as engines in an engine group may
+     * create connections concurrently.
+     */
+    (void) get_common_certs_hash();
     return init_hs_hash_tables(flags);
 }
 
@@ -1542,7 +1546,8 @@ verify_packet_hash (const lsquic_enc_session_t *enc_session,
         if (max_out_len < *header_len + *out_len)
             return -1;
 
-        memcpy(buf_out, buf, *header_len + *out_len);
+        if (buf_out != buf)
+            memcpy(buf_out, buf, *header_len + *out_len);
         return 0;
     }
     else
@@ -1550,6 +1555,11 @@ verify_packet_hash (const lsquic_enc_session_t *enc_session,
 }
 
 
+/* If `buf_out' is the same as `buf', the packet is decrypted in place.  A
+ * failed attempt leaves the payload in undefined state, so the ciphertext
+ * is saved if the other key may still have to be tried.  Once the peer is
+ * known to use the final key, there is no second attempt.
+ */
 static enum enc_level
 decrypt_packet (lsquic_enc_session_t *enc_session, uint8_t path_id,
                 uint64_t pack_num, unsigned char *buf, size_t *header_len,
@@ -1563,9 +1573,19 @@ decrypt_packet (lsquic_enc_session_t *enc_session, uint8_t path_id,
     EVP_AEAD_CTX *key = NULL;
     int try_times = 0;
     enum enc_level enc_level;
+    const int in_place = buf_out == buf;
+    const int save = in_place && enc_session->have_key == 3
+                        && !enc_session->peer_have_final_key;
+    unsigned char saved[QUIC_MAX_PACKET_SZ];
 
     path_id_packet_number = combine_path_id_pack_num(path_id, pack_num);
-    memcpy(buf_out, buf, *header_len);
+    if (in_place)
+    {
+        if (save)
+            memcpy(saved, buf + *header_len, data_len);
+    }
+    else
+        memcpy(buf_out, buf, *header_len);
     do
     {
         if (enc_session->have_key == 3 && try_times == 0)
@@ -1593,7 +1613,15 @@ decrypt_packet (lsquic_enc_session_t *enc_session, uint8_t path_id,
                            buf_out + *header_len, out_len);
 
         if (ret != 0)
+        {
             ++try_times;
+            if (in_place)
+            {
+                if (!save)
+                    break;
+                memcpy(buf + *header_len, saved, data_len);
+            }
+        }
         else
         {
             if (enc_session->peer_have_final_key == 0 &&
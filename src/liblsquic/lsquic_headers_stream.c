@@ -90,7 +90,8 @@ headers_on_new_stream (void *stream_if_ctx, lsquic_stream_t *stream)
     LSQ_DEBUG("stream created");
     hs->hs_fr = lsquic_frame_reader_new((hs->hs_flags & HS_IS_SERVER) ? FRF_SERVER : 0,
                                 MAX_HEADERS_SIZE, &hs->hs_enpub->enp_mm,
-                                stream, lsquic_stream_read, &hs->hs_hdec,
+                                stream, lsquic_stream_read,
+                                lsquic_stream_readf, &hs->hs_hdec,
                                 frame_callbacks_ptr, hs,
 #if LSQUIC_CONN_STATS
                         hs->hs_conn_stats,
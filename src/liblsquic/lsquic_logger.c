@@ -86,6 +86,8 @@ enum lsq_log_level lsq_log_levels[N_LSQUIC_LOGGER_MODULES] = {
     [LSQLM_MIN_HEAP]    = LSQ_LOG_WARN,
     [LSQLM_HTTP1X]      = LSQ_LOG_WARN,
     [LSQLM_QLOG]        = LSQ_LOG_WARN,
+    [LSQLM_BBR]         = LSQ_LOG_WARN,
+    [LSQLM_BW_SAMPLER]  = LSQ_LOG_WARN,
 };
 
 const char *const lsqlm_to_str[N_LSQUIC_LOGGER_MODULES] = {
@@ -116,6 +118,8 @@ const char *const lsqlm_to_str[N_LSQUIC_LOGGER_MODULES] = {
     [LSQLM_MIN_HEAP]    = "min-heap",
     [LSQLM_HTTP1X]      = "http1x",
     [LSQLM_QLOG]        = "qlog",
+    [LSQLM_BBR]         = "bbr",
+    [LSQLM_BW_SAMPLER]  = "bw-sampler",
 };
 
 const char *const lsq_loglevel2str[N_LSQUIC_LOG_LEVELS] = {
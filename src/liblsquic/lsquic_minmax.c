@@ -0,0 +1,108 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_minmax.c -- Windowed min/max filter
+ *
+ * Three samples are kept: the best, second best, and third best in
+ * non-overlapping subwindows of the window.  When the best sample ages
+ * out, the next best one takes its place.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lsquic_minmax.h"
+
+
+void
+lsquic_minmax_reset (struct minmax *mm, uint64_t time, uint64_t value)
+{
+    mm->samples[0].time  = time;
+    mm->samples[0].value = value;
+    mm->samples[2] = mm->samples[1] = mm->samples[0];
+}
+
+
+/* As time goes by, shift samples forward */
+static void
+minmax_subwin_update (struct minmax *mm, const struct minmax_sample *sample)
+{
+    uint64_t dt;
+
+    dt = sample->time - mm->samples[0].time;
+    if (dt > mm->window)
+    {
+        /* The best sample has expired: promote the second and third best
+         * ones.  The new sample may need to replace the third one if it
+         * has expired as well.
+         */
+        mm->samples[0] = mm->samples[1];
+        mm->samples[1] = mm->samples[2];
+        mm->samples[2] = *sample;
+        if (sample->time - mm->samples[0].time > mm->window)
+        {
+            mm->samples[0] = mm->samples[1];
+            mm->samples[1] = mm->samples[2];
+            mm->samples[2] = *sample;
+        }
+    }
+    else if (mm->samples[1].time == mm->samples[0].time
+                                                && dt > mm->window / 4)
+    {
+        /* A quarter of the window has passed without a better sample:
+         * take a second choice from the second quarter.
+         */
+        mm->samples[2] = mm->samples[1] = *sample;
+    }
+    else if (mm->samples[2].time == mm->samples[1].time
+                                                && dt > mm->window / 2)
+    {
+        /* Half of the window has passed without a better sample:
+         * take a third choice from the last half.
+         */
+        mm->samples[2] = *sample;
+    }
+}
+
+
+void
+lsquic_minmax_upmax (struct minmax *mm, uint64_t time, uint64_t value)
+{
+    const struct minmax_sample sample = { .time = time, .value = value, };
+
+    if (mm->samples[0].value == 0           /* Uninitialized */
+        || sample.value >= mm->samples[0].value
+        || sample.time - mm->samples[2].time > mm->window)
+    {
+        lsquic_minmax_reset(mm, time, value);
+        return;
+    }
+
+    if (sample.value >= mm->samples[1].value)
+        mm->samples[2] = mm->samples[1] = sample;
+    else if (sample.value >= mm->samples[2].value)
+        mm->samples[2] = sample;
+
+    minmax_subwin_update(mm, &sample);
+}
+
+
+void
+lsquic_minmax_upmin (struct minmax *mm, uint64_t time, uint64_t value)
+{
+    const struct minmax_sample sample = { .time = time, .value = value, };
+
+    if (mm->samples[0].value == 0           /* Uninitialized */
+        || sample.value <= mm->samples[0].value
+        || sample.time - mm->samples[2].time > mm->window)
+    {
+        lsquic_minmax_reset(mm, time, value);
+        return;
+    }
+
+    if (sample.value <= mm->samples[1].value)
+        mm->samples[2] = mm->samples[1] = sample;
+    else if (sample.value <= mm->samples[2].value)
+        mm->samples[2] = sample;
+
+    minmax_subwin_update(mm, &sample);
+}
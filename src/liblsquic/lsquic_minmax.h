@@ -0,0 +1,42 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_minmax.h -- Windowed min/max filter
+ *
+ * This is Kathleen Nichols' algorithm for tracking the minimum (or maximum)
+ * value of a data stream over some fixed time interval.  It uses constant
+ * space and constant time per update.  Time is whatever unit the caller
+ * chooses: microseconds, round trips, and so on.
+ */
+
+#ifndef LSQUIC_MINMAX_H
+#define LSQUIC_MINMAX_H 1
+
+struct minmax_sample
+{
+    uint64_t    time;
+    uint64_t    value;
+};
+
+struct minmax
+{
+    uint64_t                window;
+    struct minmax_sample    samples[3];
+};
+
+#define minmax_init(mm_, window_) do {                                  \
+    memset((mm_), 0, sizeof(*(mm_)));                                   \
+    (mm_)->window = (window_);                                          \
+} while (0)
+
+#define minmax_get(mm_) (+(mm_)->samples[0].value)
+
+void
+lsquic_minmax_reset (struct minmax *, uint64_t time, uint64_t value);
+
+void
+lsquic_minmax_upmax (struct minmax *, uint64_t time, uint64_t value);
+
+void
+lsquic_minmax_upmin (struct minmax *, uint64_t time, uint64_t value);
+
+#endif
@@ -64,6 +64,8 @@ lsquic_mm_init (struct lsquic_mm *mm)
     SLIST_INIT(&mm->payload_bufs);
     SLIST_INIT(&mm->four_k_pages);
     SLIST_INIT(&mm->sixteen_k_pages);
+    mm->packin_release = NULL;
+    mm->packin_release_ctx = NULL;
     if (mm->acki && mm->malo.stream_frame && mm->malo.stream_rec_arr &&
                               mm->malo.packet_in)
     {
@@ -286,6 +288,8 @@ lsquic_mm_put_packet_in (struct lsquic_mm *mm,
     assert(0 == packet_in->pi_refcnt);
     if (packet_in->pi_flags & PI_OWN_DATA)
         lsquic_mm_put_1370(mm, packet_in->pi_data);
+    else if (packet_in->pi_flags & PI_RELEASE_DATA)
+        mm->packin_release(mm->packin_release_ctx, packet_in->pi_data);
     TAILQ_INSERT_HEAD(&mm->free_packets_in, packet_in, pi_next);
 }
 
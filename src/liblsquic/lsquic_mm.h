@@ -30,6 +30,9 @@ struct lsquic_mm {
     SLIST_HEAD(, payload_buf)       payload_bufs;
     SLIST_HEAD(, four_k_page)       four_k_pages;
     SLIST_HEAD(, sixteen_k_page)    sixteen_k_pages;
+    /* Optional: release incoming packet data marked with PI_RELEASE_DATA */
+    void               (*packin_release)(void *ctx, void *buf);
+    void                *packin_release_ctx;
 };
 
 int
@@ -24,12 +24,14 @@
 
 
 void
-pacer_init (struct pacer *pacer, lsquic_cid_t cid, unsigned clock_granularity)
+pacer_init (struct pacer *pacer, lsquic_cid_t cid, unsigned clock_granularity,
+                                                            unsigned horizon)
 {
     memset(pacer, 0, sizeof(*pacer));
     pacer->pa_burst_tokens = 10;
     pacer->pa_cid = cid;
     pacer->pa_clock_granularity = clock_granularity;
+    pacer->pa_horizon = horizon;
 }
 
 
@@ -42,11 +44,11 @@ pacer_cleanup (struct pacer *pacer)
 }
 
 
-void
+lsquic_time_t
 pacer_packet_scheduled (struct pacer *pacer, unsigned n_in_flight,
                             int in_recovery, tx_time_f tx_time, void *tx_ctx)
 {
-    lsquic_time_t delay, sched_time;
+    lsquic_time_t delay, sched_time, departure;
     int app_limited, making_up;
 
 #ifndef NDEBUG
@@ -66,10 +68,12 @@ pacer_packet_scheduled (struct pacer *pacer, unsigned n_in_flight,
         pacer->pa_next_sched = 0;
         pacer->pa_last_delayed = 0;
         LSQ_DEBUG("%s: tokens: %u", __func__, pacer->pa_burst_tokens);
-        return;
+        return 0;
     }
 
     sched_time = pacer->pa_now;
+    /* The packet leaves at its slot, unless we are late */
+    departure = pacer->pa_next_sched > sched_time ? pacer->pa_next_sched : 0;
     delay = tx_time(tx_ctx);
     if (pacer->pa_flags & PA_LAST_SCHED_DELAYED)
     {
@@ -91,6 +95,7 @@ pacer_packet_scheduled (struct pacer *pacer, unsigned n_in_flight,
                                                     sched_time + delay);
     LSQ_DEBUG("next_sched is set to %"PRIu64" usec from now",
                                 pacer->pa_next_sched - lsquic_time_now());
+    return departure;
 }
 
 
@@ -109,7 +114,8 @@ pacer_can_schedule (struct pacer *pacer, unsigned n_in_flight)
 
     if (pacer->pa_burst_tokens > 0 || n_in_flight == 0)
         can = 1;
-    else if (pacer->pa_next_sched > pacer->pa_now + pacer->pa_clock_granularity)
+    else if (pacer->pa_next_sched > pacer->pa_now
+                        + MAX(pacer->pa_clock_granularity, pacer->pa_horizon))
     {
         pacer->pa_flags |= PA_LAST_SCHED_DELAYED;
         can = 0;
@@ -12,6 +12,11 @@ struct pacer
     /* All tick times are in microseconds */
 
     unsigned        pa_clock_granularity;
+    /* If non-zero, packets may be scheduled this far ahead of their
+     * departure time.  The departure time is then passed to the kernel,
+     * which does the pacing.
+     */
+    unsigned        pa_horizon;
 
     unsigned        pa_burst_tokens;
     enum {
@@ -28,7 +33,8 @@ struct pacer
 typedef lsquic_time_t (*tx_time_f)(void *ctx);
 
 void
-pacer_init (struct pacer *, lsquic_cid_t, unsigned clock_granularity);
+pacer_init (struct pacer *, lsquic_cid_t, unsigned clock_granularity,
+                                                            unsigned horizon);
 
 void
 pacer_cleanup (struct pacer *);
@@ -39,7 +45,10 @@ pacer_tick (struct pacer *, lsquic_time_t);
 int
 pacer_can_schedule (struct pacer *, unsigned n_in_flight);
 
-void
+/* Returns departure time of the scheduled packet if it is in the future
+ * or zero if the packet can be sent right away.
+ */
+lsquic_time_t
 pacer_packet_scheduled (struct pacer *pacer, unsigned n_in_flight,
                         int in_recovery, tx_time_f tx_time, void *tx_ctx);
 
@@ -48,6 +57,7 @@ pacer_loss_event (struct pacer *);
 
 #define pacer_delayed(pacer) ((pacer)->pa_flags & PA_LAST_SCHED_DELAYED)
 
-#define pacer_next_sched(pacer) (+(pacer)->pa_next_sched)
+/* Time when the next packet can be scheduled */
+#define pacer_next_sched(pacer) ((pacer)->pa_next_sched - (pacer)->pa_horizon)
 
 #endif
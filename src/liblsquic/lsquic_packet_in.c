@@ -47,7 +47,7 @@ lsquic_packet_in_mem_used (const struct lsquic_packet_in *packet_in)
 
     size = sizeof(*packet_in);
 
-    if (packet_in->pi_flags & PI_OWN_DATA)
+    if (packet_in->pi_flags & (PI_OWN_DATA|PI_RELEASE_DATA))
         size += packet_in->pi_data_sz;
 
     return size;
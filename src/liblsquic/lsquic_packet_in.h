@@ -57,6 +57,8 @@ typedef struct lsquic_packet_in
         PI_DECRYPTED    = (1 << 0),
         PI_OWN_DATA     = (1 << 1),                /* We own pi_data */
         PI_CONN_ID      = (1 << 2),                /* pi_conn_id is set */
+        PI_RELEASE_DATA = (1 << 3),                /* Release pi_data via
+                                                    * user callback */
 #define PIBIT_ENC_LEV_SHIFT 5
         PI_ENC_LEV_BIT_0= (1 << 5),                /* Encodes encryption level */
         PI_ENC_LEV_BIT_1= (1 << 6),                /*  (see enum enc_level). */
@@ -67,7 +69,10 @@ typedef struct lsquic_packet_in
     }                               pi_flags:16;
     enum header_type                pi_header_type:8;
     /* If PI_OWN_DATA flag is not set, `pi_data' points to user-supplied
-     * packet data, which is NOT TO BE MODIFIED.
+     * packet data, which is NOT TO BE MODIFIED -- unless PI_RELEASE_DATA
+     * is set.  In that case, the library owns the buffer: the packet is
+     * decrypted in place and the buffer is released using the callback
+     * stored in struct lsquic_mm when the packet is put.
      */
     unsigned char                  *pi_data;
 } lsquic_packet_in_t;
@@ -93,6 +93,9 @@ typedef struct lsquic_packet_out
                                          *   otherwise unset.
                                          */
         PO_LIMITED  = (1 <<21),         /* Used to credit sc_next_limit if needed. */
+        PO_TXTIME   = (1 <<22),         /* Until the packet is sent, po_sent is
+                                         *   departure time set by the pacer.
+                                         */
     }                  po_flags;
     enum quic_ft_bit   po_frame_types:16; /* Bitmask of QUIC_FRAME_* */
     unsigned short     po_data_sz;      /* Number of usable bytes in data */
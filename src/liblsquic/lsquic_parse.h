@@ -10,6 +10,7 @@ struct lsquic_packet_in;
 struct lsquic_packet_out;
 struct packin_parse_state;
 struct stream_frame;
+struct ack_gen_cache;
 enum packet_out_flags;
 
 #define LSQUIC_PARSE_ACK_TIMESTAMPS 0
@@ -93,7 +94,8 @@ struct parse_funcs
     (*pf_gen_ack_frame) (unsigned char *outbuf, size_t outbuf_sz,
                 gaf_rechist_first_f, gaf_rechist_next_f,
                 gaf_rechist_largest_recv_f, void *rechist, lsquic_time_t now,
-                int *has_missing, lsquic_packno_t *largest_received);
+                int *has_missing, lsquic_packno_t *largest_received,
+                struct ack_gen_cache *);
     int
     (*pf_gen_stop_waiting_frame) (unsigned char *buf, size_t buf_len,
                     lsquic_packno_t cur_packno, enum packno_bits,
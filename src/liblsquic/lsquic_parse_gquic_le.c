@@ -673,7 +673,7 @@ gquic_le_gen_ack_frame (unsigned char *outbuf, size_t outbuf_sz,
         gaf_rechist_first_f rechist_first, gaf_rechist_next_f rechist_next,
         gaf_rechist_largest_recv_f rechist_largest_recv,
         void *rechist, lsquic_time_t now, int *has_missing,
-        lsquic_packno_t *largest_received)
+        lsquic_packno_t *largest_received, struct ack_gen_cache *cache)
 {
     lsquic_time_t time_diff;
     const struct lsquic_packno_range *const first = rechist_first(rechist);
@@ -718,16 +718,33 @@ gquic_le_gen_ack_frame (unsigned char *outbuf, size_t outbuf_sz,
     *type |= bits << 2;
 
     /* Calculate largest ACK block length and set `mm' bits: */
-    unsigned n_ranges = 0;
-    lsquic_packno_t maxdiff = 0;
+    unsigned n_ranges;
+    lsquic_packno_t maxdiff, tail_maxdiff;
     const struct lsquic_packno_range *range;
-    for (range = rechist_first(rechist); range; range = rechist_next(rechist))
+    if (cache && cache->agc_valid)
     {
-        ++n_ranges;
-        const lsquic_packno_t diff = range->high - range->low + 1;
-        if (diff > maxdiff)
-            maxdiff = diff;
+        /* Ranges after the first one have not changed since the blocks
+         * were cached -- and there is at least one such range.
+         */
+        n_ranges = 2;
+        tail_maxdiff = cache->agc_maxdiff;
     }
+    else
+    {
+        n_ranges = 1;
+        tail_maxdiff = 0;
+        for (range = rechist_next(rechist); range;
+                                            range = rechist_next(rechist))
+        {
+            ++n_ranges;
+            const lsquic_packno_t diff = range->high - range->low + 1;
+            if (diff > tail_maxdiff)
+                tail_maxdiff = diff;
+        }
+    }
+    maxdiff = first_high - first_low + 1;
+    if (tail_maxdiff > maxdiff)
+        maxdiff = tail_maxdiff;
     bits = (maxdiff >= (1ULL <<  8))
          + (maxdiff >= (1ULL << 16))
          + (maxdiff >= (1ULL << 32));
@@ -755,41 +772,68 @@ gquic_le_gen_ack_frame (unsigned char *outbuf, size_t outbuf_sz,
         lsquic_packno_t diff = maxno - first_low + 1;
         memcpy(p + 1, &diff, ack_block_len);
         p += ack_block_len + 1;
-        /* Write out ack blocks until one of the following occurs:
-         *  1. We run out of intervals.
-         *  2. We run out of room.
-         *  3. We run out of highest possible number of ACK blocks (0xFF).
-         */
-        range = rechist_first(rechist);
-        lsquic_packno_t gap = 0;
-        n_ranges = 0;
-        do {
-            if (0 == gap)
-            {
-                const lsquic_packno_t prev_low = range->low;
-                range = rechist_next(rechist);
-                if (!range)
-                    break;
-                gap = prev_low - range->high - 1;
-            }
-            if (gap >= 0x100)
-            {
-                *p = 0xFF;
-                gap -= 0xFF;
-                memset(p + 1, 0, ack_block_len);
-            }
-            else
+        if (cache && cache->agc_valid
+                && cache->agc_block_len == ack_block_len
+                && AVAIL() >= (intptr_t) cache->agc_sz + 1 /* timestamp byte */)
+        {
+            memcpy(p, cache->agc_buf, cache->agc_sz);
+            p += cache->agc_sz;
+            *n_ranges_p = cache->agc_n_blocks;
+        }
+        else
+        {
+            unsigned char *const blocks = p;
+            /* Write out ack blocks until one of the following occurs:
+             *  1. We run out of intervals.
+             *  2. We run out of room.
+             *  3. We run out of highest possible number of ACK blocks (0xFF).
+             */
+            range = rechist_first(rechist);
+            lsquic_packno_t gap = 0;
+            int complete = 0;
+            n_ranges = 0;
+            do {
+                if (0 == gap)
+                {
+                    const lsquic_packno_t prev_low = range->low;
+                    range = rechist_next(rechist);
+                    if (!range)
+                    {
+                        complete = 1;
+                        break;
+                    }
+                    gap = prev_low - range->high - 1;
+                }
+                if (gap >= 0x100)
+                {
+                    *p = 0xFF;
+                    gap -= 0xFF;
+                    memset(p + 1, 0, ack_block_len);
+                }
+                else
+                {
+                    *p = gap;
+                    gap = 0;
+                    diff = range->high - range->low + 1;
+                    memcpy(p + 1, &diff, ack_block_len);
+                }
+                p += ack_block_len + 1;
+                ++n_ranges;
+            } while (n_ranges < 0xFF && AVAIL() >=
+                        (intptr_t) ack_block_len + 1 + 1 /* timestamp byte */);
+            *n_ranges_p = n_ranges;
+            /* Blocks are only cached if they do not depend on the size
+             * of the output buffer.
+             */
+            if (cache)
             {
-                *p = gap;
-                gap = 0;
-                diff = range->high - range->low + 1;
-                memcpy(p + 1, &diff, ack_block_len);
+                if (complete || n_ranges == 0xFF)
+                    (void) lsquic_ack_gen_cache_save(cache, blocks,
+                        p - blocks, n_ranges, ack_block_len, tail_maxdiff);
+                else
+                    cache->agc_valid = 0;
             }
-            p += ack_block_len + 1;
-            ++n_ranges;
-        } while (n_ranges < 0xFF &&
-                 AVAIL() >= (intptr_t) ack_block_len + 1 + 1 /* timestamp byte */);
-        *n_ranges_p = n_ranges;
+        }
     }
     else
     {
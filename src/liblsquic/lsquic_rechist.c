@@ -6,6 +6,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 #ifdef MSVC
@@ -20,14 +21,17 @@
 #define LSQUIC_LOG_CONN_ID rechist->rh_cid
 #include "lsquic_logger.h"
 
+#define LSQUIC_RECHIST_SANITY_CHECK 0
+
 
 void
-lsquic_rechist_init (struct lsquic_rechist *rechist, lsquic_cid_t cid)
+lsquic_rechist_init (struct lsquic_rechist *rechist, lsquic_cid_t cid,
+                                                        unsigned max_ranges)
 {
     memset(rechist, 0, sizeof(*rechist));
     rechist->rh_cid = cid;
     rechist->rh_cutoff = 1;
-    lsquic_packints_init(&rechist->rh_pints);
+    rechist->rh_max_ranges = max_ranges ? max_ranges : UINT_MAX;
     LSQ_DEBUG("instantiated received packet history");
 }
 
@@ -35,19 +39,101 @@ lsquic_rechist_init (struct lsquic_rechist *rechist, lsquic_cid_t cid)
 void
 lsquic_rechist_cleanup (lsquic_rechist_t *rechist)
 {
-    lsquic_packints_cleanup(&rechist->rh_pints);
+    free(rechist->rh_elems);
+    free(rechist->rh_ack_cache.agc_buf);
     memset(rechist, 0, sizeof(*rechist));
 }
 
 
+#if LSQUIC_RECHIST_SANITY_CHECK
+static void
+rechist_sanity_check (const struct lsquic_rechist *rechist)
+{
+    unsigned i;
+
+    assert(rechist->rh_n_elems <= rechist->rh_n_alloced);
+    assert(rechist->rh_n_elems <= rechist->rh_max_ranges);
+    for (i = 0; i < rechist->rh_n_elems; ++i)
+    {
+        assert(rechist->rh_elems[i].low <= rechist->rh_elems[i].high);
+        if (i > 0)
+            assert(rechist->rh_elems[i - 1].high + 1
+                                            < rechist->rh_elems[i].low);
+    }
+}
+#else
+#   define rechist_sanity_check(rechist)
+#endif
+
+
+/* Insert new range consisting of a single packet number at position `idx'.
+ * If the array is full, the lowest range is dropped to make room.
+ */
+static enum received_st
+rechist_insert (struct lsquic_rechist *rechist, unsigned idx,
+                                                    lsquic_packno_t packno)
+{
+    struct lsquic_packno_range *elems;
+    unsigned n_alloced;
+
+    if (rechist->rh_n_elems >= rechist->rh_n_alloced)
+    {
+        if (rechist->rh_n_alloced < rechist->rh_max_ranges)
+        {
+            if (rechist->rh_n_alloced)
+                n_alloced = rechist->rh_n_alloced * 2;
+            else
+                n_alloced = 4;
+            if (n_alloced > rechist->rh_max_ranges)
+                n_alloced = rechist->rh_max_ranges;
+            elems = realloc(rechist->rh_elems,
+                                        sizeof(elems[0]) * n_alloced);
+            if (!elems)
+            {
+                LSQ_WARN("cannot allocate %u ranges: %s", n_alloced,
+                                                            strerror(errno));
+                return REC_ST_ERR;
+            }
+            rechist->rh_elems = elems;
+            rechist->rh_n_alloced = n_alloced;
+        }
+        else if (idx == 0)
+        {
+            LSQ_DEBUG("history is full and packet %"PRIu64" is older than "
+                "all tracked packets: treat as duplicate", packno);
+            return REC_ST_DUP;
+        }
+        else
+        {
+            LSQ_DEBUG("history is full: drop range [%"PRIu64", %"PRIu64"]",
+                rechist->rh_elems[0].low, rechist->rh_elems[0].high);
+            rechist->rh_max_dropped = rechist->rh_elems[0].high;
+            --rechist->rh_n_elems;
+            --idx;
+            memmove(rechist->rh_elems, rechist->rh_elems + 1,
+                            sizeof(rechist->rh_elems[0]) * rechist->rh_n_elems);
+        }
+    }
+
+    memmove(rechist->rh_elems + idx + 1, rechist->rh_elems + idx,
+            sizeof(rechist->rh_elems[0]) * (rechist->rh_n_elems - idx));
+    rechist->rh_elems[idx].low = packno;
+    rechist->rh_elems[idx].high = packno;
+    ++rechist->rh_n_elems;
+    return REC_ST_OK;
+}
+
+
 enum received_st
 lsquic_rechist_received (lsquic_rechist_t *rechist, lsquic_packno_t packno,
                          lsquic_time_t now)
 {
-    const struct lsquic_packno_range *first_range;
+    struct lsquic_packno_range *const elems = rechist->rh_elems;
+    enum received_st st;
+    unsigned i;
 
     LSQ_DEBUG("received %"PRIu64, packno);
-    if (packno < rechist->rh_cutoff)
+    if (packno < rechist->rh_cutoff || packno <= rechist->rh_max_dropped)
     {
         if (packno)
             return REC_ST_DUP;
@@ -55,28 +141,67 @@ lsquic_rechist_received (lsquic_rechist_t *rechist, lsquic_packno_t packno,
             return REC_ST_ERR;
     }
 
-    first_range = lsquic_packints_first(&rechist->rh_pints);
-    if (!first_range || packno > first_range->high)
+    if (rechist->rh_n_elems == 0
+                || packno > elems[rechist->rh_n_elems - 1].high)
+    {
         rechist->rh_largest_acked_received = now;
+        if (rechist->rh_n_elems
+                    && packno == elems[rechist->rh_n_elems - 1].high + 1)
+        {
+            /* Cached ACK blocks are still good */
+            ++elems[rechist->rh_n_elems - 1].high;
+            return REC_ST_OK;
+        }
+        rechist->rh_ack_cache.agc_valid = 0;
+        st = rechist_insert(rechist, rechist->rh_n_elems, packno);
+        rechist_sanity_check(rechist);
+        return st;
+    }
 
-    switch (lsquic_packints_add(&rechist->rh_pints, packno))
-    {
-    case PACKINTS_OK:
-        ++rechist->rh_n_packets;
-        return REC_ST_OK;
-    case PACKINTS_DUP:
+    /* Find the range that starts at or below `packno'.  Packets usually
+     * arrive close to the top, so search from there.
+     */
+    for (i = rechist->rh_n_elems; i > 0 && elems[i - 1].low > packno; --i)
+        ;
+
+    /* `packno' is now between ranges i - 1 and i, if they exist */
+    if (i > 0 && packno <= elems[i - 1].high)
         return REC_ST_DUP;
-    default:
-        assert(0);
-    case PACKINTS_ERR:
-        return REC_ST_ERR;
+
+    rechist->rh_ack_cache.agc_valid = 0;
+
+    if (i > 0 && elems[i - 1].high + 1 == packno)
+    {
+        if (elems[i].low - 1 == packno)
+        {
+            /* Packet closes the gap: merge two ranges */
+            elems[i - 1].high = elems[i].high;
+            --rechist->rh_n_elems;
+            memmove(elems + i, elems + i + 1,
+                                sizeof(elems[0]) * (rechist->rh_n_elems - i));
+        }
+        else
+            ++elems[i - 1].high;
+        st = REC_ST_OK;
+    }
+    else if (elems[i].low - 1 == packno)
+    {
+        --elems[i].low;
+        st = REC_ST_OK;
     }
+    else
+        st = rechist_insert(rechist, i, packno);
+
+    rechist_sanity_check(rechist);
+    return st;
 }
 
 
 void
 lsquic_rechist_stop_wait (lsquic_rechist_t *rechist, lsquic_packno_t cutoff)
 {
+    unsigned i;
+
     LSQ_INFO("stop wait: %"PRIu64, cutoff);
 
     if (rechist->rh_flags & RH_CUTOFF_SET)
@@ -88,36 +213,28 @@ lsquic_rechist_stop_wait (lsquic_rechist_t *rechist, lsquic_packno_t cutoff)
 
     rechist->rh_cutoff = cutoff;
     rechist->rh_flags |= RH_CUTOFF_SET;
-    struct packet_interval *pi, *next;
-    for (pi = TAILQ_FIRST(&rechist->rh_pints.pk_intervals); pi; pi = next)
+    rechist->rh_ack_cache.agc_valid = 0;
+
+    for (i = 0; i < rechist->rh_n_elems
+                                && rechist->rh_elems[i].high < cutoff; ++i)
+        ;
+    if (i > 0)
     {
-        next = TAILQ_NEXT(pi, next_pi);
-        if (pi->range.low < cutoff)
-        {
-            if (pi->range.high < cutoff)
-            {
-                rechist->rh_n_packets -= (unsigned)(pi->range.high - pi->range.low + 1);
-                TAILQ_REMOVE(&rechist->rh_pints.pk_intervals, pi, next_pi);
-                free(pi);
-            }
-            else
-            {
-                rechist->rh_n_packets -= (unsigned)(cutoff - pi->range.low);
-                pi->range.low = cutoff;
-            }
-        }
+        rechist->rh_n_elems -= i;
+        memmove(rechist->rh_elems, rechist->rh_elems + i,
+                            sizeof(rechist->rh_elems[0]) * rechist->rh_n_elems);
     }
-    lsquic_packints_sanity_check(&rechist->rh_pints);
+    if (rechist->rh_n_elems && rechist->rh_elems[0].low < cutoff)
+        rechist->rh_elems[0].low = cutoff;
+    rechist_sanity_check(rechist);
 }
 
 
 lsquic_packno_t
 lsquic_rechist_largest_packno (const lsquic_rechist_t *rechist)
 {
-    const struct packet_interval *pi =
-                                TAILQ_FIRST(&rechist->rh_pints.pk_intervals);
-    if (pi)
-        return pi->range.high;
+    if (rechist->rh_n_elems)
+        return rechist->rh_elems[rechist->rh_n_elems - 1].high;
     else
         return 0;   /* Don't call this function if history is empty */
 }
@@ -143,14 +260,18 @@ lsquic_rechist_largest_recv (const lsquic_rechist_t *rechist)
 const struct lsquic_packno_range *
 lsquic_rechist_first (lsquic_rechist_t *rechist)
 {
-    return lsquic_packints_first(&rechist->rh_pints);
+    rechist->rh_iter = rechist->rh_n_elems;
+    return lsquic_rechist_next(rechist);
 }
 
 
 const struct lsquic_packno_range *
 lsquic_rechist_next (lsquic_rechist_t *rechist)
 {
-    return lsquic_packints_next(&rechist->rh_pints);
+    if (rechist->rh_iter > 0)
+        return &rechist->rh_elems[ --rechist->rh_iter ];
+    else
+        return NULL;
 }
 
 
@@ -158,6 +279,34 @@ size_t
 lsquic_rechist_mem_used (const struct lsquic_rechist *rechist)
 {
     return sizeof(*rechist)
-         - sizeof(rechist->rh_pints)
-         + lsquic_packints_mem_used(&rechist->rh_pints);
+         + sizeof(rechist->rh_elems[0]) * rechist->rh_n_alloced
+         + rechist->rh_ack_cache.agc_alloced;
+}
+
+
+int
+lsquic_ack_gen_cache_save (struct ack_gen_cache *cache,
+        const unsigned char *buf, unsigned sz, unsigned n_blocks,
+        unsigned block_len, lsquic_packno_t maxdiff)
+{
+    unsigned char *new_buf;
+
+    if (sz > cache->agc_alloced)
+    {
+        new_buf = realloc(cache->agc_buf, sz);
+        if (!new_buf)
+        {
+            cache->agc_valid = 0;
+            return -1;
+        }
+        cache->agc_buf = new_buf;
+        cache->agc_alloced = sz;
+    }
+    memcpy(cache->agc_buf, buf, sz);
+    cache->agc_sz = sz;
+    cache->agc_n_blocks = n_blocks;
+    cache->agc_block_len = block_len;
+    cache->agc_maxdiff = maxdiff;
+    cache->agc_valid = 1;
+    return 0;
 }
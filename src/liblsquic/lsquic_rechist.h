@@ -8,17 +8,44 @@
 #ifndef LSQUIC_RECHIST_H
 #define LSQUIC_RECHIST_H 1
 
-#include "lsquic_packints.h"
+/* Encoded ACK blocks that follow the first (highest) range, kept between
+ * calls to pf_gen_ack_frame().  They remain valid for as long as the only
+ * change to the history is the highest range growing upwards, which is
+ * what happens when packets arrive in order.  Then only the largest acked
+ * packet number, the delta time, and the first block need to be encoded.
+ */
+struct ack_gen_cache
+{
+    unsigned char                  *agc_buf;
+    unsigned                        agc_sz;         /* Bytes in agc_buf */
+    unsigned                        agc_alloced;
+    unsigned                        agc_n_blocks;
+    unsigned                        agc_block_len;  /* Length of each block */
+    lsquic_packno_t                 agc_maxdiff;    /* Longest range but first */
+    int                             agc_valid;
+};
 
 struct lsquic_rechist {
-    struct packints                 rh_pints;
+    /* Ranges of received packet numbers are kept in a contiguous array
+     * ordered from low to high, so that the common case -- a packet that
+     * extends the highest range -- touches only the last element.  The
+     * array grows as needed up to rh_max_ranges elements.  When it is
+     * full, the lowest range is dropped to make room.
+     */
+    struct lsquic_packno_range     *rh_elems;
+    unsigned                        rh_n_elems;
+    unsigned                        rh_n_alloced;
+    unsigned                        rh_max_ranges;
+    unsigned                        rh_iter;        /* Used by first/next */
     lsquic_packno_t                 rh_cutoff;
+    /* Packets in ranges dropped to make room are not tracked anymore.
+     * Packets with numbers up to and including this one are treated as
+     * duplicates.
+     */
+    lsquic_packno_t                 rh_max_dropped;
     lsquic_time_t                   rh_largest_acked_received;
     lsquic_cid_t                    rh_cid;        /* Used for logging */
-    /* Chromium limits the number of tracked packets (see
-     * kMaxTrackedPackets).  We could do this, too.
-     */
-    unsigned                        rh_n_packets;
+    struct ack_gen_cache            rh_ack_cache;
     enum {
         RH_CUTOFF_SET   = (1 << 0),
     }                               rh_flags;
@@ -26,8 +53,10 @@ struct lsquic_rechist {
 
 typedef struct lsquic_rechist lsquic_rechist_t;
 
+/* If `max_ranges' is zero, the number of ranges is not limited */
 void
-lsquic_rechist_init (struct lsquic_rechist *, lsquic_cid_t);
+lsquic_rechist_init (struct lsquic_rechist *, lsquic_cid_t,
+                                                    unsigned max_ranges);
 
 void
 lsquic_rechist_cleanup (struct lsquic_rechist *);
@@ -45,12 +74,6 @@ lsquic_rechist_received (lsquic_rechist_t *, lsquic_packno_t,
 void
 lsquic_rechist_stop_wait (lsquic_rechist_t *, lsquic_packno_t);
 
-/* Returns number of bytes written on success, -1 on failure */
-int
-lsquic_rechist_make_ackframe (lsquic_rechist_t *,
-                          void *outbuf, size_t outbuf_sz, int *has_missing,
-                          lsquic_time_t now);
-
 const struct lsquic_packno_range *
 lsquic_rechist_first (lsquic_rechist_t *);
 
@@ -69,4 +92,14 @@ lsquic_rechist_largest_recv (const lsquic_rechist_t *);
 size_t
 lsquic_rechist_mem_used (const struct lsquic_rechist *);
 
+#define lsquic_rechist_ack_cache(rechist) (&(rechist)->rh_ack_cache)
+
+/* Copy encoded ACK blocks into the cache.  Returns 0 on success and -1 if
+ * memory could not be allocated, in which case the cache is left invalid.
+ */
+int
+lsquic_ack_gen_cache_save (struct ack_gen_cache *, const unsigned char *buf,
+        unsigned sz, unsigned n_blocks, unsigned block_len,
+        lsquic_packno_t maxdiff);
+
 #endif
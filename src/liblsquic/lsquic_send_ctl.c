@@ -21,7 +21,9 @@
 #include "lsquic_packet_out.h"
 #include "lsquic_senhist.h"
 #include "lsquic_rtt.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
 #include "lsquic_pacer.h"
 #include "lsquic_send_ctl.h"
 #include "lsquic_util.h"
@@ -45,6 +47,18 @@
 #define MIN_RTO_DELAY           1000000      /* Microseconds */
 #define N_NACKS_BEFORE_RETX     3
 
+/* Reordering window starts at 1/8 of RTT and can grow up to a full RTT.
+ * It is reset after this many loss events without spurious losses.
+ */
+#define RACK_REO_WND_MULT_MAX   8
+#define RACK_REO_WND_PERSIST    16
+#define RACK_MIN_LOSS_DELAY     1000        /* Microseconds */
+
+#define MAX_LOST_RECS           256
+
+/* Congestion controller state */
+#define CGP(ctl) ((void *) &(ctl)->sc_cong_u)
+
 #define packet_out_total_sz(p) \
                 lsquic_packet_out_total_sz(ctl->sc_conn_pub->lconn, p)
 #define packet_out_sent_sz(p) \
@@ -82,9 +96,15 @@ set_retx_alarm (lsquic_send_ctl_t *ctl);
 static void
 send_ctl_detect_losses (lsquic_send_ctl_t *ctl, lsquic_time_t time);
 
+static void
+send_ctl_begin_loss_epoch (struct lsquic_send_ctl *ctl, int is_rto);
+
 static unsigned
 send_ctl_retx_bytes_out (const struct lsquic_send_ctl *ctl);
 
+static unsigned
+send_ctl_all_bytes_out (const struct lsquic_send_ctl *ctl);
+
 
 #ifdef NDEBUG
 static
@@ -219,8 +239,10 @@ retx_alarm_rings (void *ctx, lsquic_time_t expiry, lsquic_time_t now)
         ++ctl->sc_n_consec_rtos;
         ctl->sc_next_limit = 2;
         LSQ_DEBUG("packet RTO is %"PRIu64" usec", expiry);
+        send_ctl_begin_loss_epoch(ctl, 1);
         send_ctl_expire(ctl, EXFI_ALL);
-        lsquic_cubic_timeout(&ctl->sc_cubic);
+        ctl->sc_ci->cci_timeout(CGP(ctl));
+        ctl->sc_prr.recover_fs = 0;
         break;
     }
 
@@ -231,6 +253,35 @@ retx_alarm_rings (void *ctx, lsquic_time_t expiry, lsquic_time_t now)
 }
 
 
+static void
+send_ctl_init_cong_ctl (struct lsquic_send_ctl *ctl)
+{
+    const struct lsquic_engine_public *const enpub = ctl->sc_enpub;
+
+    if (enpub->enp_cc_if)
+    {
+        ctl->sc_ci = &lsquic_cong_user_if;
+        if (0 == ctl->sc_ci->cci_init(CGP(ctl), ctl->sc_conn_pub))
+            return;
+        LSQ_INFO("fall back to built-in congestion controller");
+    }
+
+    if (enpub->enp_settings.es_cc_algo == 2)
+    {
+        ctl->sc_ci = &lsquic_cong_bbr_if;
+        /* BBR relies on pacing */
+        ctl->sc_flags |= SC_PACE;
+    }
+    else
+    {
+        ctl->sc_ci = &lsquic_cong_cubic_if;
+        /* BBR has its own recovery mechanism; CUBIC uses PRR */
+        ctl->sc_flags |= SC_PRR;
+    }
+    (void) ctl->sc_ci->cci_init(CGP(ctl), ctl->sc_conn_pub);
+}
+
+
 void
 lsquic_send_ctl_init (lsquic_send_ctl_t *ctl, struct lsquic_alarmset *alset,
           struct lsquic_engine_public *enpub, const struct ver_neg *ver_neg,
@@ -250,10 +301,12 @@ lsquic_send_ctl_init (lsquic_send_ctl_t *ctl, struct lsquic_alarmset *alset,
         ctl->sc_flags |= SC_PACE;
     lsquic_alarmset_init_alarm(alset, AL_RETX, retx_alarm_rings, ctl);
     lsquic_senhist_init(&ctl->sc_senhist);
-    lsquic_cubic_init(&ctl->sc_cubic, LSQUIC_LOG_CONN_ID);
+    send_ctl_init_cong_ctl(ctl);
+    ctl->sc_rack.reo_wnd_mult = 1;
     if (ctl->sc_flags & SC_PACE)
         pacer_init(&ctl->sc_pacer, LSQUIC_LOG_CONN_ID,
-                                    enpub->enp_settings.es_clock_granularity);
+                                    enpub->enp_settings.es_clock_granularity,
+                                    enpub->enp_settings.es_txtime_horizon);
     for (i = 0; i < sizeof(ctl->sc_buffered_packets) /
                                 sizeof(ctl->sc_buffered_packets[0]); ++i)
         TAILQ_INIT(&ctl->sc_buffered_packets[i].bpq_packets);
@@ -368,46 +421,152 @@ send_ctl_in_recovery (lsquic_send_ctl_t *ctl)
 }
 
 
-static int
-send_ctl_in_slow_start (lsquic_send_ctl_t *ctl)
+static lsquic_time_t
+send_ctl_transfer_time (void *ctx)
 {
-    return lsquic_cubic_in_slow_start(&ctl->sc_cubic);
+    lsquic_send_ctl_t *const ctl = ctx;
+    uint64_t pacing_rate;
+    lsquic_time_t tx_time;
+    int in_recovery;
+
+    in_recovery = send_ctl_in_recovery(ctl);
+    pacing_rate = ctl->sc_ci->cci_pacing_rate(CGP(ctl), in_recovery);
+    if (pacing_rate == 0)
+        pacing_rate = 1;
+    tx_time = (uint64_t) ctl->sc_pack_size * 1000000 / pacing_rate;
+    LSQ_DEBUG("rec: %d; pacing rate: %"PRIu64"; tx_time: %"PRIu64,
+                                        in_recovery, pacing_rate, tx_time);
+    return tx_time;
 }
 
 
-static lsquic_time_t
-send_ctl_transfer_time (void *ctx)
+#define UNACKED_RING_MIN_SZ 64
+
+#define unacked_slot(ctl, packno) (ctl)->sc_unacked_ring[ \
+                                (packno) & ((ctl)->sc_unacked_ring_sz - 1) ]
+
+static struct lsquic_packet_out *
+send_ctl_unacked_lookup (const struct lsquic_send_ctl *ctl,
+                                                    lsquic_packno_t packno)
 {
-    lsquic_send_ctl_t *const ctl = ctx;
-    uint64_t bandwidth, pacing_rate;
-    lsquic_time_t srtt, tx_time;
-    unsigned long cwnd;
+    struct lsquic_packet_out *packet_out;
 
-    srtt = lsquic_rtt_stats_get_srtt(&ctl->sc_conn_pub->rtt_stats);
-    if (srtt == 0)
-        srtt = 50000;
-    cwnd = lsquic_cubic_get_cwnd(&ctl->sc_cubic);
-    bandwidth = cwnd * 1000000 / srtt;
-    if (send_ctl_in_slow_start(ctl))
-        pacing_rate = bandwidth * 2;
-    else if (send_ctl_in_recovery(ctl))
-        pacing_rate = bandwidth;
+    if (!ctl->sc_unacked_ring)
+        return NULL;
+    packet_out = unacked_slot(ctl, packno);
+    if (packet_out && packet_out->po_packno == packno)
+        return packet_out;
     else
-        pacing_rate = bandwidth + bandwidth / 4;
+        return NULL;
+}
 
-    tx_time = (uint64_t) ctl->sc_pack_size * 1000000 / pacing_rate;
-    LSQ_DEBUG("srtt: %"PRIu64"; ss: %d; rec: %d; cwnd: %lu; bandwidth: "
-        "%"PRIu64"; tx_time: %"PRIu64, srtt, send_ctl_in_slow_start(ctl),
-        send_ctl_in_recovery(ctl), cwnd, bandwidth, tx_time);
-    return tx_time;
+
+/* Return the size of the ring that can hold `span' + 1 consecutive packet
+ * numbers or zero if such ring would be too large.
+ */
+static unsigned
+unacked_ring_size (lsquic_packno_t span)
+{
+    unsigned sz;
+
+    sz = UNACKED_RING_MIN_SZ;
+    while (sz <= span)
+    {
+        if (sz >= 1u << 31)
+            return 0;
+        sz <<= 1;
+    }
+    return sz;
 }
 
 
+static int
+send_ctl_resize_unacked_ring (struct lsquic_send_ctl *ctl, unsigned sz)
+{
+    struct lsquic_packet_out **ring, *packet_out;
+
+    ring = calloc(sz, sizeof(ring[0]));
+    if (!ring)
+        return -1;
+
+    TAILQ_FOREACH(packet_out, &ctl->sc_unacked_packets, po_next)
+        ring[ packet_out->po_packno & (sz - 1) ] = packet_out;
+
+    LSQ_DEBUG("resized unacked ring from %u to %u slots",
+                                                ctl->sc_unacked_ring_sz, sz);
+    free(ctl->sc_unacked_ring);
+    ctl->sc_unacked_ring = ring;
+    ctl->sc_unacked_ring_sz = sz;
+    return 0;
+}
+
+
+/* Grow the ring so that it can hold `span' + 1 consecutive packet numbers */
+static int
+send_ctl_grow_unacked_ring (struct lsquic_send_ctl *ctl, lsquic_packno_t span)
+{
+    unsigned sz;
+
+    sz = unacked_ring_size(span);
+    if (sz == 0)
+        return -1;
+    return send_ctl_resize_unacked_ring(ctl, sz);
+}
+
+
+/* Once the span of unacked packet numbers falls well below the size of the
+ * ring -- for example, after a burst of packets has been acked -- the ring
+ * is shrunk so that a connection does not hold on to a large ring for the
+ * rest of its life.  The new ring leaves room for the span to double.
+ */
 static void
+send_ctl_maybe_shrink_unacked_ring (struct lsquic_send_ctl *ctl)
+{
+    const struct lsquic_packet_out *first, *last;
+    lsquic_packno_t span;
+
+    if (ctl->sc_unacked_ring_sz <= UNACKED_RING_MIN_SZ)
+        return;
+
+    first = TAILQ_FIRST(&ctl->sc_unacked_packets);
+    if (first)
+    {
+        last = TAILQ_LAST(&ctl->sc_unacked_packets, lsquic_packets_tailq);
+        span = last->po_packno - first->po_packno;
+    }
+    else
+        span = 0;
+
+    /* Failure to shrink is not an error: the old ring is still good */
+    if (span < ctl->sc_unacked_ring_sz / 8)
+        (void) send_ctl_resize_unacked_ring(ctl, unacked_ring_size(span * 2));
+}
+
+
+static int
 send_ctl_unacked_append (struct lsquic_send_ctl *ctl,
                          struct lsquic_packet_out *packet_out)
 {
+    const struct lsquic_packet_out *first;
+    int s;
+
+    first = TAILQ_FIRST(&ctl->sc_unacked_packets);
+    if (!first)
+        first = packet_out;
+    assert(packet_out->po_packno >= first->po_packno);
+    if (packet_out->po_packno - first->po_packno >= ctl->sc_unacked_ring_sz)
+        s = send_ctl_grow_unacked_ring(ctl,
+                                    packet_out->po_packno - first->po_packno);
+    else
+        s = 0;
+
+    /* The packet is placed onto the list even if the ring could not be
+     * grown, so that it is not leaked.  The connection is aborted in this
+     * case.
+     */
     TAILQ_INSERT_TAIL(&ctl->sc_unacked_packets, packet_out, po_next);
+    if (s == 0)
+        unacked_slot(ctl, packet_out->po_packno) = packet_out;
     ctl->sc_bytes_unacked_all += packet_out_total_sz(packet_out);
     ctl->sc_n_in_flight_all  += 1;
     if (packet_out->po_frame_types & QFRAME_RETRANSMITTABLE_MASK)
@@ -415,6 +574,7 @@ send_ctl_unacked_append (struct lsquic_send_ctl *ctl,
         ctl->sc_bytes_unacked_retx += packet_out_total_sz(packet_out);
         ++ctl->sc_n_in_flight_retx;
     }
+    return s;
 }
 
 
@@ -423,6 +583,8 @@ send_ctl_unacked_remove (struct lsquic_send_ctl *ctl,
                      struct lsquic_packet_out *packet_out, unsigned packet_sz)
 {
     TAILQ_REMOVE(&ctl->sc_unacked_packets, packet_out, po_next);
+    if (send_ctl_unacked_lookup(ctl, packet_out->po_packno) == packet_out)
+        unacked_slot(ctl, packet_out->po_packno) = NULL;
     assert(ctl->sc_bytes_unacked_all >= packet_sz);
     ctl->sc_bytes_unacked_all -= packet_sz;
     ctl->sc_n_in_flight_all  -= 1;
@@ -481,13 +643,27 @@ lsquic_send_ctl_sent_packet (lsquic_send_ctl_t *ctl,
                              struct lsquic_packet_out *packet_out, int account)
 {
     char frames[lsquic_frame_types_str_sz];
+    unsigned packet_sz;
+    int app_limited, s;
+
     LSQ_DEBUG("packet %"PRIu64" has been sent (frame types: %s)",
         packet_out->po_packno, lsquic_frame_types_to_str(frames,
             sizeof(frames), packet_out->po_frame_types));
     if (account)
         ctl->sc_bytes_out -= packet_out_total_sz(packet_out);
     lsquic_senhist_add(&ctl->sc_senhist, packet_out->po_packno);
-    send_ctl_unacked_append(ctl, packet_out);
+    packet_sz = packet_out_sent_sz(packet_out);
+    /* The sender is application-limited if it has nothing else queued up
+     * and there is room left in the congestion window.
+     */
+    app_limited = ctl->sc_n_scheduled == 0
+        && send_ctl_all_bytes_out(ctl) + packet_sz
+                                        < ctl->sc_ci->cci_get_cwnd(CGP(ctl));
+    ctl->sc_ci->cci_sent(CGP(ctl), packet_out->po_packno, packet_sz,
+        packet_out->po_sent, ctl->sc_bytes_unacked_all, app_limited);
+    if (ctl->sc_prr.recover_fs)
+        ctl->sc_prr.out += packet_out_total_sz(packet_out);
+    s = send_ctl_unacked_append(ctl, packet_out);
     if (packet_out->po_frame_types & QFRAME_RETRANSMITTABLE_MASK)
     {
         if (!lsquic_alarmset_is_set(ctl->sc_alset, AL_RETX))
@@ -502,8 +678,11 @@ lsquic_send_ctl_sent_packet (lsquic_send_ctl_t *ctl,
 #if LSQUIC_SEND_STATS
     ++ctl->sc_stats.n_total_sent;
 #endif
-    lsquic_send_ctl_sanity_check(ctl);
-    return 0;
+    if (s == 0)
+        lsquic_send_ctl_sanity_check(ctl);
+    else
+        errno = ENOMEM;
+    return s;
 }
 
 
@@ -546,6 +725,221 @@ send_ctl_destroy_packet (struct lsquic_send_ctl *ctl,
 }
 
 
+static void
+send_ctl_record_loss (struct lsquic_send_ctl *ctl, lsquic_packno_t packno)
+{
+    struct lost_rec *recs;
+    unsigned n, sz;
+
+    if (ctl->sc_n_lost_recs >= ctl->sc_lost_recs_sz)
+    {
+        if (ctl->sc_lost_recs_sz >= MAX_LOST_RECS)
+        {
+            /* Forget the oldest loss */
+            if (ctl->sc_lost_recs[0].lr_epoch == ctl->sc_loss_epoch.id)
+                ctl->sc_loss_epoch.flags &= ~LE_CAN_UNDO;
+            memmove(ctl->sc_lost_recs, ctl->sc_lost_recs + 1,
+                (ctl->sc_n_lost_recs - 1) * sizeof(ctl->sc_lost_recs[0]));
+            --ctl->sc_n_lost_recs;
+        }
+        else
+        {
+            sz = ctl->sc_lost_recs_sz ? ctl->sc_lost_recs_sz * 2 : 16;
+            recs = realloc(ctl->sc_lost_recs, sz * sizeof(recs[0]));
+            if (!recs)
+            {
+                LSQ_INFO("cannot allocate lost packet record");
+                ctl->sc_loss_epoch.flags &= ~LE_CAN_UNDO;
+                return;
+            }
+            ctl->sc_lost_recs = recs;
+            ctl->sc_lost_recs_sz = sz;
+        }
+    }
+
+    /* Packets are usually declared lost in order */
+    recs = ctl->sc_lost_recs;
+    n = ctl->sc_n_lost_recs;
+    while (n > 0 && recs[n - 1].lr_packno > packno)
+        --n;
+    memmove(recs + n + 1, recs + n, (ctl->sc_n_lost_recs - n) * sizeof(recs[0]));
+    recs[n].lr_packno = packno;
+    recs[n].lr_epoch = ctl->sc_loss_epoch.id;
+    ++ctl->sc_n_lost_recs;
+    ++ctl->sc_loss_epoch.n_lost;
+}
+
+
+static void
+send_ctl_begin_loss_epoch (struct lsquic_send_ctl *ctl, int is_rto)
+{
+    ++ctl->sc_loss_epoch.id;
+    ctl->sc_loss_epoch.n_lost = 0;
+    ctl->sc_loss_epoch.prev_cutback = ctl->sc_largest_sent_at_cutback;
+    ctl->sc_loss_epoch.flags = LE_CAN_UNDO | (is_rto ? LE_RTO : 0);
+}
+
+
+static void
+send_ctl_undo_loss_epoch (struct lsquic_send_ctl *ctl)
+{
+    LSQ_INFO("all packets lost in %s epoch %u have been acked: undo "
+        "congestion response",
+        ctl->sc_loss_epoch.flags & LE_RTO ? "RTO" : "loss",
+        ctl->sc_loss_epoch.id);
+    ctl->sc_loss_epoch.flags &= ~LE_CAN_UNDO;
+    ctl->sc_largest_sent_at_cutback = ctl->sc_loss_epoch.prev_cutback;
+    ctl->sc_ci->cci_undo(CGP(ctl));
+    ctl->sc_prr.recover_fs = 0;
+#if LSQUIC_SEND_STATS
+    ++ctl->sc_stats.n_undos;
+#endif
+#if LSQUIC_CONN_STATS
+    if (ctl->sc_loss_epoch.flags & LE_RTO)
+        ++ctl->sc_conn_pub->conn_stats->out.rto_undos;
+    else
+        ++ctl->sc_conn_pub->conn_stats->out.loss_undos;
+#endif
+}
+
+
+static void
+send_ctl_prr_begin (struct lsquic_send_ctl *ctl, unsigned flight_size)
+{
+    ctl->sc_prr.recover_fs = flight_size;
+    ctl->sc_prr.ssthresh = ctl->sc_ci->cci_get_cwnd(CGP(ctl));
+    ctl->sc_prr.delivered = 0;
+    ctl->sc_prr.out = 0;
+    ctl->sc_prr.ssrb_limit = 0;
+    LSQ_DEBUG("begin PRR: recover_fs: %u; ssthresh: %u",
+                            ctl->sc_prr.recover_fs, ctl->sc_prr.ssthresh);
+}
+
+
+/* Called once per ACK after loss detection.  `delivered' is the number of
+ * bytes newly acked.
+ */
+static void
+send_ctl_prr_on_ack (struct lsquic_send_ctl *ctl, unsigned delivered)
+{
+    unsigned sent, allowed;
+
+    if (!send_ctl_in_recovery(ctl))
+    {
+        LSQ_DEBUG("recovery is over: end PRR");
+        ctl->sc_prr.recover_fs = 0;
+        return;
+    }
+
+    ctl->sc_prr.delivered += delivered;
+    /* If the pipe falls below ssthresh, PRR-SSRB lets it grow back up by
+     * at most one MSS more than was delivered.
+     */
+    sent = ctl->sc_prr.out + ctl->sc_bytes_scheduled + ctl->sc_bytes_out;
+    if (ctl->sc_prr.delivered > sent
+                                && ctl->sc_prr.delivered - sent > delivered)
+        allowed = ctl->sc_prr.delivered - sent;
+    else
+        allowed = delivered;
+    ctl->sc_prr.ssrb_limit = sent + allowed + ctl->sc_pack_size;
+}
+
+
+static int
+send_ctl_prr_can_send (const struct lsquic_send_ctl *ctl, unsigned n_out)
+{
+    unsigned sent;
+    uint64_t limit;
+
+    sent = ctl->sc_prr.out + ctl->sc_bytes_scheduled + ctl->sc_bytes_out;
+    /* Let the first packet -- usually the retransmission -- go out at once */
+    if (sent == 0)
+        return 1;
+    if (n_out > ctl->sc_prr.ssthresh)
+    {
+        /* Proportional rate reduction */
+        limit = ((uint64_t) ctl->sc_prr.delivered * ctl->sc_prr.ssthresh
+                    + ctl->sc_prr.recover_fs - 1) / ctl->sc_prr.recover_fs;
+        return sent < limit;
+    }
+    else
+        /* Slow start reduction bound */
+        return n_out < ctl->sc_prr.ssthresh
+            && sent < ctl->sc_prr.ssrb_limit;
+}
+
+
+static void
+send_ctl_spurious_loss (struct lsquic_send_ctl *ctl,
+                                                const struct lost_rec *rec)
+{
+    LSQ_DEBUG("packet %"PRIu64" was declared lost spuriously",
+                                                            rec->lr_packno);
+#if LSQUIC_SEND_STATS
+    ++ctl->sc_stats.n_spurious;
+#endif
+#if LSQUIC_CONN_STATS
+    ++ctl->sc_conn_pub->conn_stats->out.spurious_losses;
+#endif
+    ctl->sc_rack.reordering_seen = 1;
+    ctl->sc_rack.reo_wnd_persist = RACK_REO_WND_PERSIST;
+    if (ctl->sc_rack.packno > ctl->sc_rack.reo_wnd_incr_packno
+                    && ctl->sc_rack.reo_wnd_mult < RACK_REO_WND_MULT_MAX)
+    {
+        ++ctl->sc_rack.reo_wnd_mult;
+        ctl->sc_rack.reo_wnd_incr_packno =
+                                    lsquic_senhist_largest(&ctl->sc_senhist);
+        LSQ_DEBUG("reordering window is now %u/8 of RTT",
+                                                ctl->sc_rack.reo_wnd_mult);
+    }
+}
+
+
+/* A packet that was declared lost and then acked was not lost at all, but
+ * delayed.  Records of packets smaller than the smallest packet number in
+ * the ACK frame are dropped: the peer no longer reports them.  If all
+ * packets lost in the current loss epoch turn out to have been delayed,
+ * the congestion response to it is undone.
+ */
+static void
+send_ctl_check_spurious_losses (struct lsquic_send_ctl *ctl,
+                                                const struct ack_info *acki)
+{
+    const struct lsquic_packno_range *range;
+    struct lost_rec *const recs = ctl->sc_lost_recs;
+    lsquic_packno_t packno;
+    unsigned src, dst;
+
+    range = &acki->ranges[ acki->n_ranges - 1 ];
+    for (src = dst = 0; src < ctl->sc_n_lost_recs; ++src)
+    {
+        packno = recs[src].lr_packno;
+        if (packno < smallest_acked(acki))
+        {
+            /* Never acked: the loss was real */
+            if (recs[src].lr_epoch == ctl->sc_loss_epoch.id)
+                ctl->sc_loss_epoch.flags &= ~LE_CAN_UNDO;
+            continue;
+        }
+        while (range > acki->ranges && range->high < packno)
+            --range;
+        if (range->low <= packno && packno <= range->high)
+        {
+            send_ctl_spurious_loss(ctl, &recs[src]);
+            if (recs[src].lr_epoch == ctl->sc_loss_epoch.id)
+                --ctl->sc_loss_epoch.n_lost;
+        }
+        else
+            recs[dst++] = recs[src];
+    }
+    ctl->sc_n_lost_recs = dst;
+
+    if ((ctl->sc_loss_epoch.flags & LE_CAN_UNDO)
+                                        && 0 == ctl->sc_loss_epoch.n_lost)
+        send_ctl_undo_loss_epoch(ctl);
+}
+
+
 /* Returns true if packet was rescheduled, false otherwise.  In the latter
  * case, you should not dereference packet_out after the function returns.
  */
@@ -558,6 +952,14 @@ send_ctl_handle_lost_packet (lsquic_send_ctl_t *ctl,
     assert(ctl->sc_n_in_flight_all);
     packet_sz = packet_out_sent_sz(packet_out);
     send_ctl_unacked_remove(ctl, packet_out, packet_sz);
+    ctl->sc_ci->cci_lost(CGP(ctl), packet_out->po_packno, packet_sz);
+    send_ctl_record_loss(ctl, packet_out->po_packno);
+#if LSQUIC_SEND_STATS
+    ++ctl->sc_stats.n_lost;
+#endif
+#if LSQUIC_CONN_STATS
+    ++ctl->sc_conn_pub->conn_stats->out.lost_packets;
+#endif
     if (packet_out->po_flags & PO_ENCRYPTED)
         send_ctl_release_enc_data(ctl, packet_out);
     if (packet_out->po_frame_types & (1 << QUIC_FRAME_ACK))
@@ -582,17 +984,23 @@ send_ctl_handle_lost_packet (lsquic_send_ctl_t *ctl,
 }
 
 
-static lsquic_packno_t
-largest_retx_packet_number (const lsquic_send_ctl_t *ctl)
+/* RACK loss delay: RTT plus the reordering window.  The smaller of the
+ * smoothed RTT and the RTT measured on the most recently sent acked packet
+ * is used, so that the delay adapts quickly when RTT drops.
+ */
+static lsquic_time_t
+send_ctl_rack_loss_delay (const struct lsquic_send_ctl *ctl)
 {
-    const lsquic_packet_out_t *packet_out;
-    TAILQ_FOREACH_REVERSE(packet_out, &ctl->sc_unacked_packets,
-                                                lsquic_packets_tailq, po_next)
-    {
-        if (packet_out->po_frame_types & QFRAME_RETRANSMITTABLE_MASK)
-            return packet_out->po_packno;
-    }
-    return 0;
+    lsquic_time_t srtt, rtt, delay;
+
+    srtt = lsquic_rtt_stats_get_srtt(&ctl->sc_conn_pub->rtt_stats);
+    rtt = ctl->sc_rack.rtt;
+    if (srtt && (!rtt || srtt < rtt))
+        rtt = srtt;
+    delay = rtt + rtt * ctl->sc_rack.reo_wnd_mult / RACK_REO_WND_MULT_MAX;
+    if (delay < RACK_MIN_LOSS_DELAY)
+        delay = RACK_MIN_LOSS_DELAY;
+    return delay;
 }
 
 
@@ -600,65 +1008,80 @@ static void
 send_ctl_detect_losses (lsquic_send_ctl_t *ctl, lsquic_time_t time)
 {
     lsquic_packet_out_t *packet_out, *next;
-    lsquic_packno_t largest_retx_packno, largest_lost_packno;
+    lsquic_packno_t largest_lost_packno;
+    lsquic_time_t loss_delay, deadline;
+    unsigned flight_size;
+    int counts;
 
-    largest_retx_packno = largest_retx_packet_number(ctl);
     largest_lost_packno = 0;
+    flight_size = ctl->sc_bytes_unacked_all;
     ctl->sc_loss_to = 0;
+    loss_delay = send_ctl_rack_loss_delay(ctl);
 
     for (packet_out = TAILQ_FIRST(&ctl->sc_unacked_packets);
-            packet_out && packet_out->po_packno <= ctl->sc_largest_acked_packno;
+            packet_out && packet_out->po_packno < ctl->sc_rack.packno;
                 packet_out = next)
     {
         next = TAILQ_NEXT(packet_out, po_next);
 
-        if (packet_out->po_packno + N_NACKS_BEFORE_RETX <
-                                                ctl->sc_largest_acked_packno)
+        /* Packet-threshold detection is only used until reordering is
+         * observed on the path: after that, time is the only criterion.
+         */
+        if (!ctl->sc_rack.reordering_seen && packet_out->po_packno
+                            + N_NACKS_BEFORE_RETX < ctl->sc_rack.packno)
         {
             LSQ_DEBUG("loss by FACK detected, packet %"PRIu64,
                                                     packet_out->po_packno);
-            largest_lost_packno = packet_out->po_packno;
-            (void) send_ctl_handle_lost_packet(ctl, packet_out);
-            continue;
+            counts = 1;
         }
-
-        if (largest_retx_packno
-            && (packet_out->po_frame_types & QFRAME_RETRANSMITTABLE_MASK)
-            && largest_retx_packno <= ctl->sc_largest_acked_packno)
+        else if ((deadline = packet_out->po_sent + loss_delay) <= time)
         {
-            LSQ_DEBUG("loss by early retransmit detected, packet %"PRIu64,
+            LSQ_DEBUG("loss by RACK detected: packet %"PRIu64,
                                                     packet_out->po_packno);
-            largest_lost_packno = packet_out->po_packno;
-            ctl->sc_loss_to =
-                lsquic_rtt_stats_get_srtt(&ctl->sc_conn_pub->rtt_stats) / 4;
+            /* Loss of non-retransmittable packet is not counted as a loss */
+            counts = !!(packet_out->po_frame_types
+                                                & QFRAME_RETRANSMITTABLE_MASK);
+        }
+        else
+        {
+            /* Packets that follow were sent later and thus expire later */
+            ctl->sc_loss_to = deadline - time;
             LSQ_DEBUG("set sc_loss_to to %"PRIu64", packet %"PRIu64,
                                     ctl->sc_loss_to, packet_out->po_packno);
-            (void) send_ctl_handle_lost_packet(ctl, packet_out);
-            continue;
+            break;
         }
 
-        if (ctl->sc_largest_acked_sent_time > packet_out->po_sent +
-                    lsquic_rtt_stats_get_srtt(&ctl->sc_conn_pub->rtt_stats))
+        if (counts)
         {
-            LSQ_DEBUG("loss by sent time detected: packet %"PRIu64,
-                                                    packet_out->po_packno);
-            if (packet_out->po_frame_types & QFRAME_RETRANSMITTABLE_MASK)
-                largest_lost_packno = packet_out->po_packno;
-            else { /* don't count it as a loss */; }
-            (void) send_ctl_handle_lost_packet(ctl, packet_out);
-            continue;
+            /* The first packet that signals a new loss event opens a new
+             * loss epoch.
+             */
+            if (packet_out->po_packno > ctl->sc_largest_sent_at_cutback
+                && largest_lost_packno <= ctl->sc_largest_sent_at_cutback)
+                send_ctl_begin_loss_epoch(ctl, 0);
+            largest_lost_packno = packet_out->po_packno;
         }
+        (void) send_ctl_handle_lost_packet(ctl, packet_out);
     }
 
     if (largest_lost_packno > ctl->sc_largest_sent_at_cutback)
     {
         LSQ_DEBUG("detected new loss: packet %"PRIu64"; new lsac: "
             "%"PRIu64, largest_lost_packno, ctl->sc_largest_sent_at_cutback);
-        lsquic_cubic_loss(&ctl->sc_cubic);
+        ctl->sc_ci->cci_loss(CGP(ctl));
         if (ctl->sc_flags & SC_PACE)
             pacer_loss_event(&ctl->sc_pacer);
         ctl->sc_largest_sent_at_cutback =
                                 lsquic_senhist_largest(&ctl->sc_senhist);
+        if ((ctl->sc_flags & SC_PRR) && flight_size)
+            send_ctl_prr_begin(ctl, flight_size);
+        if (ctl->sc_rack.reo_wnd_persist
+                                && 0 == --ctl->sc_rack.reo_wnd_persist)
+        {
+            LSQ_DEBUG("no spurious losses in %u loss events: reset "
+                "reordering window", RACK_REO_WND_PERSIST);
+            ctl->sc_rack.reo_wnd_mult = 1;
+        }
     }
     else if (largest_lost_packno)
         /* Lost packets whose numbers are smaller than the largest packet
@@ -675,20 +1098,17 @@ lsquic_send_ctl_got_ack (lsquic_send_ctl_t *ctl,
                          const struct ack_info *acki,
                          lsquic_time_t ack_recv_time)
 {
-    const struct lsquic_packno_range *range =
-                                    &acki->ranges[ acki->n_ranges - 1 ];
+    const struct lsquic_packno_range *range;
     lsquic_packet_out_t *packet_out, *next;
     lsquic_time_t now = 0;
-    lsquic_packno_t smallest_unacked;
+    lsquic_packno_t smallest_unacked, largest_unacked, packno, high, end;
+    lsquic_packno_t rack_packno, seen_low, seen_high;
     lsquic_packno_t ack2ed[2];
-    unsigned packet_sz;
+    unsigned packet_sz, bytes_acked, n_seen;
     int app_limited;
-    signed char do_rtt, skip_checks;
+    signed char do_rtt;
 
     packet_out = TAILQ_FIRST(&ctl->sc_unacked_packets);
-#if __GNUC__
-    __builtin_prefetch(packet_out);
-#endif
 
 #if __GNUC__
 #   define UNLIKELY(cond) __builtin_expect(cond, 0)
@@ -717,58 +1137,116 @@ lsquic_send_ctl_got_ack (lsquic_send_ctl_t *ctl,
         LSQ_DEBUG("ACK comes after a period of quiescence");
         if (!now)
             now = lsquic_time_now();
-        lsquic_cubic_was_quiet(&ctl->sc_cubic, now);
+        ctl->sc_ci->cci_was_quiet(CGP(ctl), now);
     }
 
+    if (UNLIKELY(ctl->sc_n_lost_recs))
+        send_ctl_check_spurious_losses(ctl, acki);
+
     if (UNLIKELY(!packet_out))
         goto no_unacked_packets;
 
     smallest_unacked = packet_out->po_packno;
     ack2ed[1] = 0;
+    if (!now)
+        now = lsquic_time_now();
+    ctl->sc_ci->cci_begin_ack(CGP(ctl), now, ctl->sc_bytes_unacked_all);
 
+    bytes_acked = 0;
     if (packet_out->po_packno > largest_acked(acki))
         goto detect_losses;
 
-    do_rtt = 0, skip_checks = 0;
+    largest_unacked = TAILQ_LAST(&ctl->sc_unacked_packets,
+                                        lsquic_packets_tailq)->po_packno;
+    rack_packno = ctl->sc_rack.packno;
+    do_rtt = 0;
     app_limited = -1;
-    do
+    /* Ranges are ordered from largest to smallest.  Go from the smallest
+     * range up, visiting only the slots of the unacked ring that fall
+     * within each range: gaps between ranges cost nothing.
+     *
+     * The peer repeats ranges until they are chopped by STOP_WAITING, so
+     * most of each range has usually been processed already.  Packets are
+     * never resent under the same packet number, so slots covered by the
+     * previous ACK frame cannot hold unacked packets and are skipped.
+     */
+    n_seen = ctl->sc_n_acked_ranges;
+    if (n_seen)
     {
-        next = TAILQ_NEXT(packet_out, po_next);
+        seen_low = ctl->sc_acked_ranges[n_seen - 1].low;
+        seen_high = ctl->sc_acked_ranges[n_seen - 1].high;
+    }
+    else
+        seen_low = seen_high = UINT64_MAX;
+    for (range = &acki->ranges[ acki->n_ranges - 1 ];
+                                            range >= acki->ranges; --range)
+    {
+        if (range->high < smallest_unacked)
+            continue;
+        if (range->low > largest_unacked)
+            break;
+        packno = range->low > smallest_unacked ? range->low : smallest_unacked;
+        high = range->high < largest_unacked ? range->high : largest_unacked;
+      next_segment:
+        while (seen_high < packno)
+        {
+            if (--n_seen > 0)
+            {
+                seen_low = ctl->sc_acked_ranges[n_seen - 1].low;
+                seen_high = ctl->sc_acked_ranges[n_seen - 1].high;
+            }
+            else
+                seen_low = seen_high = UINT64_MAX;
+        }
+        if (seen_low <= packno)
+            packno = seen_high + 1;
+        if (packno > high)
+            continue;
+        end = seen_low <= high ? seen_low - 1 : high;
+        next = send_ctl_unacked_lookup(ctl, packno);
+        for ( ; packno <= end; ++packno)
+        {
+            packet_out = next;
+            if (packno < end)
+            {
+                next = send_ctl_unacked_lookup(ctl, packno + 1);
 #if __GNUC__
-        __builtin_prefetch(next);
+                __builtin_prefetch(next);
 #endif
-        if (skip_checks)
-            goto after_checks;
-        /* This is faster than binary search in the normal case when the number
-         * of ranges is not much larger than the number of unacked packets.
-         */
-        while (UNLIKELY(range->high < packet_out->po_packno))
-            --range;
-        if (range->low <= packet_out->po_packno)
-        {
-            skip_checks = range == acki->ranges;
+            }
+            if (!packet_out)
+                continue;
             if (app_limited < 0)
+            {
                 app_limited = send_ctl_retx_bytes_out(ctl) + 3 * ctl->sc_pack_size /* This
                     is the "maximum burst" parameter */
-                    < lsquic_cubic_get_cwnd(&ctl->sc_cubic);
-            if (!now)
-                now = lsquic_time_now();
-  after_checks:
+                    < ctl->sc_ci->cci_get_cwnd(CGP(ctl));
+            }
             packet_sz = packet_out_sent_sz(packet_out);
             ctl->sc_largest_acked_packno    = packet_out->po_packno;
             ctl->sc_largest_acked_sent_time = packet_out->po_sent;
+            if (packet_out->po_packno > ctl->sc_rack.packno)
+            {
+                ctl->sc_rack.packno = packet_out->po_packno;
+                ctl->sc_rack.sent = packet_out->po_sent;
+                if (ack_recv_time > packet_out->po_sent)
+                    ctl->sc_rack.rtt = ack_recv_time - packet_out->po_sent;
+            }
+            else if (packet_out->po_packno < rack_packno)
+                ctl->sc_rack.reordering_seen = 1;
             send_ctl_unacked_remove(ctl, packet_out, packet_sz);
+            bytes_acked += packet_sz;
             ack2ed[!!(packet_out->po_frame_types & (1 << QUIC_FRAME_ACK))]
                 = packet_out->po_ack2ed;
             do_rtt |= packet_out->po_packno == largest_acked(acki);
-            lsquic_cubic_ack(&ctl->sc_cubic, now, now - packet_out->po_sent,
-                             app_limited, packet_sz);
+            ctl->sc_ci->cci_ack(CGP(ctl), packet_out->po_packno, packet_sz,
+                                    packet_out->po_sent, now, app_limited);
             lsquic_packet_out_ack_streams(packet_out);
             send_ctl_destroy_packet(ctl, packet_out);
         }
-        packet_out = next;
+        if (packno <= high)
+            goto next_segment;
     }
-    while (packet_out && packet_out->po_packno <= largest_acked(acki));
 
     if (do_rtt)
     {
@@ -780,6 +1258,9 @@ lsquic_send_ctl_got_ack (lsquic_send_ctl_t *ctl,
 
   detect_losses:
     send_ctl_detect_losses(ctl, ack_recv_time);
+    if (ctl->sc_prr.recover_fs)
+        send_ctl_prr_on_ack(ctl, bytes_acked);
+    ctl->sc_ci->cci_end_ack(CGP(ctl), ctl->sc_bytes_unacked_all);
     if (send_ctl_first_unacked_retx_packet(ctl))
         set_retx_alarm(ctl);
     else
@@ -795,7 +1276,19 @@ lsquic_send_ctl_got_ack (lsquic_send_ctl_t *ctl,
     if (ctl->sc_n_in_flight_retx == 0)
         ctl->sc_flags |= SC_WAS_QUIET;
 
+    send_ctl_maybe_shrink_unacked_ring(ctl);
+
   update_n_stop_waiting:
+    /* ACK frames may arrive out of order: only the newest one is kept */
+    if (ctl->sc_n_acked_ranges == 0
+            || largest_acked(acki) >= ctl->sc_acked_ranges[0].high)
+    {
+        ctl->sc_n_acked_ranges = acki->n_ranges < SC_N_ACKED_RANGES
+                                    ? acki->n_ranges : SC_N_ACKED_RANGES;
+        memcpy(ctl->sc_acked_ranges, acki->ranges,
+                    ctl->sc_n_acked_ranges * sizeof(ctl->sc_acked_ranges[0]));
+    }
+
     if (smallest_unacked > smallest_acked(acki))
         /* Peer is acking packets that have been acked already.  Schedule ACK
          * and STOP_WAITING frame to chop the range if we get two of these in
@@ -889,6 +1382,8 @@ lsquic_send_ctl_cleanup (lsquic_send_ctl_t *ctl)
         send_ctl_destroy_packet(ctl, packet_out);
         --ctl->sc_n_in_flight_all;
     }
+    free(ctl->sc_unacked_ring);
+    free(ctl->sc_lost_recs);
     assert(0 == ctl->sc_n_in_flight_all);
     assert(0 == ctl->sc_bytes_unacked_all);
     while ((packet_out = TAILQ_FIRST(&ctl->sc_lost_packets)))
@@ -908,10 +1403,13 @@ lsquic_send_ctl_cleanup (lsquic_send_ctl_t *ctl)
     }
     if (ctl->sc_flags & SC_PACE)
         pacer_cleanup(&ctl->sc_pacer);
+    ctl->sc_ci->cci_cleanup(CGP(ctl));
 #if LSQUIC_SEND_STATS
-    LSQ_NOTICE("stats: n_total_sent: %u; n_resent: %u; n_delayed: %u",
+    LSQ_NOTICE("stats: n_total_sent: %u; n_resent: %u; n_delayed: %u; "
+        "n_lost: %u; n_spurious: %u; n_undos: %u",
         ctl->sc_stats.n_total_sent, ctl->sc_stats.n_resent,
-        ctl->sc_stats.n_delayed);
+        ctl->sc_stats.n_delayed, ctl->sc_stats.n_lost,
+        ctl->sc_stats.n_spurious, ctl->sc_stats.n_undos);
 #endif
 }
 
@@ -954,11 +1452,16 @@ lsquic_send_ctl_can_send (lsquic_send_ctl_t *ctl)
     const unsigned n_out = send_ctl_all_bytes_out(ctl);
     LSQ_DEBUG("%s: n_out: %u (unacked_all: %u, out: %u); cwnd: %lu", __func__,
         n_out, ctl->sc_bytes_unacked_all, ctl->sc_bytes_out,
-        lsquic_cubic_get_cwnd(&ctl->sc_cubic));
-    if (ctl->sc_flags & SC_PACE)
+        ctl->sc_ci->cci_get_cwnd(CGP(ctl)));
+    if (ctl->sc_prr.recover_fs)
     {
-        if (n_out >= lsquic_cubic_get_cwnd(&ctl->sc_cubic))
+        if (!send_ctl_prr_can_send(ctl, n_out))
             return 0;
+    }
+    else if (n_out >= ctl->sc_ci->cci_get_cwnd(CGP(ctl)))
+        return 0;
+    if (ctl->sc_flags & SC_PACE)
+    {
         if (pacer_can_schedule(&ctl->sc_pacer,
                                ctl->sc_n_scheduled + ctl->sc_n_in_flight_all))
             return 1;
@@ -971,7 +1474,7 @@ lsquic_send_ctl_can_send (lsquic_send_ctl_t *ctl)
         return 0;
     }
     else
-        return n_out < lsquic_cubic_get_cwnd(&ctl->sc_cubic);
+        return 1;
 }
 
 
@@ -1048,6 +1551,8 @@ lsquic_send_ctl_sanity_check (const lsquic_send_ctl_t *ctl)
     count = 0, bytes = 0;
     TAILQ_FOREACH(packet_out, &ctl->sc_unacked_packets, po_next)
     {
+        assert(send_ctl_unacked_lookup(ctl, packet_out->po_packno)
+                                                            == packet_out);
         bytes += packet_out_sent_sz(packet_out);
         ++count;
     }
@@ -1083,8 +1588,14 @@ lsquic_send_ctl_scheduled_one (lsquic_send_ctl_t *ctl,
     if (ctl->sc_flags & SC_PACE)
     {
         unsigned n_out = ctl->sc_n_in_flight_retx + ctl->sc_n_scheduled;
-        pacer_packet_scheduled(&ctl->sc_pacer, n_out,
+        lsquic_time_t txtime;
+        txtime = pacer_packet_scheduled(&ctl->sc_pacer, n_out,
             send_ctl_in_recovery(ctl), send_ctl_transfer_time, ctl);
+        if (txtime && ctl->sc_pacer.pa_horizon)
+        {
+            packet_out->po_sent = txtime;
+            packet_out->po_flags |= PO_TXTIME;
+        }
     }
     send_ctl_sched_append(ctl, packet_out);
 }
@@ -1637,9 +2148,9 @@ send_ctl_max_bpq_count (const lsquic_send_ctl_t *ctl,
     case BPT_HIGHEST_PRIO:
     default: /* clang does not complain about absence of `default'... */
         count = ctl->sc_n_scheduled + ctl->sc_n_in_flight_retx;
-        if (count < lsquic_cubic_get_cwnd(&ctl->sc_cubic) / ctl->sc_pack_size)
+        if (count < ctl->sc_ci->cci_get_cwnd(CGP(ctl)) / ctl->sc_pack_size)
         {
-            count -= lsquic_cubic_get_cwnd(&ctl->sc_cubic) / ctl->sc_pack_size;
+            count -= ctl->sc_ci->cci_get_cwnd(CGP(ctl)) / ctl->sc_pack_size;
             if (count > MAX_BPQ_COUNT)
                 return count;
         }
@@ -1786,7 +2297,7 @@ lsquic_send_ctl_calc_packno_bits (lsquic_send_ctl_t *ctl)
     unsigned n_in_flight;
 
     smallest_unacked = lsquic_send_ctl_smallest_unacked(ctl);
-    n_in_flight = lsquic_cubic_get_cwnd(&ctl->sc_cubic) / ctl->sc_pack_size;
+    n_in_flight = ctl->sc_ci->cci_get_cwnd(CGP(ctl)) / ctl->sc_pack_size;
     bits = calc_packno_bits(ctl->sc_cur_packno + 1, smallest_unacked,
                                                             n_in_flight);
     if (bits <= ctl->sc_max_packno_bits)
@@ -1944,6 +2455,8 @@ lsquic_send_ctl_mem_used (const struct lsquic_send_ctl *ctl)
     };
 
     size = sizeof(*ctl);
+    size += ctl->sc_unacked_ring_sz * sizeof(ctl->sc_unacked_ring[0]);
+    size += ctl->sc_lost_recs_sz * sizeof(ctl->sc_lost_recs[0]);
 
     for (n = 0; n < sizeof(queues) / sizeof(queues[0]); ++n)
         TAILQ_FOREACH(packet_out, &queues[n], po_next)
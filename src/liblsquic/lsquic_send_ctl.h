@@ -21,6 +21,15 @@ struct ver_neg;
 
 enum buf_packet_type { BPT_HIGHEST_PRIO, BPT_OTHER_PRIO, };
 
+/* Record of a packet that was declared lost */
+struct lost_rec
+{
+    lsquic_packno_t     lr_packno;
+    unsigned            lr_epoch;       /* See sc_loss_epoch */
+};
+
+#define SC_N_ACKED_RANGES 8
+
 #define MAX_BPQ_COUNT 10
 struct buf_packet_q
 {
@@ -36,6 +45,7 @@ enum send_ctl_flags {
     SC_SCHED_TICK   = (1 << 4),
     SC_BUFFER_STREAM= (1 << 5),
     SC_WAS_QUIET    = (1 << 6),
+    SC_PRR          = (1 << 7),
 };
 
 typedef struct lsquic_send_ctl {
@@ -47,13 +57,31 @@ typedef struct lsquic_send_ctl {
     enum send_ctl_flags             sc_flags;
     unsigned                        sc_n_stop_waiting;
     struct lsquic_packets_tailq     sc_unacked_packets;
+    /* Unacked packets are also indexed by packet number: packet N is in
+     * slot N & (sc_unacked_ring_sz - 1).  The ring is large enough to
+     * hold all packet numbers from the first to the last unacked packet,
+     * so that each ACK range maps directly to ring slots.
+     */
+    struct lsquic_packet_out      **sc_unacked_ring;
+    unsigned                        sc_unacked_ring_sz;
+    /* The largest ranges of the newest ACK frame processed so far.  Packets
+     * in them are no longer unacked, so they need not be looked up again
+     * when the peer repeats the ranges.
+     */
+    struct lsquic_packno_range      sc_acked_ranges[SC_N_ACKED_RANGES];
+    unsigned                        sc_n_acked_ranges;
     lsquic_packno_t                 sc_largest_acked_packno;
     lsquic_time_t                   sc_largest_acked_sent_time;
     unsigned                        sc_bytes_out;
     unsigned                        sc_bytes_unacked_retx;
     unsigned                        sc_bytes_scheduled;
     unsigned                        sc_pack_size;
-    struct lsquic_cubic             sc_cubic;
+    union {
+        struct lsquic_cubic         cubic;
+        struct lsquic_bbr           bbr;
+        struct cong_user            user;
+    }                               sc_cong_u;
+    const struct cong_ctl_if       *sc_ci;
     struct lsquic_engine_public    *sc_enpub;
     unsigned                        sc_bytes_unacked_all;
     unsigned                        sc_n_in_flight_all;
@@ -88,6 +116,57 @@ typedef struct lsquic_send_ctl {
      */
     lsquic_packno_t                 sc_largest_acked;
     lsquic_time_t                   sc_loss_to;
+    /* RACK state: the most recently sent packet that has been acked, the
+     * RTT measured using it, and the reordering window.  A packet sent
+     * before it is lost if it has not been acked within RTT plus the
+     * reordering window.  The window is in eighths of RTT; it grows when
+     * spurious losses are detected.
+     */
+    struct {
+        lsquic_packno_t     packno;
+        lsquic_time_t       sent;
+        lsquic_time_t       rtt;
+        unsigned            reo_wnd_mult;
+        unsigned            reo_wnd_persist;
+        /* Reordering window is increased at most once per round trip: this
+         * is the largest packet number sent at the time of last increase.
+         */
+        lsquic_packno_t     reo_wnd_incr_packno;
+        int                 reordering_seen;
+    }                               sc_rack;
+    /* Packets that have been declared lost recently, sorted by packet
+     * number.  If one of them is acked later, the loss was spurious.
+     */
+    struct lost_rec                *sc_lost_recs;
+    unsigned                        sc_n_lost_recs;
+    unsigned                        sc_lost_recs_sz;
+    /* Each loss event and retransmission timeout begins a new loss epoch.
+     * If all packets declared lost in the latest epoch are acked later,
+     * the congestion controller is told to undo its reaction to it.
+     */
+    struct {
+        unsigned            id;
+        unsigned            n_lost;     /* Not yet acked or given up on */
+        lsquic_packno_t     prev_cutback;   /* To restore lsac on undo */
+        enum {
+            LE_CAN_UNDO = 1 << 0,
+            LE_RTO      = 1 << 1,
+        }                   flags;
+    }                               sc_loss_epoch;
+    /* Proportional Rate Reduction (RFC 6937).  During recovery, sending
+     * is clocked by the bytes the peer reports delivered, so that bytes in
+     * flight are brought down to ssthresh gradually instead of sending
+     * stopping until they drop below the new cwnd.  Bytes sent include
+     * bytes scheduled and bytes out.  `recover_fs' is zero when PRR is not
+     * in effect.
+     */
+    struct {
+        unsigned            recover_fs;     /* Bytes in flight at loss */
+        unsigned            ssthresh;       /* cwnd right after loss */
+        unsigned            delivered;
+        unsigned            out;            /* Sent during recovery */
+        unsigned            ssrb_limit;     /* Slow start reduction bound */
+    }                               sc_prr;
     struct
     {
         uint32_t                stream_id;
@@ -100,7 +179,10 @@ typedef struct lsquic_send_ctl {
     struct {
         unsigned            n_total_sent,
                             n_resent,
-                            n_delayed;
+                            n_delayed,
+                            n_lost,
+                            n_spurious,
+                            n_undos;
     }                               sc_stats;
 #endif
 } lsquic_send_ctl_t;
@@ -47,7 +47,9 @@
 #include "lsquic_engine_public.h"
 #include "lsquic_senhist.h"
 #include "lsquic_pacer.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
 #include "lsquic_send_ctl.h"
 #include "lsquic_headers.h"
 #include "lsquic_ev_log.h"
@@ -694,14 +696,16 @@ lsquic_stream_rst_frame_sent (lsquic_stream_t *stream)
 
 
 static size_t
-read_uh (lsquic_stream_t *stream, unsigned char *dst, size_t len)
+read_uh (lsquic_stream_t *stream,
+        size_t (*readf)(void *, const unsigned char *, size_t, int), void *ctx)
 {
     struct http1x_headers *h1h = stream->uh->uh_hset;
-    size_t n_avail = h1h->h1h_size - h1h->h1h_off;
-    if (n_avail < len)
-        len = n_avail;
-    memcpy(dst, h1h->h1h_buf + h1h->h1h_off, len);
-    h1h->h1h_off += len;
+    size_t nread;
+
+    nread = readf(ctx, (unsigned char *) h1h->h1h_buf + h1h->h1h_off,
+                h1h->h1h_size - h1h->h1h_off,
+                (stream->stream_flags & STREAM_HEAD_IN_FIN) > 0);
+    h1h->h1h_off += nread;
     if (h1h->h1h_off == h1h->h1h_size)
     {
         LSQ_DEBUG("read all uncompressed headers for stream %u", stream->id);
@@ -712,37 +716,26 @@ read_uh (lsquic_stream_t *stream, unsigned char *dst, size_t len)
             SM_HISTORY_APPEND(stream, SHE_REACH_FIN);
         }
     }
-    return len;
+    return nread;
 }
 
 
-/* This function returns 0 when EOF is reached.
+/* Offer data to `readf' until it consumes less than it is given or until
+ * there is no more data to read.  Data from incoming frames is passed to
+ * `readf' directly, without copying.
+ *
+ * This function returns 0 when EOF is reached.
  */
 ssize_t
-lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
-                     int iovcnt)
+lsquic_stream_readf (struct lsquic_stream *stream,
+        size_t (*readf)(void *, const unsigned char *, size_t, int), void *ctx)
 {
-    size_t total_nread, nread;
-    int processed_frames, read_unc_headers, iovidx;
-    unsigned char *p, *end;
+    struct data_frame *data_frame;
+    size_t total_nread, nread, navail;
+    int processed_frames, read_unc_headers, fin;
 
     SM_HISTORY_APPEND(stream, SHE_USER_READ);
 
-#define NEXT_IOV() do {                                             \
-    ++iovidx;                                                       \
-    while (iovidx < iovcnt && 0 == iov[iovidx].iov_len)             \
-        ++iovidx;                                                   \
-    if (iovidx < iovcnt)                                            \
-    {                                                               \
-        p = iov[iovidx].iov_base;                                   \
-        end = p + iov[iovidx].iov_len;                              \
-    }                                                               \
-    else                                                            \
-        p = end = NULL;                                             \
-} while (0)
-
-#define AVAIL() (end - p)
-
     if (stream->stream_flags & STREAM_RST_FLAGS)
     {
         errno = ECONNRESET;
@@ -758,29 +751,15 @@ lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
 
     total_nread = 0;
     processed_frames = 0;
-
-    iovidx = -1;
-    NEXT_IOV();
+    read_unc_headers = 0;
 
     if (stream->uh)
     {
         if (stream->uh->uh_flags & UH_H1H)
         {
-            if (AVAIL())
-            {
-                read_unc_headers = 1;
-                do
-                {
-                    nread = read_uh(stream, p, AVAIL());
-                    p += nread;
-                    total_nread += nread;
-                    if (p == end)
-                        NEXT_IOV();
-                }
-                while (stream->uh && AVAIL());
-            }
-            else
-                read_unc_headers = 0;
+            nread = read_uh(stream, readf, ctx);
+            read_unc_headers = nread > 0 || !stream->uh;
+            total_nread += nread;
         }
         else
         {
@@ -788,25 +767,23 @@ lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
             return -1;
         }
     }
-    else
-        read_unc_headers = 0;
 
-    struct data_frame *data_frame;
-    while (AVAIL() && (data_frame = stream->data_in->di_if->di_get_frame(stream->data_in, stream->read_offset)))
+    /* Stream data follows the headers */
+    while (!stream->uh && (data_frame = stream->data_in->di_if->di_get_frame(
+                                        stream->data_in, stream->read_offset)))
     {
+        navail = data_frame->df_size - data_frame->df_read_off;
+        nread = readf(ctx, data_frame->df_data + data_frame->df_read_off,
+                                                navail, data_frame->df_fin);
+        if (nread == 0 && navail > 0)
+            break;
         ++processed_frames;
-        size_t navail = data_frame->df_size - data_frame->df_read_off;
-        size_t ntowrite = AVAIL();
-        if (navail < ntowrite)
-            ntowrite = navail;
-        memcpy(p, data_frame->df_data + data_frame->df_read_off, ntowrite);
-        p += ntowrite;
-        data_frame->df_read_off += ntowrite;
-        stream->read_offset += ntowrite;
-        total_nread += ntowrite;
+        data_frame->df_read_off += nread;
+        stream->read_offset += nread;
+        total_nread += nread;
         if (data_frame->df_read_off == data_frame->df_size)
         {
-            const int fin = data_frame->df_fin;
+            fin = data_frame->df_fin;
             stream->data_in->di_if->di_frame_done(stream->data_in, data_frame);
             if ((stream->stream_flags & STREAM_AUTOSWITCH) &&
                     (stream->data_in->di_flags & DI_SWITCH_IMPL))
@@ -825,8 +802,8 @@ lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
                 break;
             }
         }
-        if (p == end)
-            NEXT_IOV();
+        else
+            break;
     }
 
     LSQ_DEBUG("%s: read %zd bytes, read offset %"PRIu64, __func__,
@@ -857,6 +834,59 @@ lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
 }
 
 
+struct readv_ctx
+{
+    const struct iovec     *iov;
+    const struct iovec     *end;
+    unsigned char          *p;      /* Write position in current iovec */
+};
+
+
+static size_t
+readv_f (void *ctx_p, const unsigned char *buf, size_t len, int fin)
+{
+    struct readv_ctx *const ctx = ctx_p;
+    const unsigned char *const buf_end = buf + len;
+    size_t ntocopy;
+
+    while (buf < buf_end && ctx->iov < ctx->end)
+    {
+        ntocopy = (unsigned char *) ctx->iov->iov_base + ctx->iov->iov_len
+                                                                    - ctx->p;
+        if (ntocopy > (size_t) (buf_end - buf))
+            ntocopy = buf_end - buf;
+        memcpy(ctx->p, buf, ntocopy);
+        ctx->p += ntocopy;
+        buf += ntocopy;
+        if (ctx->p == (unsigned char *) ctx->iov->iov_base
+                                                    + ctx->iov->iov_len)
+        {
+            ++ctx->iov;
+            if (ctx->iov < ctx->end)
+                ctx->p = ctx->iov->iov_base;
+        }
+    }
+
+    return len - (buf_end - buf);
+}
+
+
+/* This function returns 0 when EOF is reached.
+ */
+ssize_t
+lsquic_stream_readv (lsquic_stream_t *stream, const struct iovec *iov,
+                     int iovcnt)
+{
+    struct readv_ctx ctx = {
+        .iov    = iov,
+        .end    = iov + iovcnt,
+        .p      = iovcnt > 0 ? iov[0].iov_base : NULL,
+    };
+
+    return lsquic_stream_readf(stream, readv_f, &ctx);
+}
+
+
 ssize_t
 lsquic_stream_read (lsquic_stream_t *stream, void *buf, size_t len)
 {
@@ -392,6 +392,29 @@ static const struct encode_el encode_table[257] =
     { 0x3fffffff,    30}    //    EOS (256)
 };
 
+/* Code lengths in bits, same as in encode_table.  This compact copy is
+ * summed up by lshpack_enc_huff_len().
+ */
+static const uint8_t encode_bits[256] =
+{
+    13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28,
+    28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+     6, 10, 10, 12, 13,  6,  8, 11, 10, 10,  8, 11,  8,  6,  6,  6,
+     5,  5,  5,  6,  6,  6,  6,  6,  6,  6,  7,  8, 15,  6, 12, 10,
+    13,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  8,  7,  8, 13, 19, 13, 14,  6,
+    15,  5,  6,  5,  6,  5,  6,  6,  6,  5,  7,  7,  6,  6,  6,  5,
+     6,  7,  6,  5,  5,  6,  7,  7,  7,  7,  7, 15, 11, 14, 13, 28,
+    20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23,
+    24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,
+    22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23,
+    21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,
+    26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,
+    19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,
+    20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23,
+    26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,
+};
+
 
 struct decode_el
 {
@@ -5268,6 +5291,1443 @@ static const struct decode_el decode_tables[256][16] =
     },
 };
 
+/* The table-driven decoder looks up HDEC_TABLE_BITS bits of input at a
+ * time.  Since the shortest code is 5 bits long, each lookup yields up to
+ * two symbols.  Codes longer than HDEC_TABLE_BITS bits are decoded using
+ * the hdec_long_* tables: the HPACK Huffman code is canonical, so all
+ * codes of the same length are consecutive numbers.
+ */
+#define HDEC_TABLE_BITS 12
+
+struct hdec_el
+{
+    uint8_t len1;       /* Length of the first code; zero if it is long */
+    uint8_t len;        /* Length of both codes */
+    uint8_t sym[2];
+};
+
+struct hdec_long_el
+{
+    uint32_t first;     /* First code of this length */
+    uint16_t count;     /* Number of codes of this length */
+    uint16_t offset;    /* Index of first symbol in hdec_long_syms */
+};
+
+static const struct hdec_el hdec_table[1 << HDEC_TABLE_BITS] =
+{
+    { 5, 10, {  48,  48 } }, { 5, 10, {  48,  48 } }, { 5, 10, {  48,  48 } },
+    { 5, 10, {  48,  48 } }, { 5, 10, {  48,  49 } }, { 5, 10, {  48,  49 } },
+    { 5, 10, {  48,  49 } }, { 5, 10, {  48,  49 } }, { 5, 10, {  48,  50 } },
+    { 5, 10, {  48,  50 } }, { 5, 10, {  48,  50 } }, { 5, 10, {  48,  50 } },
+    { 5, 10, {  48,  97 } }, { 5, 10, {  48,  97 } }, { 5, 10, {  48,  97 } },
+    { 5, 10, {  48,  97 } }, { 5, 10, {  48,  99 } }, { 5, 10, {  48,  99 } },
+    { 5, 10, {  48,  99 } }, { 5, 10, {  48,  99 } }, { 5, 10, {  48, 101 } },
+    { 5, 10, {  48, 101 } }, { 5, 10, {  48, 101 } }, { 5, 10, {  48, 101 } },
+    { 5, 10, {  48, 105 } }, { 5, 10, {  48, 105 } }, { 5, 10, {  48, 105 } },
+    { 5, 10, {  48, 105 } }, { 5, 10, {  48, 111 } }, { 5, 10, {  48, 111 } },
+    { 5, 10, {  48, 111 } }, { 5, 10, {  48, 111 } }, { 5, 10, {  48, 115 } },
+    { 5, 10, {  48, 115 } }, { 5, 10, {  48, 115 } }, { 5, 10, {  48, 115 } },
+    { 5, 10, {  48, 116 } }, { 5, 10, {  48, 116 } }, { 5, 10, {  48, 116 } },
+    { 5, 10, {  48, 116 } }, { 5, 11, {  48,  32 } }, { 5, 11, {  48,  32 } },
+    { 5, 11, {  48,  37 } }, { 5, 11, {  48,  37 } }, { 5, 11, {  48,  45 } },
+    { 5, 11, {  48,  45 } }, { 5, 11, {  48,  46 } }, { 5, 11, {  48,  46 } },
+    { 5, 11, {  48,  47 } }, { 5, 11, {  48,  47 } }, { 5, 11, {  48,  51 } },
+    { 5, 11, {  48,  51 } }, { 5, 11, {  48,  52 } }, { 5, 11, {  48,  52 } },
+    { 5, 11, {  48,  53 } }, { 5, 11, {  48,  53 } }, { 5, 11, {  48,  54 } },
+    { 5, 11, {  48,  54 } }, { 5, 11, {  48,  55 } }, { 5, 11, {  48,  55 } },
+    { 5, 11, {  48,  56 } }, { 5, 11, {  48,  56 } }, { 5, 11, {  48,  57 } },
+    { 5, 11, {  48,  57 } }, { 5, 11, {  48,  61 } }, { 5, 11, {  48,  61 } },
+    { 5, 11, {  48,  65 } }, { 5, 11, {  48,  65 } }, { 5, 11, {  48,  95 } },
+    { 5, 11, {  48,  95 } }, { 5, 11, {  48,  98 } }, { 5, 11, {  48,  98 } },
+    { 5, 11, {  48, 100 } }, { 5, 11, {  48, 100 } }, { 5, 11, {  48, 102 } },
+    { 5, 11, {  48, 102 } }, { 5, 11, {  48, 103 } }, { 5, 11, {  48, 103 } },
+    { 5, 11, {  48, 104 } }, { 5, 11, {  48, 104 } }, { 5, 11, {  48, 108 } },
+    { 5, 11, {  48, 108 } }, { 5, 11, {  48, 109 } }, { 5, 11, {  48, 109 } },
+    { 5, 11, {  48, 110 } }, { 5, 11, {  48, 110 } }, { 5, 11, {  48, 112 } },
+    { 5, 11, {  48, 112 } }, { 5, 11, {  48, 114 } }, { 5, 11, {  48, 114 } },
+    { 5, 11, {  48, 117 } }, { 5, 11, {  48, 117 } }, { 5, 12, {  48,  58 } },
+    { 5, 12, {  48,  66 } }, { 5, 12, {  48,  67 } }, { 5, 12, {  48,  68 } },
+    { 5, 12, {  48,  69 } }, { 5, 12, {  48,  70 } }, { 5, 12, {  48,  71 } },
+    { 5, 12, {  48,  72 } }, { 5, 12, {  48,  73 } }, { 5, 12, {  48,  74 } },
+    { 5, 12, {  48,  75 } }, { 5, 12, {  48,  76 } }, { 5, 12, {  48,  77 } },
+    { 5, 12, {  48,  78 } }, { 5, 12, {  48,  79 } }, { 5, 12, {  48,  80 } },
+    { 5, 12, {  48,  81 } }, { 5, 12, {  48,  82 } }, { 5, 12, {  48,  83 } },
+    { 5, 12, {  48,  84 } }, { 5, 12, {  48,  85 } }, { 5, 12, {  48,  86 } },
+    { 5, 12, {  48,  87 } }, { 5, 12, {  48,  89 } }, { 5, 12, {  48, 106 } },
+    { 5, 12, {  48, 107 } }, { 5, 12, {  48, 113 } }, { 5, 12, {  48, 118 } },
+    { 5, 12, {  48, 119 } }, { 5, 12, {  48, 120 } }, { 5, 12, {  48, 121 } },
+    { 5, 12, {  48, 122 } }, { 5,  5, {  48,   0 } }, { 5,  5, {  48,   0 } },
+    { 5,  5, {  48,   0 } }, { 5,  5, {  48,   0 } }, { 5, 10, {  49,  48 } },
+    { 5, 10, {  49,  48 } }, { 5, 10, {  49,  48 } }, { 5, 10, {  49,  48 } },
+    { 5, 10, {  49,  49 } }, { 5, 10, {  49,  49 } }, { 5, 10, {  49,  49 } },
+    { 5, 10, {  49,  49 } }, { 5, 10, {  49,  50 } }, { 5, 10, {  49,  50 } },
+    { 5, 10, {  49,  50 } }, { 5, 10, {  49,  50 } }, { 5, 10, {  49,  97 } },
+    { 5, 10, {  49,  97 } }, { 5, 10, {  49,  97 } }, { 5, 10, {  49,  97 } },
+    { 5, 10, {  49,  99 } }, { 5, 10, {  49,  99 } }, { 5, 10, {  49,  99 } },
+    { 5, 10, {  49,  99 } }, { 5, 10, {  49, 101 } }, { 5, 10, {  49, 101 } },
+    { 5, 10, {  49, 101 } }, { 5, 10, {  49, 101 } }, { 5, 10, {  49, 105 } },
+    { 5, 10, {  49, 105 } }, { 5, 10, {  49, 105 } }, { 5, 10, {  49, 105 } },
+    { 5, 10, {  49, 111 } }, { 5, 10, {  49, 111 } }, { 5, 10, {  49, 111 } },
+    { 5, 10, {  49, 111 } }, { 5, 10, {  49, 115 } }, { 5, 10, {  49, 115 } },
+    { 5, 10, {  49, 115 } }, { 5, 10, {  49, 115 } }, { 5, 10, {  49, 116 } },
+    { 5, 10, {  49, 116 } }, { 5, 10, {  49, 116 } }, { 5, 10, {  49, 116 } },
+    { 5, 11, {  49,  32 } }, { 5, 11, {  49,  32 } }, { 5, 11, {  49,  37 } },
+    { 5, 11, {  49,  37 } }, { 5, 11, {  49,  45 } }, { 5, 11, {  49,  45 } },
+    { 5, 11, {  49,  46 } }, { 5, 11, {  49,  46 } }, { 5, 11, {  49,  47 } },
+    { 5, 11, {  49,  47 } }, { 5, 11, {  49,  51 } }, { 5, 11, {  49,  51 } },
+    { 5, 11, {  49,  52 } }, { 5, 11, {  49,  52 } }, { 5, 11, {  49,  53 } },
+    { 5, 11, {  49,  53 } }, { 5, 11, {  49,  54 } }, { 5, 11, {  49,  54 } },
+    { 5, 11, {  49,  55 } }, { 5, 11, {  49,  55 } }, { 5, 11, {  49,  56 } },
+    { 5, 11, {  49,  56 } }, { 5, 11, {  49,  57 } }, { 5, 11, {  49,  57 } },
+    { 5, 11, {  49,  61 } }, { 5, 11, {  49,  61 } }, { 5, 11, {  49,  65 } },
+    { 5, 11, {  49,  65 } }, { 5, 11, {  49,  95 } }, { 5, 11, {  49,  95 } },
+    { 5, 11, {  49,  98 } }, { 5, 11, {  49,  98 } }, { 5, 11, {  49, 100 } },
+    { 5, 11, {  49, 100 } }, { 5, 11, {  49, 102 } }, { 5, 11, {  49, 102 } },
+    { 5, 11, {  49, 103 } }, { 5, 11, {  49, 103 } }, { 5, 11, {  49, 104 } },
+    { 5, 11, {  49, 104 } }, { 5, 11, {  49, 108 } }, { 5, 11, {  49, 108 } },
+    { 5, 11, {  49, 109 } }, { 5, 11, {  49, 109 } }, { 5, 11, {  49, 110 } },
+    { 5, 11, {  49, 110 } }, { 5, 11, {  49, 112 } }, { 5, 11, {  49, 112 } },
+    { 5, 11, {  49, 114 } }, { 5, 11, {  49, 114 } }, { 5, 11, {  49, 117 } },
+    { 5, 11, {  49, 117 } }, { 5, 12, {  49,  58 } }, { 5, 12, {  49,  66 } },
+    { 5, 12, {  49,  67 } }, { 5, 12, {  49,  68 } }, { 5, 12, {  49,  69 } },
+    { 5, 12, {  49,  70 } }, { 5, 12, {  49,  71 } }, { 5, 12, {  49,  72 } },
+    { 5, 12, {  49,  73 } }, { 5, 12, {  49,  74 } }, { 5, 12, {  49,  75 } },
+    { 5, 12, {  49,  76 } }, { 5, 12, {  49,  77 } }, { 5, 12, {  49,  78 } },
+    { 5, 12, {  49,  79 } }, { 5, 12, {  49,  80 } }, { 5, 12, {  49,  81 } },
+    { 5, 12, {  49,  82 } }, { 5, 12, {  49,  83 } }, { 5, 12, {  49,  84 } },
+    { 5, 12, {  49,  85 } }, { 5, 12, {  49,  86 } }, { 5, 12, {  49,  87 } },
+    { 5, 12, {  49,  89 } }, { 5, 12, {  49, 106 } }, { 5, 12, {  49, 107 } },
+    { 5, 12, {  49, 113 } }, { 5, 12, {  49, 118 } }, { 5, 12, {  49, 119 } },
+    { 5, 12, {  49, 120 } }, { 5, 12, {  49, 121 } }, { 5, 12, {  49, 122 } },
+    { 5,  5, {  49,   0 } }, { 5,  5, {  49,   0 } }, { 5,  5, {  49,   0 } },
+    { 5,  5, {  49,   0 } }, { 5, 10, {  50,  48 } }, { 5, 10, {  50,  48 } },
+    { 5, 10, {  50,  48 } }, { 5, 10, {  50,  48 } }, { 5, 10, {  50,  49 } },
+    { 5, 10, {  50,  49 } }, { 5, 10, {  50,  49 } }, { 5, 10, {  50,  49 } },
+    { 5, 10, {  50,  50 } }, { 5, 10, {  50,  50 } }, { 5, 10, {  50,  50 } },
+    { 5, 10, {  50,  50 } }, { 5, 10, {  50,  97 } }, { 5, 10, {  50,  97 } },
+    { 5, 10, {  50,  97 } }, { 5, 10, {  50,  97 } }, { 5, 10, {  50,  99 } },
+    { 5, 10, {  50,  99 } }, { 5, 10, {  50,  99 } }, { 5, 10, {  50,  99 } },
+    { 5, 10, {  50, 101 } }, { 5, 10, {  50, 101 } }, { 5, 10, {  50, 101 } },
+    { 5, 10, {  50, 101 } }, { 5, 10, {  50, 105 } }, { 5, 10, {  50, 105 } },
+    { 5, 10, {  50, 105 } }, { 5, 10, {  50, 105 } }, { 5, 10, {  50, 111 } },
+    { 5, 10, {  50, 111 } }, { 5, 10, {  50, 111 } }, { 5, 10, {  50, 111 } },
+    { 5, 10, {  50, 115 } }, { 5, 10, {  50, 115 } }, { 5, 10, {  50, 115 } },
+    { 5, 10, {  50, 115 } }, { 5, 10, {  50, 116 } }, { 5, 10, {  50, 116 } },
+    { 5, 10, {  50, 116 } }, { 5, 10, {  50, 116 } }, { 5, 11, {  50,  32 } },
+    { 5, 11, {  50,  32 } }, { 5, 11, {  50,  37 } }, { 5, 11, {  50,  37 } },
+    { 5, 11, {  50,  45 } }, { 5, 11, {  50,  45 } }, { 5, 11, {  50,  46 } },
+    { 5, 11, {  50,  46 } }, { 5, 11, {  50,  47 } }, { 5, 11, {  50,  47 } },
+    { 5, 11, {  50,  51 } }, { 5, 11, {  50,  51 } }, { 5, 11, {  50,  52 } },
+    { 5, 11, {  50,  52 } }, { 5, 11, {  50,  53 } }, { 5, 11, {  50,  53 } },
+    { 5, 11, {  50,  54 } }, { 5, 11, {  50,  54 } }, { 5, 11, {  50,  55 } },
+    { 5, 11, {  50,  55 } }, { 5, 11, {  50,  56 } }, { 5, 11, {  50,  56 } },
+    { 5, 11, {  50,  57 } }, { 5, 11, {  50,  57 } }, { 5, 11, {  50,  61 } },
+    { 5, 11, {  50,  61 } }, { 5, 11, {  50,  65 } }, { 5, 11, {  50,  65 } },
+    { 5, 11, {  50,  95 } }, { 5, 11, {  50,  95 } }, { 5, 11, {  50,  98 } },
+    { 5, 11, {  50,  98 } }, { 5, 11, {  50, 100 } }, { 5, 11, {  50, 100 } },
+    { 5, 11, {  50, 102 } }, { 5, 11, {  50, 102 } }, { 5, 11, {  50, 103 } },
+    { 5, 11, {  50, 103 } }, { 5, 11, {  50, 104 } }, { 5, 11, {  50, 104 } },
+    { 5, 11, {  50, 108 } }, { 5, 11, {  50, 108 } }, { 5, 11, {  50, 109 } },
+    { 5, 11, {  50, 109 } }, { 5, 11, {  50, 110 } }, { 5, 11, {  50, 110 } },
+    { 5, 11, {  50, 112 } }, { 5, 11, {  50, 112 } }, { 5, 11, {  50, 114 } },
+    { 5, 11, {  50, 114 } }, { 5, 11, {  50, 117 } }, { 5, 11, {  50, 117 } },
+    { 5, 12, {  50,  58 } }, { 5, 12, {  50,  66 } }, { 5, 12, {  50,  67 } },
+    { 5, 12, {  50,  68 } }, { 5, 12, {  50,  69 } }, { 5, 12, {  50,  70 } },
+    { 5, 12, {  50,  71 } }, { 5, 12, {  50,  72 } }, { 5, 12, {  50,  73 } },
+    { 5, 12, {  50,  74 } }, { 5, 12, {  50,  75 } }, { 5, 12, {  50,  76 } },
+    { 5, 12, {  50,  77 } }, { 5, 12, {  50,  78 } }, { 5, 12, {  50,  79 } },
+    { 5, 12, {  50,  80 } }, { 5, 12, {  50,  81 } }, { 5, 12, {  50,  82 } },
+    { 5, 12, {  50,  83 } }, { 5, 12, {  50,  84 } }, { 5, 12, {  50,  85 } },
+    { 5, 12, {  50,  86 } }, { 5, 12, {  50,  87 } }, { 5, 12, {  50,  89 } },
+    { 5, 12, {  50, 106 } }, { 5, 12, {  50, 107 } }, { 5, 12, {  50, 113 } },
+    { 5, 12, {  50, 118 } }, { 5, 12, {  50, 119 } }, { 5, 12, {  50, 120 } },
+    { 5, 12, {  50, 121 } }, { 5, 12, {  50, 122 } }, { 5,  5, {  50,   0 } },
+    { 5,  5, {  50,   0 } }, { 5,  5, {  50,   0 } }, { 5,  5, {  50,   0 } },
+    { 5, 10, {  97,  48 } }, { 5, 10, {  97,  48 } }, { 5, 10, {  97,  48 } },
+    { 5, 10, {  97,  48 } }, { 5, 10, {  97,  49 } }, { 5, 10, {  97,  49 } },
+    { 5, 10, {  97,  49 } }, { 5, 10, {  97,  49 } }, { 5, 10, {  97,  50 } },
+    { 5, 10, {  97,  50 } }, { 5, 10, {  97,  50 } }, { 5, 10, {  97,  50 } },
+    { 5, 10, {  97,  97 } }, { 5, 10, {  97,  97 } }, { 5, 10, {  97,  97 } },
+    { 5, 10, {  97,  97 } }, { 5, 10, {  97,  99 } }, { 5, 10, {  97,  99 } },
+    { 5, 10, {  97,  99 } }, { 5, 10, {  97,  99 } }, { 5, 10, {  97, 101 } },
+    { 5, 10, {  97, 101 } }, { 5, 10, {  97, 101 } }, { 5, 10, {  97, 101 } },
+    { 5, 10, {  97, 105 } }, { 5, 10, {  97, 105 } }, { 5, 10, {  97, 105 } },
+    { 5, 10, {  97, 105 } }, { 5, 10, {  97, 111 } }, { 5, 10, {  97, 111 } },
+    { 5, 10, {  97, 111 } }, { 5, 10, {  97, 111 } }, { 5, 10, {  97, 115 } },
+    { 5, 10, {  97, 115 } }, { 5, 10, {  97, 115 } }, { 5, 10, {  97, 115 } },
+    { 5, 10, {  97, 116 } }, { 5, 10, {  97, 116 } }, { 5, 10, {  97, 116 } },
+    { 5, 10, {  97, 116 } }, { 5, 11, {  97,  32 } }, { 5, 11, {  97,  32 } },
+    { 5, 11, {  97,  37 } }, { 5, 11, {  97,  37 } }, { 5, 11, {  97,  45 } },
+    { 5, 11, {  97,  45 } }, { 5, 11, {  97,  46 } }, { 5, 11, {  97,  46 } },
+    { 5, 11, {  97,  47 } }, { 5, 11, {  97,  47 } }, { 5, 11, {  97,  51 } },
+    { 5, 11, {  97,  51 } }, { 5, 11, {  97,  52 } }, { 5, 11, {  97,  52 } },
+    { 5, 11, {  97,  53 } }, { 5, 11, {  97,  53 } }, { 5, 11, {  97,  54 } },
+    { 5, 11, {  97,  54 } }, { 5, 11, {  97,  55 } }, { 5, 11, {  97,  55 } },
+    { 5, 11, {  97,  56 } }, { 5, 11, {  97,  56 } }, { 5, 11, {  97,  57 } },
+    { 5, 11, {  97,  57 } }, { 5, 11, {  97,  61 } }, { 5, 11, {  97,  61 } },
+    { 5, 11, {  97,  65 } }, { 5, 11, {  97,  65 } }, { 5, 11, {  97,  95 } },
+    { 5, 11, {  97,  95 } }, { 5, 11, {  97,  98 } }, { 5, 11, {  97,  98 } },
+    { 5, 11, {  97, 100 } }, { 5, 11, {  97, 100 } }, { 5, 11, {  97, 102 } },
+    { 5, 11, {  97, 102 } }, { 5, 11, {  97, 103 } }, { 5, 11, {  97, 103 } },
+    { 5, 11, {  97, 104 } }, { 5, 11, {  97, 104 } }, { 5, 11, {  97, 108 } },
+    { 5, 11, {  97, 108 } }, { 5, 11, {  97, 109 } }, { 5, 11, {  97, 109 } },
+    { 5, 11, {  97, 110 } }, { 5, 11, {  97, 110 } }, { 5, 11, {  97, 112 } },
+    { 5, 11, {  97, 112 } }, { 5, 11, {  97, 114 } }, { 5, 11, {  97, 114 } },
+    { 5, 11, {  97, 117 } }, { 5, 11, {  97, 117 } }, { 5, 12, {  97,  58 } },
+    { 5, 12, {  97,  66 } }, { 5, 12, {  97,  67 } }, { 5, 12, {  97,  68 } },
+    { 5, 12, {  97,  69 } }, { 5, 12, {  97,  70 } }, { 5, 12, {  97,  71 } },
+    { 5, 12, {  97,  72 } }, { 5, 12, {  97,  73 } }, { 5, 12, {  97,  74 } },
+    { 5, 12, {  97,  75 } }, { 5, 12, {  97,  76 } }, { 5, 12, {  97,  77 } },
+    { 5, 12, {  97,  78 } }, { 5, 12, {  97,  79 } }, { 5, 12, {  97,  80 } },
+    { 5, 12, {  97,  81 } }, { 5, 12, {  97,  82 } }, { 5, 12, {  97,  83 } },
+    { 5, 12, {  97,  84 } }, { 5, 12, {  97,  85 } }, { 5, 12, {  97,  86 } },
+    { 5, 12, {  97,  87 } }, { 5, 12, {  97,  89 } }, { 5, 12, {  97, 106 } },
+    { 5, 12, {  97, 107 } }, { 5, 12, {  97, 113 } }, { 5, 12, {  97, 118 } },
+    { 5, 12, {  97, 119 } }, { 5, 12, {  97, 120 } }, { 5, 12, {  97, 121 } },
+    { 5, 12, {  97, 122 } }, { 5,  5, {  97,   0 } }, { 5,  5, {  97,   0 } },
+    { 5,  5, {  97,   0 } }, { 5,  5, {  97,   0 } }, { 5, 10, {  99,  48 } },
+    { 5, 10, {  99,  48 } }, { 5, 10, {  99,  48 } }, { 5, 10, {  99,  48 } },
+    { 5, 10, {  99,  49 } }, { 5, 10, {  99,  49 } }, { 5, 10, {  99,  49 } },
+    { 5, 10, {  99,  49 } }, { 5, 10, {  99,  50 } }, { 5, 10, {  99,  50 } },
+    { 5, 10, {  99,  50 } }, { 5, 10, {  99,  50 } }, { 5, 10, {  99,  97 } },
+    { 5, 10, {  99,  97 } }, { 5, 10, {  99,  97 } }, { 5, 10, {  99,  97 } },
+    { 5, 10, {  99,  99 } }, { 5, 10, {  99,  99 } }, { 5, 10, {  99,  99 } },
+    { 5, 10, {  99,  99 } }, { 5, 10, {  99, 101 } }, { 5, 10, {  99, 101 } },
+    { 5, 10, {  99, 101 } }, { 5, 10, {  99, 101 } }, { 5, 10, {  99, 105 } },
+    { 5, 10, {  99, 105 } }, { 5, 10, {  99, 105 } }, { 5, 10, {  99, 105 } },
+    { 5, 10, {  99, 111 } }, { 5, 10, {  99, 111 } }, { 5, 10, {  99, 111 } },
+    { 5, 10, {  99, 111 } }, { 5, 10, {  99, 115 } }, { 5, 10, {  99, 115 } },
+    { 5, 10, {  99, 115 } }, { 5, 10, {  99, 115 } }, { 5, 10, {  99, 116 } },
+    { 5, 10, {  99, 116 } }, { 5, 10, {  99, 116 } }, { 5, 10, {  99, 116 } },
+    { 5, 11, {  99,  32 } }, { 5, 11, {  99,  32 } }, { 5, 11, {  99,  37 } },
+    { 5, 11, {  99,  37 } }, { 5, 11, {  99,  45 } }, { 5, 11, {  99,  45 } },
+    { 5, 11, {  99,  46 } }, { 5, 11, {  99,  46 } }, { 5, 11, {  99,  47 } },
+    { 5, 11, {  99,  47 } }, { 5, 11, {  99,  51 } }, { 5, 11, {  99,  51 } },
+    { 5, 11, {  99,  52 } }, { 5, 11, {  99,  52 } }, { 5, 11, {  99,  53 } },
+    { 5, 11, {  99,  53 } }, { 5, 11, {  99,  54 } }, { 5, 11, {  99,  54 } },
+    { 5, 11, {  99,  55 } }, { 5, 11, {  99,  55 } }, { 5, 11, {  99,  56 } },
+    { 5, 11, {  99,  56 } }, { 5, 11, {  99,  57 } }, { 5, 11, {  99,  57 } },
+    { 5, 11, {  99,  61 } }, { 5, 11, {  99,  61 } }, { 5, 11, {  99,  65 } },
+    { 5, 11, {  99,  65 } }, { 5, 11, {  99,  95 } }, { 5, 11, {  99,  95 } },
+    { 5, 11, {  99,  98 } }, { 5, 11, {  99,  98 } }, { 5, 11, {  99, 100 } },
+    { 5, 11, {  99, 100 } }, { 5, 11, {  99, 102 } }, { 5, 11, {  99, 102 } },
+    { 5, 11, {  99, 103 } }, { 5, 11, {  99, 103 } }, { 5, 11, {  99, 104 } },
+    { 5, 11, {  99, 104 } }, { 5, 11, {  99, 108 } }, { 5, 11, {  99, 108 } },
+    { 5, 11, {  99, 109 } }, { 5, 11, {  99, 109 } }, { 5, 11, {  99, 110 } },
+    { 5, 11, {  99, 110 } }, { 5, 11, {  99, 112 } }, { 5, 11, {  99, 112 } },
+    { 5, 11, {  99, 114 } }, { 5, 11, {  99, 114 } }, { 5, 11, {  99, 117 } },
+    { 5, 11, {  99, 117 } }, { 5, 12, {  99,  58 } }, { 5, 12, {  99,  66 } },
+    { 5, 12, {  99,  67 } }, { 5, 12, {  99,  68 } }, { 5, 12, {  99,  69 } },
+    { 5, 12, {  99,  70 } }, { 5, 12, {  99,  71 } }, { 5, 12, {  99,  72 } },
+    { 5, 12, {  99,  73 } }, { 5, 12, {  99,  74 } }, { 5, 12, {  99,  75 } },
+    { 5, 12, {  99,  76 } }, { 5, 12, {  99,  77 } }, { 5, 12, {  99,  78 } },
+    { 5, 12, {  99,  79 } }, { 5, 12, {  99,  80 } }, { 5, 12, {  99,  81 } },
+    { 5, 12, {  99,  82 } }, { 5, 12, {  99,  83 } }, { 5, 12, {  99,  84 } },
+    { 5, 12, {  99,  85 } }, { 5, 12, {  99,  86 } }, { 5, 12, {  99,  87 } },
+    { 5, 12, {  99,  89 } }, { 5, 12, {  99, 106 } }, { 5, 12, {  99, 107 } },
+    { 5, 12, {  99, 113 } }, { 5, 12, {  99, 118 } }, { 5, 12, {  99, 119 } },
+    { 5, 12, {  99, 120 } }, { 5, 12, {  99, 121 } }, { 5, 12, {  99, 122 } },
+    { 5,  5, {  99,   0 } }, { 5,  5, {  99,   0 } }, { 5,  5, {  99,   0 } },
+    { 5,  5, {  99,   0 } }, { 5, 10, { 101,  48 } }, { 5, 10, { 101,  48 } },
+    { 5, 10, { 101,  48 } }, { 5, 10, { 101,  48 } }, { 5, 10, { 101,  49 } },
+    { 5, 10, { 101,  49 } }, { 5, 10, { 101,  49 } }, { 5, 10, { 101,  49 } },
+    { 5, 10, { 101,  50 } }, { 5, 10, { 101,  50 } }, { 5, 10, { 101,  50 } },
+    { 5, 10, { 101,  50 } }, { 5, 10, { 101,  97 } }, { 5, 10, { 101,  97 } },
+    { 5, 10, { 101,  97 } }, { 5, 10, { 101,  97 } }, { 5, 10, { 101,  99 } },
+    { 5, 10, { 101,  99 } }, { 5, 10, { 101,  99 } }, { 5, 10, { 101,  99 } },
+    { 5, 10, { 101, 101 } }, { 5, 10, { 101, 101 } }, { 5, 10, { 101, 101 } },
+    { 5, 10, { 101, 101 } }, { 5, 10, { 101, 105 } }, { 5, 10, { 101, 105 } },
+    { 5, 10, { 101, 105 } }, { 5, 10, { 101, 105 } }, { 5, 10, { 101, 111 } },
+    { 5, 10, { 101, 111 } }, { 5, 10, { 101, 111 } }, { 5, 10, { 101, 111 } },
+    { 5, 10, { 101, 115 } }, { 5, 10, { 101, 115 } }, { 5, 10, { 101, 115 } },
+    { 5, 10, { 101, 115 } }, { 5, 10, { 101, 116 } }, { 5, 10, { 101, 116 } },
+    { 5, 10, { 101, 116 } }, { 5, 10, { 101, 116 } }, { 5, 11, { 101,  32 } },
+    { 5, 11, { 101,  32 } }, { 5, 11, { 101,  37 } }, { 5, 11, { 101,  37 } },
+    { 5, 11, { 101,  45 } }, { 5, 11, { 101,  45 } }, { 5, 11, { 101,  46 } },
+    { 5, 11, { 101,  46 } }, { 5, 11, { 101,  47 } }, { 5, 11, { 101,  47 } },
+    { 5, 11, { 101,  51 } }, { 5, 11, { 101,  51 } }, { 5, 11, { 101,  52 } },
+    { 5, 11, { 101,  52 } }, { 5, 11, { 101,  53 } }, { 5, 11, { 101,  53 } },
+    { 5, 11, { 101,  54 } }, { 5, 11, { 101,  54 } }, { 5, 11, { 101,  55 } },
+    { 5, 11, { 101,  55 } }, { 5, 11, { 101,  56 } }, { 5, 11, { 101,  56 } },
+    { 5, 11, { 101,  57 } }, { 5, 11, { 101,  57 } }, { 5, 11, { 101,  61 } },
+    { 5, 11, { 101,  61 } }, { 5, 11, { 101,  65 } }, { 5, 11, { 101,  65 } },
+    { 5, 11, { 101,  95 } }, { 5, 11, { 101,  95 } }, { 5, 11, { 101,  98 } },
+    { 5, 11, { 101,  98 } }, { 5, 11, { 101, 100 } }, { 5, 11, { 101, 100 } },
+    { 5, 11, { 101, 102 } }, { 5, 11, { 101, 102 } }, { 5, 11, { 101, 103 } },
+    { 5, 11, { 101, 103 } }, { 5, 11, { 101, 104 } }, { 5, 11, { 101, 104 } },
+    { 5, 11, { 101, 108 } }, { 5, 11, { 101, 108 } }, { 5, 11, { 101, 109 } },
+    { 5, 11, { 101, 109 } }, { 5, 11, { 101, 110 } }, { 5, 11, { 101, 110 } },
+    { 5, 11, { 101, 112 } }, { 5, 11, { 101, 112 } }, { 5, 11, { 101, 114 } },
+    { 5, 11, { 101, 114 } }, { 5, 11, { 101, 117 } }, { 5, 11, { 101, 117 } },
+    { 5, 12, { 101,  58 } }, { 5, 12, { 101,  66 } }, { 5, 12, { 101,  67 } },
+    { 5, 12, { 101,  68 } }, { 5, 12, { 101,  69 } }, { 5, 12, { 101,  70 } },
+    { 5, 12, { 101,  71 } }, { 5, 12, { 101,  72 } }, { 5, 12, { 101,  73 } },
+    { 5, 12, { 101,  74 } }, { 5, 12, { 101,  75 } }, { 5, 12, { 101,  76 } },
+    { 5, 12, { 101,  77 } }, { 5, 12, { 101,  78 } }, { 5, 12, { 101,  79 } },
+    { 5, 12, { 101,  80 } }, { 5, 12, { 101,  81 } }, { 5, 12, { 101,  82 } },
+    { 5, 12, { 101,  83 } }, { 5, 12, { 101,  84 } }, { 5, 12, { 101,  85 } },
+    { 5, 12, { 101,  86 } }, { 5, 12, { 101,  87 } }, { 5, 12, { 101,  89 } },
+    { 5, 12, { 101, 106 } }, { 5, 12, { 101, 107 } }, { 5, 12, { 101, 113 } },
+    { 5, 12, { 101, 118 } }, { 5, 12, { 101, 119 } }, { 5, 12, { 101, 120 } },
+    { 5, 12, { 101, 121 } }, { 5, 12, { 101, 122 } }, { 5,  5, { 101,   0 } },
+    { 5,  5, { 101,   0 } }, { 5,  5, { 101,   0 } }, { 5,  5, { 101,   0 } },
+    { 5, 10, { 105,  48 } }, { 5, 10, { 105,  48 } }, { 5, 10, { 105,  48 } },
+    { 5, 10, { 105,  48 } }, { 5, 10, { 105,  49 } }, { 5, 10, { 105,  49 } },
+    { 5, 10, { 105,  49 } }, { 5, 10, { 105,  49 } }, { 5, 10, { 105,  50 } },
+    { 5, 10, { 105,  50 } }, { 5, 10, { 105,  50 } }, { 5, 10, { 105,  50 } },
+    { 5, 10, { 105,  97 } }, { 5, 10, { 105,  97 } }, { 5, 10, { 105,  97 } },
+    { 5, 10, { 105,  97 } }, { 5, 10, { 105,  99 } }, { 5, 10, { 105,  99 } },
+    { 5, 10, { 105,  99 } }, { 5, 10, { 105,  99 } }, { 5, 10, { 105, 101 } },
+    { 5, 10, { 105, 101 } }, { 5, 10, { 105, 101 } }, { 5, 10, { 105, 101 } },
+    { 5, 10, { 105, 105 } }, { 5, 10, { 105, 105 } }, { 5, 10, { 105, 105 } },
+    { 5, 10, { 105, 105 } }, { 5, 10, { 105, 111 } }, { 5, 10, { 105, 111 } },
+    { 5, 10, { 105, 111 } }, { 5, 10, { 105, 111 } }, { 5, 10, { 105, 115 } },
+    { 5, 10, { 105, 115 } }, { 5, 10, { 105, 115 } }, { 5, 10, { 105, 115 } },
+    { 5, 10, { 105, 116 } }, { 5, 10, { 105, 116 } }, { 5, 10, { 105, 116 } },
+    { 5, 10, { 105, 116 } }, { 5, 11, { 105,  32 } }, { 5, 11, { 105,  32 } },
+    { 5, 11, { 105,  37 } }, { 5, 11, { 105,  37 } }, { 5, 11, { 105,  45 } },
+    { 5, 11, { 105,  45 } }, { 5, 11, { 105,  46 } }, { 5, 11, { 105,  46 } },
+    { 5, 11, { 105,  47 } }, { 5, 11, { 105,  47 } }, { 5, 11, { 105,  51 } },
+    { 5, 11, { 105,  51 } }, { 5, 11, { 105,  52 } }, { 5, 11, { 105,  52 } },
+    { 5, 11, { 105,  53 } }, { 5, 11, { 105,  53 } }, { 5, 11, { 105,  54 } },
+    { 5, 11, { 105,  54 } }, { 5, 11, { 105,  55 } }, { 5, 11, { 105,  55 } },
+    { 5, 11, { 105,  56 } }, { 5, 11, { 105,  56 } }, { 5, 11, { 105,  57 } },
+    { 5, 11, { 105,  57 } }, { 5, 11, { 105,  61 } }, { 5, 11, { 105,  61 } },
+    { 5, 11, { 105,  65 } }, { 5, 11, { 105,  65 } }, { 5, 11, { 105,  95 } },
+    { 5, 11, { 105,  95 } }, { 5, 11, { 105,  98 } }, { 5, 11, { 105,  98 } },
+    { 5, 11, { 105, 100 } }, { 5, 11, { 105, 100 } }, { 5, 11, { 105, 102 } },
+    { 5, 11, { 105, 102 } }, { 5, 11, { 105, 103 } }, { 5, 11, { 105, 103 } },
+    { 5, 11, { 105, 104 } }, { 5, 11, { 105, 104 } }, { 5, 11, { 105, 108 } },
+    { 5, 11, { 105, 108 } }, { 5, 11, { 105, 109 } }, { 5, 11, { 105, 109 } },
+    { 5, 11, { 105, 110 } }, { 5, 11, { 105, 110 } }, { 5, 11, { 105, 112 } },
+    { 5, 11, { 105, 112 } }, { 5, 11, { 105, 114 } }, { 5, 11, { 105, 114 } },
+    { 5, 11, { 105, 117 } }, { 5, 11, { 105, 117 } }, { 5, 12, { 105,  58 } },
+    { 5, 12, { 105,  66 } }, { 5, 12, { 105,  67 } }, { 5, 12, { 105,  68 } },
+    { 5, 12, { 105,  69 } }, { 5, 12, { 105,  70 } }, { 5, 12, { 105,  71 } },
+    { 5, 12, { 105,  72 } }, { 5, 12, { 105,  73 } }, { 5, 12, { 105,  74 } },
+    { 5, 12, { 105,  75 } }, { 5, 12, { 105,  76 } }, { 5, 12, { 105,  77 } },
+    { 5, 12, { 105,  78 } }, { 5, 12, { 105,  79 } }, { 5, 12, { 105,  80 } },
+    { 5, 12, { 105,  81 } }, { 5, 12, { 105,  82 } }, { 5, 12, { 105,  83 } },
+    { 5, 12, { 105,  84 } }, { 5, 12, { 105,  85 } }, { 5, 12, { 105,  86 } },
+    { 5, 12, { 105,  87 } }, { 5, 12, { 105,  89 } }, { 5, 12, { 105, 106 } },
+    { 5, 12, { 105, 107 } }, { 5, 12, { 105, 113 } }, { 5, 12, { 105, 118 } },
+    { 5, 12, { 105, 119 } }, { 5, 12, { 105, 120 } }, { 5, 12, { 105, 121 } },
+    { 5, 12, { 105, 122 } }, { 5,  5, { 105,   0 } }, { 5,  5, { 105,   0 } },
+    { 5,  5, { 105,   0 } }, { 5,  5, { 105,   0 } }, { 5, 10, { 111,  48 } },
+    { 5, 10, { 111,  48 } }, { 5, 10, { 111,  48 } }, { 5, 10, { 111,  48 } },
+    { 5, 10, { 111,  49 } }, { 5, 10, { 111,  49 } }, { 5, 10, { 111,  49 } },
+    { 5, 10, { 111,  49 } }, { 5, 10, { 111,  50 } }, { 5, 10, { 111,  50 } },
+    { 5, 10, { 111,  50 } }, { 5, 10, { 111,  50 } }, { 5, 10, { 111,  97 } },
+    { 5, 10, { 111,  97 } }, { 5, 10, { 111,  97 } }, { 5, 10, { 111,  97 } },
+    { 5, 10, { 111,  99 } }, { 5, 10, { 111,  99 } }, { 5, 10, { 111,  99 } },
+    { 5, 10, { 111,  99 } }, { 5, 10, { 111, 101 } }, { 5, 10, { 111, 101 } },
+    { 5, 10, { 111, 101 } }, { 5, 10, { 111, 101 } }, { 5, 10, { 111, 105 } },
+    { 5, 10, { 111, 105 } }, { 5, 10, { 111, 105 } }, { 5, 10, { 111, 105 } },
+    { 5, 10, { 111, 111 } }, { 5, 10, { 111, 111 } }, { 5, 10, { 111, 111 } },
+    { 5, 10, { 111, 111 } }, { 5, 10, { 111, 115 } }, { 5, 10, { 111, 115 } },
+    { 5, 10, { 111, 115 } }, { 5, 10, { 111, 115 } }, { 5, 10, { 111, 116 } },
+    { 5, 10, { 111, 116 } }, { 5, 10, { 111, 116 } }, { 5, 10, { 111, 116 } },
+    { 5, 11, { 111,  32 } }, { 5, 11, { 111,  32 } }, { 5, 11, { 111,  37 } },
+    { 5, 11, { 111,  37 } }, { 5, 11, { 111,  45 } }, { 5, 11, { 111,  45 } },
+    { 5, 11, { 111,  46 } }, { 5, 11, { 111,  46 } }, { 5, 11, { 111,  47 } },
+    { 5, 11, { 111,  47 } }, { 5, 11, { 111,  51 } }, { 5, 11, { 111,  51 } },
+    { 5, 11, { 111,  52 } }, { 5, 11, { 111,  52 } }, { 5, 11, { 111,  53 } },
+    { 5, 11, { 111,  53 } }, { 5, 11, { 111,  54 } }, { 5, 11, { 111,  54 } },
+    { 5, 11, { 111,  55 } }, { 5, 11, { 111,  55 } }, { 5, 11, { 111,  56 } },
+    { 5, 11, { 111,  56 } }, { 5, 11, { 111,  57 } }, { 5, 11, { 111,  57 } },
+    { 5, 11, { 111,  61 } }, { 5, 11, { 111,  61 } }, { 5, 11, { 111,  65 } },
+    { 5, 11, { 111,  65 } }, { 5, 11, { 111,  95 } }, { 5, 11, { 111,  95 } },
+    { 5, 11, { 111,  98 } }, { 5, 11, { 111,  98 } }, { 5, 11, { 111, 100 } },
+    { 5, 11, { 111, 100 } }, { 5, 11, { 111, 102 } }, { 5, 11, { 111, 102 } },
+    { 5, 11, { 111, 103 } }, { 5, 11, { 111, 103 } }, { 5, 11, { 111, 104 } },
+    { 5, 11, { 111, 104 } }, { 5, 11, { 111, 108 } }, { 5, 11, { 111, 108 } },
+    { 5, 11, { 111, 109 } }, { 5, 11, { 111, 109 } }, { 5, 11, { 111, 110 } },
+    { 5, 11, { 111, 110 } }, { 5, 11, { 111, 112 } }, { 5, 11, { 111, 112 } },
+    { 5, 11, { 111, 114 } }, { 5, 11, { 111, 114 } }, { 5, 11, { 111, 117 } },
+    { 5, 11, { 111, 117 } }, { 5, 12, { 111,  58 } }, { 5, 12, { 111,  66 } },
+    { 5, 12, { 111,  67 } }, { 5, 12, { 111,  68 } }, { 5, 12, { 111,  69 } },
+    { 5, 12, { 111,  70 } }, { 5, 12, { 111,  71 } }, { 5, 12, { 111,  72 } },
+    { 5, 12, { 111,  73 } }, { 5, 12, { 111,  74 } }, { 5, 12, { 111,  75 } },
+    { 5, 12, { 111,  76 } }, { 5, 12, { 111,  77 } }, { 5, 12, { 111,  78 } },
+    { 5, 12, { 111,  79 } }, { 5, 12, { 111,  80 } }, { 5, 12, { 111,  81 } },
+    { 5, 12, { 111,  82 } }, { 5, 12, { 111,  83 } }, { 5, 12, { 111,  84 } },
+    { 5, 12, { 111,  85 } }, { 5, 12, { 111,  86 } }, { 5, 12, { 111,  87 } },
+    { 5, 12, { 111,  89 } }, { 5, 12, { 111, 106 } }, { 5, 12, { 111, 107 } },
+    { 5, 12, { 111, 113 } }, { 5, 12, { 111, 118 } }, { 5, 12, { 111, 119 } },
+    { 5, 12, { 111, 120 } }, { 5, 12, { 111, 121 } }, { 5, 12, { 111, 122 } },
+    { 5,  5, { 111,   0 } }, { 5,  5, { 111,   0 } }, { 5,  5, { 111,   0 } },
+    { 5,  5, { 111,   0 } }, { 5, 10, { 115,  48 } }, { 5, 10, { 115,  48 } },
+    { 5, 10, { 115,  48 } }, { 5, 10, { 115,  48 } }, { 5, 10, { 115,  49 } },
+    { 5, 10, { 115,  49 } }, { 5, 10, { 115,  49 } }, { 5, 10, { 115,  49 } },
+    { 5, 10, { 115,  50 } }, { 5, 10, { 115,  50 } }, { 5, 10, { 115,  50 } },
+    { 5, 10, { 115,  50 } }, { 5, 10, { 115,  97 } }, { 5, 10, { 115,  97 } },
+    { 5, 10, { 115,  97 } }, { 5, 10, { 115,  97 } }, { 5, 10, { 115,  99 } },
+    { 5, 10, { 115,  99 } }, { 5, 10, { 115,  99 } }, { 5, 10, { 115,  99 } },
+    { 5, 10, { 115, 101 } }, { 5, 10, { 115, 101 } }, { 5, 10, { 115, 101 } },
+    { 5, 10, { 115, 101 } }, { 5, 10, { 115, 105 } }, { 5, 10, { 115, 105 } },
+    { 5, 10, { 115, 105 } }, { 5, 10, { 115, 105 } }, { 5, 10, { 115, 111 } },
+    { 5, 10, { 115, 111 } }, { 5, 10, { 115, 111 } }, { 5, 10, { 115, 111 } },
+    { 5, 10, { 115, 115 } }, { 5, 10, { 115, 115 } }, { 5, 10, { 115, 115 } },
+    { 5, 10, { 115, 115 } }, { 5, 10, { 115, 116 } }, { 5, 10, { 115, 116 } },
+    { 5, 10, { 115, 116 } }, { 5, 10, { 115, 116 } }, { 5, 11, { 115,  32 } },
+    { 5, 11, { 115,  32 } }, { 5, 11, { 115,  37 } }, { 5, 11, { 115,  37 } },
+    { 5, 11, { 115,  45 } }, { 5, 11, { 115,  45 } }, { 5, 11, { 115,  46 } },
+    { 5, 11, { 115,  46 } }, { 5, 11, { 115,  47 } }, { 5, 11, { 115,  47 } },
+    { 5, 11, { 115,  51 } }, { 5, 11, { 115,  51 } }, { 5, 11, { 115,  52 } },
+    { 5, 11, { 115,  52 } }, { 5, 11, { 115,  53 } }, { 5, 11, { 115,  53 } },
+    { 5, 11, { 115,  54 } }, { 5, 11, { 115,  54 } }, { 5, 11, { 115,  55 } },
+    { 5, 11, { 115,  55 } }, { 5, 11, { 115,  56 } }, { 5, 11, { 115,  56 } },
+    { 5, 11, { 115,  57 } }, { 5, 11, { 115,  57 } }, { 5, 11, { 115,  61 } },
+    { 5, 11, { 115,  61 } }, { 5, 11, { 115,  65 } }, { 5, 11, { 115,  65 } },
+    { 5, 11, { 115,  95 } }, { 5, 11, { 115,  95 } }, { 5, 11, { 115,  98 } },
+    { 5, 11, { 115,  98 } }, { 5, 11, { 115, 100 } }, { 5, 11, { 115, 100 } },
+    { 5, 11, { 115, 102 } }, { 5, 11, { 115, 102 } }, { 5, 11, { 115, 103 } },
+    { 5, 11, { 115, 103 } }, { 5, 11, { 115, 104 } }, { 5, 11, { 115, 104 } },
+    { 5, 11, { 115, 108 } }, { 5, 11, { 115, 108 } }, { 5, 11, { 115, 109 } },
+    { 5, 11, { 115, 109 } }, { 5, 11, { 115, 110 } }, { 5, 11, { 115, 110 } },
+    { 5, 11, { 115, 112 } }, { 5, 11, { 115, 112 } }, { 5, 11, { 115, 114 } },
+    { 5, 11, { 115, 114 } }, { 5, 11, { 115, 117 } }, { 5, 11, { 115, 117 } },
+    { 5, 12, { 115,  58 } }, { 5, 12, { 115,  66 } }, { 5, 12, { 115,  67 } },
+    { 5, 12, { 115,  68 } }, { 5, 12, { 115,  69 } }, { 5, 12, { 115,  70 } },
+    { 5, 12, { 115,  71 } }, { 5, 12, { 115,  72 } }, { 5, 12, { 115,  73 } },
+    { 5, 12, { 115,  74 } }, { 5, 12, { 115,  75 } }, { 5, 12, { 115,  76 } },
+    { 5, 12, { 115,  77 } }, { 5, 12, { 115,  78 } }, { 5, 12, { 115,  79 } },
+    { 5, 12, { 115,  80 } }, { 5, 12, { 115,  81 } }, { 5, 12, { 115,  82 } },
+    { 5, 12, { 115,  83 } }, { 5, 12, { 115,  84 } }, { 5, 12, { 115,  85 } },
+    { 5, 12, { 115,  86 } }, { 5, 12, { 115,  87 } }, { 5, 12, { 115,  89 } },
+    { 5, 12, { 115, 106 } }, { 5, 12, { 115, 107 } }, { 5, 12, { 115, 113 } },
+    { 5, 12, { 115, 118 } }, { 5, 12, { 115, 119 } }, { 5, 12, { 115, 120 } },
+    { 5, 12, { 115, 121 } }, { 5, 12, { 115, 122 } }, { 5,  5, { 115,   0 } },
+    { 5,  5, { 115,   0 } }, { 5,  5, { 115,   0 } }, { 5,  5, { 115,   0 } },
+    { 5, 10, { 116,  48 } }, { 5, 10, { 116,  48 } }, { 5, 10, { 116,  48 } },
+    { 5, 10, { 116,  48 } }, { 5, 10, { 116,  49 } }, { 5, 10, { 116,  49 } },
+    { 5, 10, { 116,  49 } }, { 5, 10, { 116,  49 } }, { 5, 10, { 116,  50 } },
+    { 5, 10, { 116,  50 } }, { 5, 10, { 116,  50 } }, { 5, 10, { 116,  50 } },
+    { 5, 10, { 116,  97 } }, { 5, 10, { 116,  97 } }, { 5, 10, { 116,  97 } },
+    { 5, 10, { 116,  97 } }, { 5, 10, { 116,  99 } }, { 5, 10, { 116,  99 } },
+    { 5, 10, { 116,  99 } }, { 5, 10, { 116,  99 } }, { 5, 10, { 116, 101 } },
+    { 5, 10, { 116, 101 } }, { 5, 10, { 116, 101 } }, { 5, 10, { 116, 101 } },
+    { 5, 10, { 116, 105 } }, { 5, 10, { 116, 105 } }, { 5, 10, { 116, 105 } },
+    { 5, 10, { 116, 105 } }, { 5, 10, { 116, 111 } }, { 5, 10, { 116, 111 } },
+    { 5, 10, { 116, 111 } }, { 5, 10, { 116, 111 } }, { 5, 10, { 116, 115 } },
+    { 5, 10, { 116, 115 } }, { 5, 10, { 116, 115 } }, { 5, 10, { 116, 115 } },
+    { 5, 10, { 116, 116 } }, { 5, 10, { 116, 116 } }, { 5, 10, { 116, 116 } },
+    { 5, 10, { 116, 116 } }, { 5, 11, { 116,  32 } }, { 5, 11, { 116,  32 } },
+    { 5, 11, { 116,  37 } }, { 5, 11, { 116,  37 } }, { 5, 11, { 116,  45 } },
+    { 5, 11, { 116,  45 } }, { 5, 11, { 116,  46 } }, { 5, 11, { 116,  46 } },
+    { 5, 11, { 116,  47 } }, { 5, 11, { 116,  47 } }, { 5, 11, { 116,  51 } },
+    { 5, 11, { 116,  51 } }, { 5, 11, { 116,  52 } }, { 5, 11, { 116,  52 } },
+    { 5, 11, { 116,  53 } }, { 5, 11, { 116,  53 } }, { 5, 11, { 116,  54 } },
+    { 5, 11, { 116,  54 } }, { 5, 11, { 116,  55 } }, { 5, 11, { 116,  55 } },
+    { 5, 11, { 116,  56 } }, { 5, 11, { 116,  56 } }, { 5, 11, { 116,  57 } },
+    { 5, 11, { 116,  57 } }, { 5, 11, { 116,  61 } }, { 5, 11, { 116,  61 } },
+    { 5, 11, { 116,  65 } }, { 5, 11, { 116,  65 } }, { 5, 11, { 116,  95 } },
+    { 5, 11, { 116,  95 } }, { 5, 11, { 116,  98 } }, { 5, 11, { 116,  98 } },
+    { 5, 11, { 116, 100 } }, { 5, 11, { 116, 100 } }, { 5, 11, { 116, 102 } },
+    { 5, 11, { 116, 102 } }, { 5, 11, { 116, 103 } }, { 5, 11, { 116, 103 } },
+    { 5, 11, { 116, 104 } }, { 5, 11, { 116, 104 } }, { 5, 11, { 116, 108 } },
+    { 5, 11, { 116, 108 } }, { 5, 11, { 116, 109 } }, { 5, 11, { 116, 109 } },
+    { 5, 11, { 116, 110 } }, { 5, 11, { 116, 110 } }, { 5, 11, { 116, 112 } },
+    { 5, 11, { 116, 112 } }, { 5, 11, { 116, 114 } }, { 5, 11, { 116, 114 } },
+    { 5, 11, { 116, 117 } }, { 5, 11, { 116, 117 } }, { 5, 12, { 116,  58 } },
+    { 5, 12, { 116,  66 } }, { 5, 12, { 116,  67 } }, { 5, 12, { 116,  68 } },
+    { 5, 12, { 116,  69 } }, { 5, 12, { 116,  70 } }, { 5, 12, { 116,  71 } },
+    { 5, 12, { 116,  72 } }, { 5, 12, { 116,  73 } }, { 5, 12, { 116,  74 } },
+    { 5, 12, { 116,  75 } }, { 5, 12, { 116,  76 } }, { 5, 12, { 116,  77 } },
+    { 5, 12, { 116,  78 } }, { 5, 12, { 116,  79 } }, { 5, 12, { 116,  80 } },
+    { 5, 12, { 116,  81 } }, { 5, 12, { 116,  82 } }, { 5, 12, { 116,  83 } },
+    { 5, 12, { 116,  84 } }, { 5, 12, { 116,  85 } }, { 5, 12, { 116,  86 } },
+    { 5, 12, { 116,  87 } }, { 5, 12, { 116,  89 } }, { 5, 12, { 116, 106 } },
+    { 5, 12, { 116, 107 } }, { 5, 12, { 116, 113 } }, { 5, 12, { 116, 118 } },
+    { 5, 12, { 116, 119 } }, { 5, 12, { 116, 120 } }, { 5, 12, { 116, 121 } },
+    { 5, 12, { 116, 122 } }, { 5,  5, { 116,   0 } }, { 5,  5, { 116,   0 } },
+    { 5,  5, { 116,   0 } }, { 5,  5, { 116,   0 } }, { 6, 11, {  32,  48 } },
+    { 6, 11, {  32,  48 } }, { 6, 11, {  32,  49 } }, { 6, 11, {  32,  49 } },
+    { 6, 11, {  32,  50 } }, { 6, 11, {  32,  50 } }, { 6, 11, {  32,  97 } },
+    { 6, 11, {  32,  97 } }, { 6, 11, {  32,  99 } }, { 6, 11, {  32,  99 } },
+    { 6, 11, {  32, 101 } }, { 6, 11, {  32, 101 } }, { 6, 11, {  32, 105 } },
+    { 6, 11, {  32, 105 } }, { 6, 11, {  32, 111 } }, { 6, 11, {  32, 111 } },
+    { 6, 11, {  32, 115 } }, { 6, 11, {  32, 115 } }, { 6, 11, {  32, 116 } },
+    { 6, 11, {  32, 116 } }, { 6, 12, {  32,  32 } }, { 6, 12, {  32,  37 } },
+    { 6, 12, {  32,  45 } }, { 6, 12, {  32,  46 } }, { 6, 12, {  32,  47 } },
+    { 6, 12, {  32,  51 } }, { 6, 12, {  32,  52 } }, { 6, 12, {  32,  53 } },
+    { 6, 12, {  32,  54 } }, { 6, 12, {  32,  55 } }, { 6, 12, {  32,  56 } },
+    { 6, 12, {  32,  57 } }, { 6, 12, {  32,  61 } }, { 6, 12, {  32,  65 } },
+    { 6, 12, {  32,  95 } }, { 6, 12, {  32,  98 } }, { 6, 12, {  32, 100 } },
+    { 6, 12, {  32, 102 } }, { 6, 12, {  32, 103 } }, { 6, 12, {  32, 104 } },
+    { 6, 12, {  32, 108 } }, { 6, 12, {  32, 109 } }, { 6, 12, {  32, 110 } },
+    { 6, 12, {  32, 112 } }, { 6, 12, {  32, 114 } }, { 6, 12, {  32, 117 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } }, { 6,  6, {  32,   0 } },
+    { 6, 11, {  37,  48 } }, { 6, 11, {  37,  48 } }, { 6, 11, {  37,  49 } },
+    { 6, 11, {  37,  49 } }, { 6, 11, {  37,  50 } }, { 6, 11, {  37,  50 } },
+    { 6, 11, {  37,  97 } }, { 6, 11, {  37,  97 } }, { 6, 11, {  37,  99 } },
+    { 6, 11, {  37,  99 } }, { 6, 11, {  37, 101 } }, { 6, 11, {  37, 101 } },
+    { 6, 11, {  37, 105 } }, { 6, 11, {  37, 105 } }, { 6, 11, {  37, 111 } },
+    { 6, 11, {  37, 111 } }, { 6, 11, {  37, 115 } }, { 6, 11, {  37, 115 } },
+    { 6, 11, {  37, 116 } }, { 6, 11, {  37, 116 } }, { 6, 12, {  37,  32 } },
+    { 6, 12, {  37,  37 } }, { 6, 12, {  37,  45 } }, { 6, 12, {  37,  46 } },
+    { 6, 12, {  37,  47 } }, { 6, 12, {  37,  51 } }, { 6, 12, {  37,  52 } },
+    { 6, 12, {  37,  53 } }, { 6, 12, {  37,  54 } }, { 6, 12, {  37,  55 } },
+    { 6, 12, {  37,  56 } }, { 6, 12, {  37,  57 } }, { 6, 12, {  37,  61 } },
+    { 6, 12, {  37,  65 } }, { 6, 12, {  37,  95 } }, { 6, 12, {  37,  98 } },
+    { 6, 12, {  37, 100 } }, { 6, 12, {  37, 102 } }, { 6, 12, {  37, 103 } },
+    { 6, 12, {  37, 104 } }, { 6, 12, {  37, 108 } }, { 6, 12, {  37, 109 } },
+    { 6, 12, {  37, 110 } }, { 6, 12, {  37, 112 } }, { 6, 12, {  37, 114 } },
+    { 6, 12, {  37, 117 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } }, { 6,  6, {  37,   0 } },
+    { 6,  6, {  37,   0 } }, { 6, 11, {  45,  48 } }, { 6, 11, {  45,  48 } },
+    { 6, 11, {  45,  49 } }, { 6, 11, {  45,  49 } }, { 6, 11, {  45,  50 } },
+    { 6, 11, {  45,  50 } }, { 6, 11, {  45,  97 } }, { 6, 11, {  45,  97 } },
+    { 6, 11, {  45,  99 } }, { 6, 11, {  45,  99 } }, { 6, 11, {  45, 101 } },
+    { 6, 11, {  45, 101 } }, { 6, 11, {  45, 105 } }, { 6, 11, {  45, 105 } },
+    { 6, 11, {  45, 111 } }, { 6, 11, {  45, 111 } }, { 6, 11, {  45, 115 } },
+    { 6, 11, {  45, 115 } }, { 6, 11, {  45, 116 } }, { 6, 11, {  45, 116 } },
+    { 6, 12, {  45,  32 } }, { 6, 12, {  45,  37 } }, { 6, 12, {  45,  45 } },
+    { 6, 12, {  45,  46 } }, { 6, 12, {  45,  47 } }, { 6, 12, {  45,  51 } },
+    { 6, 12, {  45,  52 } }, { 6, 12, {  45,  53 } }, { 6, 12, {  45,  54 } },
+    { 6, 12, {  45,  55 } }, { 6, 12, {  45,  56 } }, { 6, 12, {  45,  57 } },
+    { 6, 12, {  45,  61 } }, { 6, 12, {  45,  65 } }, { 6, 12, {  45,  95 } },
+    { 6, 12, {  45,  98 } }, { 6, 12, {  45, 100 } }, { 6, 12, {  45, 102 } },
+    { 6, 12, {  45, 103 } }, { 6, 12, {  45, 104 } }, { 6, 12, {  45, 108 } },
+    { 6, 12, {  45, 109 } }, { 6, 12, {  45, 110 } }, { 6, 12, {  45, 112 } },
+    { 6, 12, {  45, 114 } }, { 6, 12, {  45, 117 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } },
+    { 6,  6, {  45,   0 } }, { 6,  6, {  45,   0 } }, { 6, 11, {  46,  48 } },
+    { 6, 11, {  46,  48 } }, { 6, 11, {  46,  49 } }, { 6, 11, {  46,  49 } },
+    { 6, 11, {  46,  50 } }, { 6, 11, {  46,  50 } }, { 6, 11, {  46,  97 } },
+    { 6, 11, {  46,  97 } }, { 6, 11, {  46,  99 } }, { 6, 11, {  46,  99 } },
+    { 6, 11, {  46, 101 } }, { 6, 11, {  46, 101 } }, { 6, 11, {  46, 105 } },
+    { 6, 11, {  46, 105 } }, { 6, 11, {  46, 111 } }, { 6, 11, {  46, 111 } },
+    { 6, 11, {  46, 115 } }, { 6, 11, {  46, 115 } }, { 6, 11, {  46, 116 } },
+    { 6, 11, {  46, 116 } }, { 6, 12, {  46,  32 } }, { 6, 12, {  46,  37 } },
+    { 6, 12, {  46,  45 } }, { 6, 12, {  46,  46 } }, { 6, 12, {  46,  47 } },
+    { 6, 12, {  46,  51 } }, { 6, 12, {  46,  52 } }, { 6, 12, {  46,  53 } },
+    { 6, 12, {  46,  54 } }, { 6, 12, {  46,  55 } }, { 6, 12, {  46,  56 } },
+    { 6, 12, {  46,  57 } }, { 6, 12, {  46,  61 } }, { 6, 12, {  46,  65 } },
+    { 6, 12, {  46,  95 } }, { 6, 12, {  46,  98 } }, { 6, 12, {  46, 100 } },
+    { 6, 12, {  46, 102 } }, { 6, 12, {  46, 103 } }, { 6, 12, {  46, 104 } },
+    { 6, 12, {  46, 108 } }, { 6, 12, {  46, 109 } }, { 6, 12, {  46, 110 } },
+    { 6, 12, {  46, 112 } }, { 6, 12, {  46, 114 } }, { 6, 12, {  46, 117 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } }, { 6,  6, {  46,   0 } },
+    { 6, 11, {  47,  48 } }, { 6, 11, {  47,  48 } }, { 6, 11, {  47,  49 } },
+    { 6, 11, {  47,  49 } }, { 6, 11, {  47,  50 } }, { 6, 11, {  47,  50 } },
+    { 6, 11, {  47,  97 } }, { 6, 11, {  47,  97 } }, { 6, 11, {  47,  99 } },
+    { 6, 11, {  47,  99 } }, { 6, 11, {  47, 101 } }, { 6, 11, {  47, 101 } },
+    { 6, 11, {  47, 105 } }, { 6, 11, {  47, 105 } }, { 6, 11, {  47, 111 } },
+    { 6, 11, {  47, 111 } }, { 6, 11, {  47, 115 } }, { 6, 11, {  47, 115 } },
+    { 6, 11, {  47, 116 } }, { 6, 11, {  47, 116 } }, { 6, 12, {  47,  32 } },
+    { 6, 12, {  47,  37 } }, { 6, 12, {  47,  45 } }, { 6, 12, {  47,  46 } },
+    { 6, 12, {  47,  47 } }, { 6, 12, {  47,  51 } }, { 6, 12, {  47,  52 } },
+    { 6, 12, {  47,  53 } }, { 6, 12, {  47,  54 } }, { 6, 12, {  47,  55 } },
+    { 6, 12, {  47,  56 } }, { 6, 12, {  47,  57 } }, { 6, 12, {  47,  61 } },
+    { 6, 12, {  47,  65 } }, { 6, 12, {  47,  95 } }, { 6, 12, {  47,  98 } },
+    { 6, 12, {  47, 100 } }, { 6, 12, {  47, 102 } }, { 6, 12, {  47, 103 } },
+    { 6, 12, {  47, 104 } }, { 6, 12, {  47, 108 } }, { 6, 12, {  47, 109 } },
+    { 6, 12, {  47, 110 } }, { 6, 12, {  47, 112 } }, { 6, 12, {  47, 114 } },
+    { 6, 12, {  47, 117 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } }, { 6,  6, {  47,   0 } },
+    { 6,  6, {  47,   0 } }, { 6, 11, {  51,  48 } }, { 6, 11, {  51,  48 } },
+    { 6, 11, {  51,  49 } }, { 6, 11, {  51,  49 } }, { 6, 11, {  51,  50 } },
+    { 6, 11, {  51,  50 } }, { 6, 11, {  51,  97 } }, { 6, 11, {  51,  97 } },
+    { 6, 11, {  51,  99 } }, { 6, 11, {  51,  99 } }, { 6, 11, {  51, 101 } },
+    { 6, 11, {  51, 101 } }, { 6, 11, {  51, 105 } }, { 6, 11, {  51, 105 } },
+    { 6, 11, {  51, 111 } }, { 6, 11, {  51, 111 } }, { 6, 11, {  51, 115 } },
+    { 6, 11, {  51, 115 } }, { 6, 11, {  51, 116 } }, { 6, 11, {  51, 116 } },
+    { 6, 12, {  51,  32 } }, { 6, 12, {  51,  37 } }, { 6, 12, {  51,  45 } },
+    { 6, 12, {  51,  46 } }, { 6, 12, {  51,  47 } }, { 6, 12, {  51,  51 } },
+    { 6, 12, {  51,  52 } }, { 6, 12, {  51,  53 } }, { 6, 12, {  51,  54 } },
+    { 6, 12, {  51,  55 } }, { 6, 12, {  51,  56 } }, { 6, 12, {  51,  57 } },
+    { 6, 12, {  51,  61 } }, { 6, 12, {  51,  65 } }, { 6, 12, {  51,  95 } },
+    { 6, 12, {  51,  98 } }, { 6, 12, {  51, 100 } }, { 6, 12, {  51, 102 } },
+    { 6, 12, {  51, 103 } }, { 6, 12, {  51, 104 } }, { 6, 12, {  51, 108 } },
+    { 6, 12, {  51, 109 } }, { 6, 12, {  51, 110 } }, { 6, 12, {  51, 112 } },
+    { 6, 12, {  51, 114 } }, { 6, 12, {  51, 117 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } },
+    { 6,  6, {  51,   0 } }, { 6,  6, {  51,   0 } }, { 6, 11, {  52,  48 } },
+    { 6, 11, {  52,  48 } }, { 6, 11, {  52,  49 } }, { 6, 11, {  52,  49 } },
+    { 6, 11, {  52,  50 } }, { 6, 11, {  52,  50 } }, { 6, 11, {  52,  97 } },
+    { 6, 11, {  52,  97 } }, { 6, 11, {  52,  99 } }, { 6, 11, {  52,  99 } },
+    { 6, 11, {  52, 101 } }, { 6, 11, {  52, 101 } }, { 6, 11, {  52, 105 } },
+    { 6, 11, {  52, 105 } }, { 6, 11, {  52, 111 } }, { 6, 11, {  52, 111 } },
+    { 6, 11, {  52, 115 } }, { 6, 11, {  52, 115 } }, { 6, 11, {  52, 116 } },
+    { 6, 11, {  52, 116 } }, { 6, 12, {  52,  32 } }, { 6, 12, {  52,  37 } },
+    { 6, 12, {  52,  45 } }, { 6, 12, {  52,  46 } }, { 6, 12, {  52,  47 } },
+    { 6, 12, {  52,  51 } }, { 6, 12, {  52,  52 } }, { 6, 12, {  52,  53 } },
+    { 6, 12, {  52,  54 } }, { 6, 12, {  52,  55 } }, { 6, 12, {  52,  56 } },
+    { 6, 12, {  52,  57 } }, { 6, 12, {  52,  61 } }, { 6, 12, {  52,  65 } },
+    { 6, 12, {  52,  95 } }, { 6, 12, {  52,  98 } }, { 6, 12, {  52, 100 } },
+    { 6, 12, {  52, 102 } }, { 6, 12, {  52, 103 } }, { 6, 12, {  52, 104 } },
+    { 6, 12, {  52, 108 } }, { 6, 12, {  52, 109 } }, { 6, 12, {  52, 110 } },
+    { 6, 12, {  52, 112 } }, { 6, 12, {  52, 114 } }, { 6, 12, {  52, 117 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } }, { 6,  6, {  52,   0 } },
+    { 6, 11, {  53,  48 } }, { 6, 11, {  53,  48 } }, { 6, 11, {  53,  49 } },
+    { 6, 11, {  53,  49 } }, { 6, 11, {  53,  50 } }, { 6, 11, {  53,  50 } },
+    { 6, 11, {  53,  97 } }, { 6, 11, {  53,  97 } }, { 6, 11, {  53,  99 } },
+    { 6, 11, {  53,  99 } }, { 6, 11, {  53, 101 } }, { 6, 11, {  53, 101 } },
+    { 6, 11, {  53, 105 } }, { 6, 11, {  53, 105 } }, { 6, 11, {  53, 111 } },
+    { 6, 11, {  53, 111 } }, { 6, 11, {  53, 115 } }, { 6, 11, {  53, 115 } },
+    { 6, 11, {  53, 116 } }, { 6, 11, {  53, 116 } }, { 6, 12, {  53,  32 } },
+    { 6, 12, {  53,  37 } }, { 6, 12, {  53,  45 } }, { 6, 12, {  53,  46 } },
+    { 6, 12, {  53,  47 } }, { 6, 12, {  53,  51 } }, { 6, 12, {  53,  52 } },
+    { 6, 12, {  53,  53 } }, { 6, 12, {  53,  54 } }, { 6, 12, {  53,  55 } },
+    { 6, 12, {  53,  56 } }, { 6, 12, {  53,  57 } }, { 6, 12, {  53,  61 } },
+    { 6, 12, {  53,  65 } }, { 6, 12, {  53,  95 } }, { 6, 12, {  53,  98 } },
+    { 6, 12, {  53, 100 } }, { 6, 12, {  53, 102 } }, { 6, 12, {  53, 103 } },
+    { 6, 12, {  53, 104 } }, { 6, 12, {  53, 108 } }, { 6, 12, {  53, 109 } },
+    { 6, 12, {  53, 110 } }, { 6, 12, {  53, 112 } }, { 6, 12, {  53, 114 } },
+    { 6, 12, {  53, 117 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } }, { 6,  6, {  53,   0 } },
+    { 6,  6, {  53,   0 } }, { 6, 11, {  54,  48 } }, { 6, 11, {  54,  48 } },
+    { 6, 11, {  54,  49 } }, { 6, 11, {  54,  49 } }, { 6, 11, {  54,  50 } },
+    { 6, 11, {  54,  50 } }, { 6, 11, {  54,  97 } }, { 6, 11, {  54,  97 } },
+    { 6, 11, {  54,  99 } }, { 6, 11, {  54,  99 } }, { 6, 11, {  54, 101 } },
+    { 6, 11, {  54, 101 } }, { 6, 11, {  54, 105 } }, { 6, 11, {  54, 105 } },
+    { 6, 11, {  54, 111 } }, { 6, 11, {  54, 111 } }, { 6, 11, {  54, 115 } },
+    { 6, 11, {  54, 115 } }, { 6, 11, {  54, 116 } }, { 6, 11, {  54, 116 } },
+    { 6, 12, {  54,  32 } }, { 6, 12, {  54,  37 } }, { 6, 12, {  54,  45 } },
+    { 6, 12, {  54,  46 } }, { 6, 12, {  54,  47 } }, { 6, 12, {  54,  51 } },
+    { 6, 12, {  54,  52 } }, { 6, 12, {  54,  53 } }, { 6, 12, {  54,  54 } },
+    { 6, 12, {  54,  55 } }, { 6, 12, {  54,  56 } }, { 6, 12, {  54,  57 } },
+    { 6, 12, {  54,  61 } }, { 6, 12, {  54,  65 } }, { 6, 12, {  54,  95 } },
+    { 6, 12, {  54,  98 } }, { 6, 12, {  54, 100 } }, { 6, 12, {  54, 102 } },
+    { 6, 12, {  54, 103 } }, { 6, 12, {  54, 104 } }, { 6, 12, {  54, 108 } },
+    { 6, 12, {  54, 109 } }, { 6, 12, {  54, 110 } }, { 6, 12, {  54, 112 } },
+    { 6, 12, {  54, 114 } }, { 6, 12, {  54, 117 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } },
+    { 6,  6, {  54,   0 } }, { 6,  6, {  54,   0 } }, { 6, 11, {  55,  48 } },
+    { 6, 11, {  55,  48 } }, { 6, 11, {  55,  49 } }, { 6, 11, {  55,  49 } },
+    { 6, 11, {  55,  50 } }, { 6, 11, {  55,  50 } }, { 6, 11, {  55,  97 } },
+    { 6, 11, {  55,  97 } }, { 6, 11, {  55,  99 } }, { 6, 11, {  55,  99 } },
+    { 6, 11, {  55, 101 } }, { 6, 11, {  55, 101 } }, { 6, 11, {  55, 105 } },
+    { 6, 11, {  55, 105 } }, { 6, 11, {  55, 111 } }, { 6, 11, {  55, 111 } },
+    { 6, 11, {  55, 115 } }, { 6, 11, {  55, 115 } }, { 6, 11, {  55, 116 } },
+    { 6, 11, {  55, 116 } }, { 6, 12, {  55,  32 } }, { 6, 12, {  55,  37 } },
+    { 6, 12, {  55,  45 } }, { 6, 12, {  55,  46 } }, { 6, 12, {  55,  47 } },
+    { 6, 12, {  55,  51 } }, { 6, 12, {  55,  52 } }, { 6, 12, {  55,  53 } },
+    { 6, 12, {  55,  54 } }, { 6, 12, {  55,  55 } }, { 6, 12, {  55,  56 } },
+    { 6, 12, {  55,  57 } }, { 6, 12, {  55,  61 } }, { 6, 12, {  55,  65 } },
+    { 6, 12, {  55,  95 } }, { 6, 12, {  55,  98 } }, { 6, 12, {  55, 100 } },
+    { 6, 12, {  55, 102 } }, { 6, 12, {  55, 103 } }, { 6, 12, {  55, 104 } },
+    { 6, 12, {  55, 108 } }, { 6, 12, {  55, 109 } }, { 6, 12, {  55, 110 } },
+    { 6, 12, {  55, 112 } }, { 6, 12, {  55, 114 } }, { 6, 12, {  55, 117 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } }, { 6,  6, {  55,   0 } },
+    { 6, 11, {  56,  48 } }, { 6, 11, {  56,  48 } }, { 6, 11, {  56,  49 } },
+    { 6, 11, {  56,  49 } }, { 6, 11, {  56,  50 } }, { 6, 11, {  56,  50 } },
+    { 6, 11, {  56,  97 } }, { 6, 11, {  56,  97 } }, { 6, 11, {  56,  99 } },
+    { 6, 11, {  56,  99 } }, { 6, 11, {  56, 101 } }, { 6, 11, {  56, 101 } },
+    { 6, 11, {  56, 105 } }, { 6, 11, {  56, 105 } }, { 6, 11, {  56, 111 } },
+    { 6, 11, {  56, 111 } }, { 6, 11, {  56, 115 } }, { 6, 11, {  56, 115 } },
+    { 6, 11, {  56, 116 } }, { 6, 11, {  56, 116 } }, { 6, 12, {  56,  32 } },
+    { 6, 12, {  56,  37 } }, { 6, 12, {  56,  45 } }, { 6, 12, {  56,  46 } },
+    { 6, 12, {  56,  47 } }, { 6, 12, {  56,  51 } }, { 6, 12, {  56,  52 } },
+    { 6, 12, {  56,  53 } }, { 6, 12, {  56,  54 } }, { 6, 12, {  56,  55 } },
+    { 6, 12, {  56,  56 } }, { 6, 12, {  56,  57 } }, { 6, 12, {  56,  61 } },
+    { 6, 12, {  56,  65 } }, { 6, 12, {  56,  95 } }, { 6, 12, {  56,  98 } },
+    { 6, 12, {  56, 100 } }, { 6, 12, {  56, 102 } }, { 6, 12, {  56, 103 } },
+    { 6, 12, {  56, 104 } }, { 6, 12, {  56, 108 } }, { 6, 12, {  56, 109 } },
+    { 6, 12, {  56, 110 } }, { 6, 12, {  56, 112 } }, { 6, 12, {  56, 114 } },
+    { 6, 12, {  56, 117 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } }, { 6,  6, {  56,   0 } },
+    { 6,  6, {  56,   0 } }, { 6, 11, {  57,  48 } }, { 6, 11, {  57,  48 } },
+    { 6, 11, {  57,  49 } }, { 6, 11, {  57,  49 } }, { 6, 11, {  57,  50 } },
+    { 6, 11, {  57,  50 } }, { 6, 11, {  57,  97 } }, { 6, 11, {  57,  97 } },
+    { 6, 11, {  57,  99 } }, { 6, 11, {  57,  99 } }, { 6, 11, {  57, 101 } },
+    { 6, 11, {  57, 101 } }, { 6, 11, {  57, 105 } }, { 6, 11, {  57, 105 } },
+    { 6, 11, {  57, 111 } }, { 6, 11, {  57, 111 } }, { 6, 11, {  57, 115 } },
+    { 6, 11, {  57, 115 } }, { 6, 11, {  57, 116 } }, { 6, 11, {  57, 116 } },
+    { 6, 12, {  57,  32 } }, { 6, 12, {  57,  37 } }, { 6, 12, {  57,  45 } },
+    { 6, 12, {  57,  46 } }, { 6, 12, {  57,  47 } }, { 6, 12, {  57,  51 } },
+    { 6, 12, {  57,  52 } }, { 6, 12, {  57,  53 } }, { 6, 12, {  57,  54 } },
+    { 6, 12, {  57,  55 } }, { 6, 12, {  57,  56 } }, { 6, 12, {  57,  57 } },
+    { 6, 12, {  57,  61 } }, { 6, 12, {  57,  65 } }, { 6, 12, {  57,  95 } },
+    { 6, 12, {  57,  98 } }, { 6, 12, {  57, 100 } }, { 6, 12, {  57, 102 } },
+    { 6, 12, {  57, 103 } }, { 6, 12, {  57, 104 } }, { 6, 12, {  57, 108 } },
+    { 6, 12, {  57, 109 } }, { 6, 12, {  57, 110 } }, { 6, 12, {  57, 112 } },
+    { 6, 12, {  57, 114 } }, { 6, 12, {  57, 117 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } },
+    { 6,  6, {  57,   0 } }, { 6,  6, {  57,   0 } }, { 6, 11, {  61,  48 } },
+    { 6, 11, {  61,  48 } }, { 6, 11, {  61,  49 } }, { 6, 11, {  61,  49 } },
+    { 6, 11, {  61,  50 } }, { 6, 11, {  61,  50 } }, { 6, 11, {  61,  97 } },
+    { 6, 11, {  61,  97 } }, { 6, 11, {  61,  99 } }, { 6, 11, {  61,  99 } },
+    { 6, 11, {  61, 101 } }, { 6, 11, {  61, 101 } }, { 6, 11, {  61, 105 } },
+    { 6, 11, {  61, 105 } }, { 6, 11, {  61, 111 } }, { 6, 11, {  61, 111 } },
+    { 6, 11, {  61, 115 } }, { 6, 11, {  61, 115 } }, { 6, 11, {  61, 116 } },
+    { 6, 11, {  61, 116 } }, { 6, 12, {  61,  32 } }, { 6, 12, {  61,  37 } },
+    { 6, 12, {  61,  45 } }, { 6, 12, {  61,  46 } }, { 6, 12, {  61,  47 } },
+    { 6, 12, {  61,  51 } }, { 6, 12, {  61,  52 } }, { 6, 12, {  61,  53 } },
+    { 6, 12, {  61,  54 } }, { 6, 12, {  61,  55 } }, { 6, 12, {  61,  56 } },
+    { 6, 12, {  61,  57 } }, { 6, 12, {  61,  61 } }, { 6, 12, {  61,  65 } },
+    { 6, 12, {  61,  95 } }, { 6, 12, {  61,  98 } }, { 6, 12, {  61, 100 } },
+    { 6, 12, {  61, 102 } }, { 6, 12, {  61, 103 } }, { 6, 12, {  61, 104 } },
+    { 6, 12, {  61, 108 } }, { 6, 12, {  61, 109 } }, { 6, 12, {  61, 110 } },
+    { 6, 12, {  61, 112 } }, { 6, 12, {  61, 114 } }, { 6, 12, {  61, 117 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } }, { 6,  6, {  61,   0 } },
+    { 6, 11, {  65,  48 } }, { 6, 11, {  65,  48 } }, { 6, 11, {  65,  49 } },
+    { 6, 11, {  65,  49 } }, { 6, 11, {  65,  50 } }, { 6, 11, {  65,  50 } },
+    { 6, 11, {  65,  97 } }, { 6, 11, {  65,  97 } }, { 6, 11, {  65,  99 } },
+    { 6, 11, {  65,  99 } }, { 6, 11, {  65, 101 } }, { 6, 11, {  65, 101 } },
+    { 6, 11, {  65, 105 } }, { 6, 11, {  65, 105 } }, { 6, 11, {  65, 111 } },
+    { 6, 11, {  65, 111 } }, { 6, 11, {  65, 115 } }, { 6, 11, {  65, 115 } },
+    { 6, 11, {  65, 116 } }, { 6, 11, {  65, 116 } }, { 6, 12, {  65,  32 } },
+    { 6, 12, {  65,  37 } }, { 6, 12, {  65,  45 } }, { 6, 12, {  65,  46 } },
+    { 6, 12, {  65,  47 } }, { 6, 12, {  65,  51 } }, { 6, 12, {  65,  52 } },
+    { 6, 12, {  65,  53 } }, { 6, 12, {  65,  54 } }, { 6, 12, {  65,  55 } },
+    { 6, 12, {  65,  56 } }, { 6, 12, {  65,  57 } }, { 6, 12, {  65,  61 } },
+    { 6, 12, {  65,  65 } }, { 6, 12, {  65,  95 } }, { 6, 12, {  65,  98 } },
+    { 6, 12, {  65, 100 } }, { 6, 12, {  65, 102 } }, { 6, 12, {  65, 103 } },
+    { 6, 12, {  65, 104 } }, { 6, 12, {  65, 108 } }, { 6, 12, {  65, 109 } },
+    { 6, 12, {  65, 110 } }, { 6, 12, {  65, 112 } }, { 6, 12, {  65, 114 } },
+    { 6, 12, {  65, 117 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } }, { 6,  6, {  65,   0 } },
+    { 6,  6, {  65,   0 } }, { 6, 11, {  95,  48 } }, { 6, 11, {  95,  48 } },
+    { 6, 11, {  95,  49 } }, { 6, 11, {  95,  49 } }, { 6, 11, {  95,  50 } },
+    { 6, 11, {  95,  50 } }, { 6, 11, {  95,  97 } }, { 6, 11, {  95,  97 } },
+    { 6, 11, {  95,  99 } }, { 6, 11, {  95,  99 } }, { 6, 11, {  95, 101 } },
+    { 6, 11, {  95, 101 } }, { 6, 11, {  95, 105 } }, { 6, 11, {  95, 105 } },
+    { 6, 11, {  95, 111 } }, { 6, 11, {  95, 111 } }, { 6, 11, {  95, 115 } },
+    { 6, 11, {  95, 115 } }, { 6, 11, {  95, 116 } }, { 6, 11, {  95, 116 } },
+    { 6, 12, {  95,  32 } }, { 6, 12, {  95,  37 } }, { 6, 12, {  95,  45 } },
+    { 6, 12, {  95,  46 } }, { 6, 12, {  95,  47 } }, { 6, 12, {  95,  51 } },
+    { 6, 12, {  95,  52 } }, { 6, 12, {  95,  53 } }, { 6, 12, {  95,  54 } },
+    { 6, 12, {  95,  55 } }, { 6, 12, {  95,  56 } }, { 6, 12, {  95,  57 } },
+    { 6, 12, {  95,  61 } }, { 6, 12, {  95,  65 } }, { 6, 12, {  95,  95 } },
+    { 6, 12, {  95,  98 } }, { 6, 12, {  95, 100 } }, { 6, 12, {  95, 102 } },
+    { 6, 12, {  95, 103 } }, { 6, 12, {  95, 104 } }, { 6, 12, {  95, 108 } },
+    { 6, 12, {  95, 109 } }, { 6, 12, {  95, 110 } }, { 6, 12, {  95, 112 } },
+    { 6, 12, {  95, 114 } }, { 6, 12, {  95, 117 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } },
+    { 6,  6, {  95,   0 } }, { 6,  6, {  95,   0 } }, { 6, 11, {  98,  48 } },
+    { 6, 11, {  98,  48 } }, { 6, 11, {  98,  49 } }, { 6, 11, {  98,  49 } },
+    { 6, 11, {  98,  50 } }, { 6, 11, {  98,  50 } }, { 6, 11, {  98,  97 } },
+    { 6, 11, {  98,  97 } }, { 6, 11, {  98,  99 } }, { 6, 11, {  98,  99 } },
+    { 6, 11, {  98, 101 } }, { 6, 11, {  98, 101 } }, { 6, 11, {  98, 105 } },
+    { 6, 11, {  98, 105 } }, { 6, 11, {  98, 111 } }, { 6, 11, {  98, 111 } },
+    { 6, 11, {  98, 115 } }, { 6, 11, {  98, 115 } }, { 6, 11, {  98, 116 } },
+    { 6, 11, {  98, 116 } }, { 6, 12, {  98,  32 } }, { 6, 12, {  98,  37 } },
+    { 6, 12, {  98,  45 } }, { 6, 12, {  98,  46 } }, { 6, 12, {  98,  47 } },
+    { 6, 12, {  98,  51 } }, { 6, 12, {  98,  52 } }, { 6, 12, {  98,  53 } },
+    { 6, 12, {  98,  54 } }, { 6, 12, {  98,  55 } }, { 6, 12, {  98,  56 } },
+    { 6, 12, {  98,  57 } }, { 6, 12, {  98,  61 } }, { 6, 12, {  98,  65 } },
+    { 6, 12, {  98,  95 } }, { 6, 12, {  98,  98 } }, { 6, 12, {  98, 100 } },
+    { 6, 12, {  98, 102 } }, { 6, 12, {  98, 103 } }, { 6, 12, {  98, 104 } },
+    { 6, 12, {  98, 108 } }, { 6, 12, {  98, 109 } }, { 6, 12, {  98, 110 } },
+    { 6, 12, {  98, 112 } }, { 6, 12, {  98, 114 } }, { 6, 12, {  98, 117 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } }, { 6,  6, {  98,   0 } },
+    { 6, 11, { 100,  48 } }, { 6, 11, { 100,  48 } }, { 6, 11, { 100,  49 } },
+    { 6, 11, { 100,  49 } }, { 6, 11, { 100,  50 } }, { 6, 11, { 100,  50 } },
+    { 6, 11, { 100,  97 } }, { 6, 11, { 100,  97 } }, { 6, 11, { 100,  99 } },
+    { 6, 11, { 100,  99 } }, { 6, 11, { 100, 101 } }, { 6, 11, { 100, 101 } },
+    { 6, 11, { 100, 105 } }, { 6, 11, { 100, 105 } }, { 6, 11, { 100, 111 } },
+    { 6, 11, { 100, 111 } }, { 6, 11, { 100, 115 } }, { 6, 11, { 100, 115 } },
+    { 6, 11, { 100, 116 } }, { 6, 11, { 100, 116 } }, { 6, 12, { 100,  32 } },
+    { 6, 12, { 100,  37 } }, { 6, 12, { 100,  45 } }, { 6, 12, { 100,  46 } },
+    { 6, 12, { 100,  47 } }, { 6, 12, { 100,  51 } }, { 6, 12, { 100,  52 } },
+    { 6, 12, { 100,  53 } }, { 6, 12, { 100,  54 } }, { 6, 12, { 100,  55 } },
+    { 6, 12, { 100,  56 } }, { 6, 12, { 100,  57 } }, { 6, 12, { 100,  61 } },
+    { 6, 12, { 100,  65 } }, { 6, 12, { 100,  95 } }, { 6, 12, { 100,  98 } },
+    { 6, 12, { 100, 100 } }, { 6, 12, { 100, 102 } }, { 6, 12, { 100, 103 } },
+    { 6, 12, { 100, 104 } }, { 6, 12, { 100, 108 } }, { 6, 12, { 100, 109 } },
+    { 6, 12, { 100, 110 } }, { 6, 12, { 100, 112 } }, { 6, 12, { 100, 114 } },
+    { 6, 12, { 100, 117 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } }, { 6,  6, { 100,   0 } },
+    { 6,  6, { 100,   0 } }, { 6, 11, { 102,  48 } }, { 6, 11, { 102,  48 } },
+    { 6, 11, { 102,  49 } }, { 6, 11, { 102,  49 } }, { 6, 11, { 102,  50 } },
+    { 6, 11, { 102,  50 } }, { 6, 11, { 102,  97 } }, { 6, 11, { 102,  97 } },
+    { 6, 11, { 102,  99 } }, { 6, 11, { 102,  99 } }, { 6, 11, { 102, 101 } },
+    { 6, 11, { 102, 101 } }, { 6, 11, { 102, 105 } }, { 6, 11, { 102, 105 } },
+    { 6, 11, { 102, 111 } }, { 6, 11, { 102, 111 } }, { 6, 11, { 102, 115 } },
+    { 6, 11, { 102, 115 } }, { 6, 11, { 102, 116 } }, { 6, 11, { 102, 116 } },
+    { 6, 12, { 102,  32 } }, { 6, 12, { 102,  37 } }, { 6, 12, { 102,  45 } },
+    { 6, 12, { 102,  46 } }, { 6, 12, { 102,  47 } }, { 6, 12, { 102,  51 } },
+    { 6, 12, { 102,  52 } }, { 6, 12, { 102,  53 } }, { 6, 12, { 102,  54 } },
+    { 6, 12, { 102,  55 } }, { 6, 12, { 102,  56 } }, { 6, 12, { 102,  57 } },
+    { 6, 12, { 102,  61 } }, { 6, 12, { 102,  65 } }, { 6, 12, { 102,  95 } },
+    { 6, 12, { 102,  98 } }, { 6, 12, { 102, 100 } }, { 6, 12, { 102, 102 } },
+    { 6, 12, { 102, 103 } }, { 6, 12, { 102, 104 } }, { 6, 12, { 102, 108 } },
+    { 6, 12, { 102, 109 } }, { 6, 12, { 102, 110 } }, { 6, 12, { 102, 112 } },
+    { 6, 12, { 102, 114 } }, { 6, 12, { 102, 117 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } },
+    { 6,  6, { 102,   0 } }, { 6,  6, { 102,   0 } }, { 6, 11, { 103,  48 } },
+    { 6, 11, { 103,  48 } }, { 6, 11, { 103,  49 } }, { 6, 11, { 103,  49 } },
+    { 6, 11, { 103,  50 } }, { 6, 11, { 103,  50 } }, { 6, 11, { 103,  97 } },
+    { 6, 11, { 103,  97 } }, { 6, 11, { 103,  99 } }, { 6, 11, { 103,  99 } },
+    { 6, 11, { 103, 101 } }, { 6, 11, { 103, 101 } }, { 6, 11, { 103, 105 } },
+    { 6, 11, { 103, 105 } }, { 6, 11, { 103, 111 } }, { 6, 11, { 103, 111 } },
+    { 6, 11, { 103, 115 } }, { 6, 11, { 103, 115 } }, { 6, 11, { 103, 116 } },
+    { 6, 11, { 103, 116 } }, { 6, 12, { 103,  32 } }, { 6, 12, { 103,  37 } },
+    { 6, 12, { 103,  45 } }, { 6, 12, { 103,  46 } }, { 6, 12, { 103,  47 } },
+    { 6, 12, { 103,  51 } }, { 6, 12, { 103,  52 } }, { 6, 12, { 103,  53 } },
+    { 6, 12, { 103,  54 } }, { 6, 12, { 103,  55 } }, { 6, 12, { 103,  56 } },
+    { 6, 12, { 103,  57 } }, { 6, 12, { 103,  61 } }, { 6, 12, { 103,  65 } },
+    { 6, 12, { 103,  95 } }, { 6, 12, { 103,  98 } }, { 6, 12, { 103, 100 } },
+    { 6, 12, { 103, 102 } }, { 6, 12, { 103, 103 } }, { 6, 12, { 103, 104 } },
+    { 6, 12, { 103, 108 } }, { 6, 12, { 103, 109 } }, { 6, 12, { 103, 110 } },
+    { 6, 12, { 103, 112 } }, { 6, 12, { 103, 114 } }, { 6, 12, { 103, 117 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } }, { 6,  6, { 103,   0 } },
+    { 6, 11, { 104,  48 } }, { 6, 11, { 104,  48 } }, { 6, 11, { 104,  49 } },
+    { 6, 11, { 104,  49 } }, { 6, 11, { 104,  50 } }, { 6, 11, { 104,  50 } },
+    { 6, 11, { 104,  97 } }, { 6, 11, { 104,  97 } }, { 6, 11, { 104,  99 } },
+    { 6, 11, { 104,  99 } }, { 6, 11, { 104, 101 } }, { 6, 11, { 104, 101 } },
+    { 6, 11, { 104, 105 } }, { 6, 11, { 104, 105 } }, { 6, 11, { 104, 111 } },
+    { 6, 11, { 104, 111 } }, { 6, 11, { 104, 115 } }, { 6, 11, { 104, 115 } },
+    { 6, 11, { 104, 116 } }, { 6, 11, { 104, 116 } }, { 6, 12, { 104,  32 } },
+    { 6, 12, { 104,  37 } }, { 6, 12, { 104,  45 } }, { 6, 12, { 104,  46 } },
+    { 6, 12, { 104,  47 } }, { 6, 12, { 104,  51 } }, { 6, 12, { 104,  52 } },
+    { 6, 12, { 104,  53 } }, { 6, 12, { 104,  54 } }, { 6, 12, { 104,  55 } },
+    { 6, 12, { 104,  56 } }, { 6, 12, { 104,  57 } }, { 6, 12, { 104,  61 } },
+    { 6, 12, { 104,  65 } }, { 6, 12, { 104,  95 } }, { 6, 12, { 104,  98 } },
+    { 6, 12, { 104, 100 } }, { 6, 12, { 104, 102 } }, { 6, 12, { 104, 103 } },
+    { 6, 12, { 104, 104 } }, { 6, 12, { 104, 108 } }, { 6, 12, { 104, 109 } },
+    { 6, 12, { 104, 110 } }, { 6, 12, { 104, 112 } }, { 6, 12, { 104, 114 } },
+    { 6, 12, { 104, 117 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } }, { 6,  6, { 104,   0 } },
+    { 6,  6, { 104,   0 } }, { 6, 11, { 108,  48 } }, { 6, 11, { 108,  48 } },
+    { 6, 11, { 108,  49 } }, { 6, 11, { 108,  49 } }, { 6, 11, { 108,  50 } },
+    { 6, 11, { 108,  50 } }, { 6, 11, { 108,  97 } }, { 6, 11, { 108,  97 } },
+    { 6, 11, { 108,  99 } }, { 6, 11, { 108,  99 } }, { 6, 11, { 108, 101 } },
+    { 6, 11, { 108, 101 } }, { 6, 11, { 108, 105 } }, { 6, 11, { 108, 105 } },
+    { 6, 11, { 108, 111 } }, { 6, 11, { 108, 111 } }, { 6, 11, { 108, 115 } },
+    { 6, 11, { 108, 115 } }, { 6, 11, { 108, 116 } }, { 6, 11, { 108, 116 } },
+    { 6, 12, { 108,  32 } }, { 6, 12, { 108,  37 } }, { 6, 12, { 108,  45 } },
+    { 6, 12, { 108,  46 } }, { 6, 12, { 108,  47 } }, { 6, 12, { 108,  51 } },
+    { 6, 12, { 108,  52 } }, { 6, 12, { 108,  53 } }, { 6, 12, { 108,  54 } },
+    { 6, 12, { 108,  55 } }, { 6, 12, { 108,  56 } }, { 6, 12, { 108,  57 } },
+    { 6, 12, { 108,  61 } }, { 6, 12, { 108,  65 } }, { 6, 12, { 108,  95 } },
+    { 6, 12, { 108,  98 } }, { 6, 12, { 108, 100 } }, { 6, 12, { 108, 102 } },
+    { 6, 12, { 108, 103 } }, { 6, 12, { 108, 104 } }, { 6, 12, { 108, 108 } },
+    { 6, 12, { 108, 109 } }, { 6, 12, { 108, 110 } }, { 6, 12, { 108, 112 } },
+    { 6, 12, { 108, 114 } }, { 6, 12, { 108, 117 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } },
+    { 6,  6, { 108,   0 } }, { 6,  6, { 108,   0 } }, { 6, 11, { 109,  48 } },
+    { 6, 11, { 109,  48 } }, { 6, 11, { 109,  49 } }, { 6, 11, { 109,  49 } },
+    { 6, 11, { 109,  50 } }, { 6, 11, { 109,  50 } }, { 6, 11, { 109,  97 } },
+    { 6, 11, { 109,  97 } }, { 6, 11, { 109,  99 } }, { 6, 11, { 109,  99 } },
+    { 6, 11, { 109, 101 } }, { 6, 11, { 109, 101 } }, { 6, 11, { 109, 105 } },
+    { 6, 11, { 109, 105 } }, { 6, 11, { 109, 111 } }, { 6, 11, { 109, 111 } },
+    { 6, 11, { 109, 115 } }, { 6, 11, { 109, 115 } }, { 6, 11, { 109, 116 } },
+    { 6, 11, { 109, 116 } }, { 6, 12, { 109,  32 } }, { 6, 12, { 109,  37 } },
+    { 6, 12, { 109,  45 } }, { 6, 12, { 109,  46 } }, { 6, 12, { 109,  47 } },
+    { 6, 12, { 109,  51 } }, { 6, 12, { 109,  52 } }, { 6, 12, { 109,  53 } },
+    { 6, 12, { 109,  54 } }, { 6, 12, { 109,  55 } }, { 6, 12, { 109,  56 } },
+    { 6, 12, { 109,  57 } }, { 6, 12, { 109,  61 } }, { 6, 12, { 109,  65 } },
+    { 6, 12, { 109,  95 } }, { 6, 12, { 109,  98 } }, { 6, 12, { 109, 100 } },
+    { 6, 12, { 109, 102 } }, { 6, 12, { 109, 103 } }, { 6, 12, { 109, 104 } },
+    { 6, 12, { 109, 108 } }, { 6, 12, { 109, 109 } }, { 6, 12, { 109, 110 } },
+    { 6, 12, { 109, 112 } }, { 6, 12, { 109, 114 } }, { 6, 12, { 109, 117 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } }, { 6,  6, { 109,   0 } },
+    { 6, 11, { 110,  48 } }, { 6, 11, { 110,  48 } }, { 6, 11, { 110,  49 } },
+    { 6, 11, { 110,  49 } }, { 6, 11, { 110,  50 } }, { 6, 11, { 110,  50 } },
+    { 6, 11, { 110,  97 } }, { 6, 11, { 110,  97 } }, { 6, 11, { 110,  99 } },
+    { 6, 11, { 110,  99 } }, { 6, 11, { 110, 101 } }, { 6, 11, { 110, 101 } },
+    { 6, 11, { 110, 105 } }, { 6, 11, { 110, 105 } }, { 6, 11, { 110, 111 } },
+    { 6, 11, { 110, 111 } }, { 6, 11, { 110, 115 } }, { 6, 11, { 110, 115 } },
+    { 6, 11, { 110, 116 } }, { 6, 11, { 110, 116 } }, { 6, 12, { 110,  32 } },
+    { 6, 12, { 110,  37 } }, { 6, 12, { 110,  45 } }, { 6, 12, { 110,  46 } },
+    { 6, 12, { 110,  47 } }, { 6, 12, { 110,  51 } }, { 6, 12, { 110,  52 } },
+    { 6, 12, { 110,  53 } }, { 6, 12, { 110,  54 } }, { 6, 12, { 110,  55 } },
+    { 6, 12, { 110,  56 } }, { 6, 12, { 110,  57 } }, { 6, 12, { 110,  61 } },
+    { 6, 12, { 110,  65 } }, { 6, 12, { 110,  95 } }, { 6, 12, { 110,  98 } },
+    { 6, 12, { 110, 100 } }, { 6, 12, { 110, 102 } }, { 6, 12, { 110, 103 } },
+    { 6, 12, { 110, 104 } }, { 6, 12, { 110, 108 } }, { 6, 12, { 110, 109 } },
+    { 6, 12, { 110, 110 } }, { 6, 12, { 110, 112 } }, { 6, 12, { 110, 114 } },
+    { 6, 12, { 110, 117 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } }, { 6,  6, { 110,   0 } },
+    { 6,  6, { 110,   0 } }, { 6, 11, { 112,  48 } }, { 6, 11, { 112,  48 } },
+    { 6, 11, { 112,  49 } }, { 6, 11, { 112,  49 } }, { 6, 11, { 112,  50 } },
+    { 6, 11, { 112,  50 } }, { 6, 11, { 112,  97 } }, { 6, 11, { 112,  97 } },
+    { 6, 11, { 112,  99 } }, { 6, 11, { 112,  99 } }, { 6, 11, { 112, 101 } },
+    { 6, 11, { 112, 101 } }, { 6, 11, { 112, 105 } }, { 6, 11, { 112, 105 } },
+    { 6, 11, { 112, 111 } }, { 6, 11, { 112, 111 } }, { 6, 11, { 112, 115 } },
+    { 6, 11, { 112, 115 } }, { 6, 11, { 112, 116 } }, { 6, 11, { 112, 116 } },
+    { 6, 12, { 112,  32 } }, { 6, 12, { 112,  37 } }, { 6, 12, { 112,  45 } },
+    { 6, 12, { 112,  46 } }, { 6, 12, { 112,  47 } }, { 6, 12, { 112,  51 } },
+    { 6, 12, { 112,  52 } }, { 6, 12, { 112,  53 } }, { 6, 12, { 112,  54 } },
+    { 6, 12, { 112,  55 } }, { 6, 12, { 112,  56 } }, { 6, 12, { 112,  57 } },
+    { 6, 12, { 112,  61 } }, { 6, 12, { 112,  65 } }, { 6, 12, { 112,  95 } },
+    { 6, 12, { 112,  98 } }, { 6, 12, { 112, 100 } }, { 6, 12, { 112, 102 } },
+    { 6, 12, { 112, 103 } }, { 6, 12, { 112, 104 } }, { 6, 12, { 112, 108 } },
+    { 6, 12, { 112, 109 } }, { 6, 12, { 112, 110 } }, { 6, 12, { 112, 112 } },
+    { 6, 12, { 112, 114 } }, { 6, 12, { 112, 117 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } },
+    { 6,  6, { 112,   0 } }, { 6,  6, { 112,   0 } }, { 6, 11, { 114,  48 } },
+    { 6, 11, { 114,  48 } }, { 6, 11, { 114,  49 } }, { 6, 11, { 114,  49 } },
+    { 6, 11, { 114,  50 } }, { 6, 11, { 114,  50 } }, { 6, 11, { 114,  97 } },
+    { 6, 11, { 114,  97 } }, { 6, 11, { 114,  99 } }, { 6, 11, { 114,  99 } },
+    { 6, 11, { 114, 101 } }, { 6, 11, { 114, 101 } }, { 6, 11, { 114, 105 } },
+    { 6, 11, { 114, 105 } }, { 6, 11, { 114, 111 } }, { 6, 11, { 114, 111 } },
+    { 6, 11, { 114, 115 } }, { 6, 11, { 114, 115 } }, { 6, 11, { 114, 116 } },
+    { 6, 11, { 114, 116 } }, { 6, 12, { 114,  32 } }, { 6, 12, { 114,  37 } },
+    { 6, 12, { 114,  45 } }, { 6, 12, { 114,  46 } }, { 6, 12, { 114,  47 } },
+    { 6, 12, { 114,  51 } }, { 6, 12, { 114,  52 } }, { 6, 12, { 114,  53 } },
+    { 6, 12, { 114,  54 } }, { 6, 12, { 114,  55 } }, { 6, 12, { 114,  56 } },
+    { 6, 12, { 114,  57 } }, { 6, 12, { 114,  61 } }, { 6, 12, { 114,  65 } },
+    { 6, 12, { 114,  95 } }, { 6, 12, { 114,  98 } }, { 6, 12, { 114, 100 } },
+    { 6, 12, { 114, 102 } }, { 6, 12, { 114, 103 } }, { 6, 12, { 114, 104 } },
+    { 6, 12, { 114, 108 } }, { 6, 12, { 114, 109 } }, { 6, 12, { 114, 110 } },
+    { 6, 12, { 114, 112 } }, { 6, 12, { 114, 114 } }, { 6, 12, { 114, 117 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } }, { 6,  6, { 114,   0 } },
+    { 6, 11, { 117,  48 } }, { 6, 11, { 117,  48 } }, { 6, 11, { 117,  49 } },
+    { 6, 11, { 117,  49 } }, { 6, 11, { 117,  50 } }, { 6, 11, { 117,  50 } },
+    { 6, 11, { 117,  97 } }, { 6, 11, { 117,  97 } }, { 6, 11, { 117,  99 } },
+    { 6, 11, { 117,  99 } }, { 6, 11, { 117, 101 } }, { 6, 11, { 117, 101 } },
+    { 6, 11, { 117, 105 } }, { 6, 11, { 117, 105 } }, { 6, 11, { 117, 111 } },
+    { 6, 11, { 117, 111 } }, { 6, 11, { 117, 115 } }, { 6, 11, { 117, 115 } },
+    { 6, 11, { 117, 116 } }, { 6, 11, { 117, 116 } }, { 6, 12, { 117,  32 } },
+    { 6, 12, { 117,  37 } }, { 6, 12, { 117,  45 } }, { 6, 12, { 117,  46 } },
+    { 6, 12, { 117,  47 } }, { 6, 12, { 117,  51 } }, { 6, 12, { 117,  52 } },
+    { 6, 12, { 117,  53 } }, { 6, 12, { 117,  54 } }, { 6, 12, { 117,  55 } },
+    { 6, 12, { 117,  56 } }, { 6, 12, { 117,  57 } }, { 6, 12, { 117,  61 } },
+    { 6, 12, { 117,  65 } }, { 6, 12, { 117,  95 } }, { 6, 12, { 117,  98 } },
+    { 6, 12, { 117, 100 } }, { 6, 12, { 117, 102 } }, { 6, 12, { 117, 103 } },
+    { 6, 12, { 117, 104 } }, { 6, 12, { 117, 108 } }, { 6, 12, { 117, 109 } },
+    { 6, 12, { 117, 110 } }, { 6, 12, { 117, 112 } }, { 6, 12, { 117, 114 } },
+    { 6, 12, { 117, 117 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } }, { 6,  6, { 117,   0 } },
+    { 6,  6, { 117,   0 } }, { 7, 12, {  58,  48 } }, { 7, 12, {  58,  49 } },
+    { 7, 12, {  58,  50 } }, { 7, 12, {  58,  97 } }, { 7, 12, {  58,  99 } },
+    { 7, 12, {  58, 101 } }, { 7, 12, {  58, 105 } }, { 7, 12, {  58, 111 } },
+    { 7, 12, {  58, 115 } }, { 7, 12, {  58, 116 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } }, { 7,  7, {  58,   0 } },
+    { 7, 12, {  66,  48 } }, { 7, 12, {  66,  49 } }, { 7, 12, {  66,  50 } },
+    { 7, 12, {  66,  97 } }, { 7, 12, {  66,  99 } }, { 7, 12, {  66, 101 } },
+    { 7, 12, {  66, 105 } }, { 7, 12, {  66, 111 } }, { 7, 12, {  66, 115 } },
+    { 7, 12, {  66, 116 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } },
+    { 7,  7, {  66,   0 } }, { 7,  7, {  66,   0 } }, { 7, 12, {  67,  48 } },
+    { 7, 12, {  67,  49 } }, { 7, 12, {  67,  50 } }, { 7, 12, {  67,  97 } },
+    { 7, 12, {  67,  99 } }, { 7, 12, {  67, 101 } }, { 7, 12, {  67, 105 } },
+    { 7, 12, {  67, 111 } }, { 7, 12, {  67, 115 } }, { 7, 12, {  67, 116 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } }, { 7,  7, {  67,   0 } },
+    { 7,  7, {  67,   0 } }, { 7, 12, {  68,  48 } }, { 7, 12, {  68,  49 } },
+    { 7, 12, {  68,  50 } }, { 7, 12, {  68,  97 } }, { 7, 12, {  68,  99 } },
+    { 7, 12, {  68, 101 } }, { 7, 12, {  68, 105 } }, { 7, 12, {  68, 111 } },
+    { 7, 12, {  68, 115 } }, { 7, 12, {  68, 116 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } }, { 7,  7, {  68,   0 } },
+    { 7, 12, {  69,  48 } }, { 7, 12, {  69,  49 } }, { 7, 12, {  69,  50 } },
+    { 7, 12, {  69,  97 } }, { 7, 12, {  69,  99 } }, { 7, 12, {  69, 101 } },
+    { 7, 12, {  69, 105 } }, { 7, 12, {  69, 111 } }, { 7, 12, {  69, 115 } },
+    { 7, 12, {  69, 116 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } },
+    { 7,  7, {  69,   0 } }, { 7,  7, {  69,   0 } }, { 7, 12, {  70,  48 } },
+    { 7, 12, {  70,  49 } }, { 7, 12, {  70,  50 } }, { 7, 12, {  70,  97 } },
+    { 7, 12, {  70,  99 } }, { 7, 12, {  70, 101 } }, { 7, 12, {  70, 105 } },
+    { 7, 12, {  70, 111 } }, { 7, 12, {  70, 115 } }, { 7, 12, {  70, 116 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } }, { 7,  7, {  70,   0 } },
+    { 7,  7, {  70,   0 } }, { 7, 12, {  71,  48 } }, { 7, 12, {  71,  49 } },
+    { 7, 12, {  71,  50 } }, { 7, 12, {  71,  97 } }, { 7, 12, {  71,  99 } },
+    { 7, 12, {  71, 101 } }, { 7, 12, {  71, 105 } }, { 7, 12, {  71, 111 } },
+    { 7, 12, {  71, 115 } }, { 7, 12, {  71, 116 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } }, { 7,  7, {  71,   0 } },
+    { 7, 12, {  72,  48 } }, { 7, 12, {  72,  49 } }, { 7, 12, {  72,  50 } },
+    { 7, 12, {  72,  97 } }, { 7, 12, {  72,  99 } }, { 7, 12, {  72, 101 } },
+    { 7, 12, {  72, 105 } }, { 7, 12, {  72, 111 } }, { 7, 12, {  72, 115 } },
+    { 7, 12, {  72, 116 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } },
+    { 7,  7, {  72,   0 } }, { 7,  7, {  72,   0 } }, { 7, 12, {  73,  48 } },
+    { 7, 12, {  73,  49 } }, { 7, 12, {  73,  50 } }, { 7, 12, {  73,  97 } },
+    { 7, 12, {  73,  99 } }, { 7, 12, {  73, 101 } }, { 7, 12, {  73, 105 } },
+    { 7, 12, {  73, 111 } }, { 7, 12, {  73, 115 } }, { 7, 12, {  73, 116 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } }, { 7,  7, {  73,   0 } },
+    { 7,  7, {  73,   0 } }, { 7, 12, {  74,  48 } }, { 7, 12, {  74,  49 } },
+    { 7, 12, {  74,  50 } }, { 7, 12, {  74,  97 } }, { 7, 12, {  74,  99 } },
+    { 7, 12, {  74, 101 } }, { 7, 12, {  74, 105 } }, { 7, 12, {  74, 111 } },
+    { 7, 12, {  74, 115 } }, { 7, 12, {  74, 116 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } }, { 7,  7, {  74,   0 } },
+    { 7, 12, {  75,  48 } }, { 7, 12, {  75,  49 } }, { 7, 12, {  75,  50 } },
+    { 7, 12, {  75,  97 } }, { 7, 12, {  75,  99 } }, { 7, 12, {  75, 101 } },
+    { 7, 12, {  75, 105 } }, { 7, 12, {  75, 111 } }, { 7, 12, {  75, 115 } },
+    { 7, 12, {  75, 116 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } },
+    { 7,  7, {  75,   0 } }, { 7,  7, {  75,   0 } }, { 7, 12, {  76,  48 } },
+    { 7, 12, {  76,  49 } }, { 7, 12, {  76,  50 } }, { 7, 12, {  76,  97 } },
+    { 7, 12, {  76,  99 } }, { 7, 12, {  76, 101 } }, { 7, 12, {  76, 105 } },
+    { 7, 12, {  76, 111 } }, { 7, 12, {  76, 115 } }, { 7, 12, {  76, 116 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } }, { 7,  7, {  76,   0 } },
+    { 7,  7, {  76,   0 } }, { 7, 12, {  77,  48 } }, { 7, 12, {  77,  49 } },
+    { 7, 12, {  77,  50 } }, { 7, 12, {  77,  97 } }, { 7, 12, {  77,  99 } },
+    { 7, 12, {  77, 101 } }, { 7, 12, {  77, 105 } }, { 7, 12, {  77, 111 } },
+    { 7, 12, {  77, 115 } }, { 7, 12, {  77, 116 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } }, { 7,  7, {  77,   0 } },
+    { 7, 12, {  78,  48 } }, { 7, 12, {  78,  49 } }, { 7, 12, {  78,  50 } },
+    { 7, 12, {  78,  97 } }, { 7, 12, {  78,  99 } }, { 7, 12, {  78, 101 } },
+    { 7, 12, {  78, 105 } }, { 7, 12, {  78, 111 } }, { 7, 12, {  78, 115 } },
+    { 7, 12, {  78, 116 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } },
+    { 7,  7, {  78,   0 } }, { 7,  7, {  78,   0 } }, { 7, 12, {  79,  48 } },
+    { 7, 12, {  79,  49 } }, { 7, 12, {  79,  50 } }, { 7, 12, {  79,  97 } },
+    { 7, 12, {  79,  99 } }, { 7, 12, {  79, 101 } }, { 7, 12, {  79, 105 } },
+    { 7, 12, {  79, 111 } }, { 7, 12, {  79, 115 } }, { 7, 12, {  79, 116 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } }, { 7,  7, {  79,   0 } },
+    { 7,  7, {  79,   0 } }, { 7, 12, {  80,  48 } }, { 7, 12, {  80,  49 } },
+    { 7, 12, {  80,  50 } }, { 7, 12, {  80,  97 } }, { 7, 12, {  80,  99 } },
+    { 7, 12, {  80, 101 } }, { 7, 12, {  80, 105 } }, { 7, 12, {  80, 111 } },
+    { 7, 12, {  80, 115 } }, { 7, 12, {  80, 116 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } }, { 7,  7, {  80,   0 } },
+    { 7, 12, {  81,  48 } }, { 7, 12, {  81,  49 } }, { 7, 12, {  81,  50 } },
+    { 7, 12, {  81,  97 } }, { 7, 12, {  81,  99 } }, { 7, 12, {  81, 101 } },
+    { 7, 12, {  81, 105 } }, { 7, 12, {  81, 111 } }, { 7, 12, {  81, 115 } },
+    { 7, 12, {  81, 116 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } },
+    { 7,  7, {  81,   0 } }, { 7,  7, {  81,   0 } }, { 7, 12, {  82,  48 } },
+    { 7, 12, {  82,  49 } }, { 7, 12, {  82,  50 } }, { 7, 12, {  82,  97 } },
+    { 7, 12, {  82,  99 } }, { 7, 12, {  82, 101 } }, { 7, 12, {  82, 105 } },
+    { 7, 12, {  82, 111 } }, { 7, 12, {  82, 115 } }, { 7, 12, {  82, 116 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } }, { 7,  7, {  82,   0 } },
+    { 7,  7, {  82,   0 } }, { 7, 12, {  83,  48 } }, { 7, 12, {  83,  49 } },
+    { 7, 12, {  83,  50 } }, { 7, 12, {  83,  97 } }, { 7, 12, {  83,  99 } },
+    { 7, 12, {  83, 101 } }, { 7, 12, {  83, 105 } }, { 7, 12, {  83, 111 } },
+    { 7, 12, {  83, 115 } }, { 7, 12, {  83, 116 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } }, { 7,  7, {  83,   0 } },
+    { 7, 12, {  84,  48 } }, { 7, 12, {  84,  49 } }, { 7, 12, {  84,  50 } },
+    { 7, 12, {  84,  97 } }, { 7, 12, {  84,  99 } }, { 7, 12, {  84, 101 } },
+    { 7, 12, {  84, 105 } }, { 7, 12, {  84, 111 } }, { 7, 12, {  84, 115 } },
+    { 7, 12, {  84, 116 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } },
+    { 7,  7, {  84,   0 } }, { 7,  7, {  84,   0 } }, { 7, 12, {  85,  48 } },
+    { 7, 12, {  85,  49 } }, { 7, 12, {  85,  50 } }, { 7, 12, {  85,  97 } },
+    { 7, 12, {  85,  99 } }, { 7, 12, {  85, 101 } }, { 7, 12, {  85, 105 } },
+    { 7, 12, {  85, 111 } }, { 7, 12, {  85, 115 } }, { 7, 12, {  85, 116 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } }, { 7,  7, {  85,   0 } },
+    { 7,  7, {  85,   0 } }, { 7, 12, {  86,  48 } }, { 7, 12, {  86,  49 } },
+    { 7, 12, {  86,  50 } }, { 7, 12, {  86,  97 } }, { 7, 12, {  86,  99 } },
+    { 7, 12, {  86, 101 } }, { 7, 12, {  86, 105 } }, { 7, 12, {  86, 111 } },
+    { 7, 12, {  86, 115 } }, { 7, 12, {  86, 116 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } }, { 7,  7, {  86,   0 } },
+    { 7, 12, {  87,  48 } }, { 7, 12, {  87,  49 } }, { 7, 12, {  87,  50 } },
+    { 7, 12, {  87,  97 } }, { 7, 12, {  87,  99 } }, { 7, 12, {  87, 101 } },
+    { 7, 12, {  87, 105 } }, { 7, 12, {  87, 111 } }, { 7, 12, {  87, 115 } },
+    { 7, 12, {  87, 116 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } },
+    { 7,  7, {  87,   0 } }, { 7,  7, {  87,   0 } }, { 7, 12, {  89,  48 } },
+    { 7, 12, {  89,  49 } }, { 7, 12, {  89,  50 } }, { 7, 12, {  89,  97 } },
+    { 7, 12, {  89,  99 } }, { 7, 12, {  89, 101 } }, { 7, 12, {  89, 105 } },
+    { 7, 12, {  89, 111 } }, { 7, 12, {  89, 115 } }, { 7, 12, {  89, 116 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } }, { 7,  7, {  89,   0 } },
+    { 7,  7, {  89,   0 } }, { 7, 12, { 106,  48 } }, { 7, 12, { 106,  49 } },
+    { 7, 12, { 106,  50 } }, { 7, 12, { 106,  97 } }, { 7, 12, { 106,  99 } },
+    { 7, 12, { 106, 101 } }, { 7, 12, { 106, 105 } }, { 7, 12, { 106, 111 } },
+    { 7, 12, { 106, 115 } }, { 7, 12, { 106, 116 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } }, { 7,  7, { 106,   0 } },
+    { 7, 12, { 107,  48 } }, { 7, 12, { 107,  49 } }, { 7, 12, { 107,  50 } },
+    { 7, 12, { 107,  97 } }, { 7, 12, { 107,  99 } }, { 7, 12, { 107, 101 } },
+    { 7, 12, { 107, 105 } }, { 7, 12, { 107, 111 } }, { 7, 12, { 107, 115 } },
+    { 7, 12, { 107, 116 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } },
+    { 7,  7, { 107,   0 } }, { 7,  7, { 107,   0 } }, { 7, 12, { 113,  48 } },
+    { 7, 12, { 113,  49 } }, { 7, 12, { 113,  50 } }, { 7, 12, { 113,  97 } },
+    { 7, 12, { 113,  99 } }, { 7, 12, { 113, 101 } }, { 7, 12, { 113, 105 } },
+    { 7, 12, { 113, 111 } }, { 7, 12, { 113, 115 } }, { 7, 12, { 113, 116 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } }, { 7,  7, { 113,   0 } },
+    { 7,  7, { 113,   0 } }, { 7, 12, { 118,  48 } }, { 7, 12, { 118,  49 } },
+    { 7, 12, { 118,  50 } }, { 7, 12, { 118,  97 } }, { 7, 12, { 118,  99 } },
+    { 7, 12, { 118, 101 } }, { 7, 12, { 118, 105 } }, { 7, 12, { 118, 111 } },
+    { 7, 12, { 118, 115 } }, { 7, 12, { 118, 116 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } }, { 7,  7, { 118,   0 } },
+    { 7, 12, { 119,  48 } }, { 7, 12, { 119,  49 } }, { 7, 12, { 119,  50 } },
+    { 7, 12, { 119,  97 } }, { 7, 12, { 119,  99 } }, { 7, 12, { 119, 101 } },
+    { 7, 12, { 119, 105 } }, { 7, 12, { 119, 111 } }, { 7, 12, { 119, 115 } },
+    { 7, 12, { 119, 116 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } },
+    { 7,  7, { 119,   0 } }, { 7,  7, { 119,   0 } }, { 7, 12, { 120,  48 } },
+    { 7, 12, { 120,  49 } }, { 7, 12, { 120,  50 } }, { 7, 12, { 120,  97 } },
+    { 7, 12, { 120,  99 } }, { 7, 12, { 120, 101 } }, { 7, 12, { 120, 105 } },
+    { 7, 12, { 120, 111 } }, { 7, 12, { 120, 115 } }, { 7, 12, { 120, 116 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } }, { 7,  7, { 120,   0 } },
+    { 7,  7, { 120,   0 } }, { 7, 12, { 121,  48 } }, { 7, 12, { 121,  49 } },
+    { 7, 12, { 121,  50 } }, { 7, 12, { 121,  97 } }, { 7, 12, { 121,  99 } },
+    { 7, 12, { 121, 101 } }, { 7, 12, { 121, 105 } }, { 7, 12, { 121, 111 } },
+    { 7, 12, { 121, 115 } }, { 7, 12, { 121, 116 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } }, { 7,  7, { 121,   0 } },
+    { 7, 12, { 122,  48 } }, { 7, 12, { 122,  49 } }, { 7, 12, { 122,  50 } },
+    { 7, 12, { 122,  97 } }, { 7, 12, { 122,  99 } }, { 7, 12, { 122, 101 } },
+    { 7, 12, { 122, 105 } }, { 7, 12, { 122, 111 } }, { 7, 12, { 122, 115 } },
+    { 7, 12, { 122, 116 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } },
+    { 7,  7, { 122,   0 } }, { 7,  7, { 122,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } }, { 8,  8, {  38,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } }, { 8,  8, {  42,   0 } },
+    { 8,  8, {  42,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } },
+    { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } },
+    { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } },
+    { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } },
+    { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } },
+    { 8,  8, {  44,   0 } }, { 8,  8, {  44,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } }, { 8,  8, {  59,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } }, { 8,  8, {  88,   0 } },
+    { 8,  8, {  88,   0 } }, { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } },
+    { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } },
+    { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } },
+    { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } },
+    { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } },
+    { 8,  8, {  90,   0 } }, { 8,  8, {  90,   0 } }, {10, 10, {  33,   0 } },
+    {10, 10, {  33,   0 } }, {10, 10, {  33,   0 } }, {10, 10, {  33,   0 } },
+    {10, 10, {  34,   0 } }, {10, 10, {  34,   0 } }, {10, 10, {  34,   0 } },
+    {10, 10, {  34,   0 } }, {10, 10, {  40,   0 } }, {10, 10, {  40,   0 } },
+    {10, 10, {  40,   0 } }, {10, 10, {  40,   0 } }, {10, 10, {  41,   0 } },
+    {10, 10, {  41,   0 } }, {10, 10, {  41,   0 } }, {10, 10, {  41,   0 } },
+    {10, 10, {  63,   0 } }, {10, 10, {  63,   0 } }, {10, 10, {  63,   0 } },
+    {10, 10, {  63,   0 } }, {11, 11, {  39,   0 } }, {11, 11, {  39,   0 } },
+    {11, 11, {  43,   0 } }, {11, 11, {  43,   0 } }, {11, 11, { 124,   0 } },
+    {11, 11, { 124,   0 } }, {12, 12, {  35,   0 } }, {12, 12, {  62,   0 } },
+    { 0,  0, {   0,   0 } }, { 0,  0, {   0,   0 } }, { 0,  0, {   0,   0 } },
+    { 0,  0, {   0,   0 } },
+};
+
+
+static const struct hdec_long_el hdec_long_codes[30 - HDEC_TABLE_BITS] =
+{
+    {     0x1ff8,   6,   0, },    /* 13 bits */
+    {     0x3ffc,   2,   6, },    /* 14 bits */
+    {     0x7ffc,   3,   8, },    /* 15 bits */
+    {        0x0,   0,  11, },    /* 16 bits */
+    {        0x0,   0,  11, },    /* 17 bits */
+    {        0x0,   0,  11, },    /* 18 bits */
+    {    0x7fff0,   3,  11, },    /* 19 bits */
+    {    0xfffe6,   8,  14, },    /* 20 bits */
+    {   0x1fffdc,  13,  22, },    /* 21 bits */
+    {   0x3fffd2,  26,  35, },    /* 22 bits */
+    {   0x7fffd8,  29,  61, },    /* 23 bits */
+    {   0xffffea,  12,  90, },    /* 24 bits */
+    {  0x1ffffec,   4, 102, },    /* 25 bits */
+    {  0x3ffffe0,  15, 106, },    /* 26 bits */
+    {  0x7ffffde,  19, 121, },    /* 27 bits */
+    {  0xfffffe2,  29, 140, },    /* 28 bits */
+    {        0x0,   0, 169, },    /* 29 bits */
+    { 0x3ffffffc,   4, 169, },    /* 30 bits */
+};
+
+static const uint16_t hdec_long_syms[173] =
+{
+      0,  36,  64,  91,  93, 126,  94, 125,  60,  96,
+    123,  92, 195, 208, 128, 130, 131, 162, 184, 194,
+    224, 226, 153, 161, 167, 172, 176, 177, 179, 209,
+    216, 217, 227, 229, 230, 129, 132, 133, 134, 136,
+    146, 154, 156, 160, 163, 164, 169, 170, 173, 178,
+    181, 185, 186, 187, 189, 190, 196, 198, 228, 232,
+    233,   1, 135, 137, 138, 139, 140, 141, 143, 147,
+    149, 150, 151, 152, 155, 157, 158, 165, 166, 168,
+    174, 175, 180, 182, 183, 188, 191, 197, 231, 239,
+      9, 142, 144, 145, 148, 159, 171, 206, 215, 225,
+    236, 237, 199, 207, 234, 235, 192, 193, 200, 201,
+    202, 205, 210, 213, 218, 219, 238, 240, 242, 243,
+    255, 203, 204, 211, 212, 214, 221, 222, 223, 241,
+    244, 245, 246, 247, 248, 250, 251, 252, 253, 254,
+      2,   3,   4,   5,   6,   7,   8,  11,  12,  14,
+     15,  16,  17,  18,  19,  20,  21,  23,  24,  25,
+     26,  27,  28,  29,  30,  31, 127, 220, 249,  10,
+     13,  22, 256,
+};
+
 #define lshpack_arr_init(a) do {                                        \
     memset((a), 0, sizeof(*(a)));                                       \
 } while (0)
@@ -5474,31 +6934,39 @@ lshpack_enc_hist_used (const struct lshpack_enc *enc)
 
 
 #define LSHPACK_XXH_SEED 0
-#define XXH_NAMEVAL_WIDTH 9
-#define XXH_NAMEVAL_SHIFT 2
-#define XXH_NAME_WIDTH 9
-#define XXH_NAME_SHIFT 9
 
-static const unsigned char nameval2id[ 1 << XXH_NAMEVAL_WIDTH ] =
+/* Static table lookup uses a perfect hash over the 52 distinct names in
+ * the static table.  The key is made up of the name length and its first
+ * and last characters; it is hashed using multiplication.  The generated
+ * table maps the hash to the ID of the first static table entry with
+ * that name.  Because arbitrary names may hash to an occupied slot, the
+ * name is always compared.
+ *
+ * The multiplier and the table are generated by tools/gen-stx-phash.py;
+ * rerun it if the key or the static table changes.
+ */
+#define STX_PHASH_BITS 7
+#define STX_PHASH_MULT 0x64AD062FU
+
+static const unsigned char stx_name2id[ 1 << STX_PHASH_BITS ] =
 {
-    [475]  =  2,   [361]  =  3,   [149]  =  4,   [219]  =  5,   [511]  =  6,
-    [299]  =  7,   [298]  =  8,   [19]   =  9,   [370]  =  10,  [95]   =  11,
-    [158]  =  12,  [281]  = 13,   [423]  =  14,  [501]  =  16,
+    [5]   = 25, [7]   =  1, [9]   = 31, [11]  = 40, [12]  = 55, [16]  = 53,
+    [18]  = 37, [19]  = 45, [20]  = 61, [21]  = 47, [22]  = 21, [27]  = 48,
+    [31]  = 59, [35]  = 60, [40]  = 52, [41]  = 34, [42]  = 23, [47]  =  2,
+    [50]  =  6, [51]  = 22, [54]  = 35, [57]  = 18, [58]  = 50, [59]  = 30,
+    [61]  = 56, [66]  = 44, [70]  = 42, [71]  = 51, [73]  = 57, [75]  = 41,
+    [76]  = 33, [80]  = 39, [81]  = 24, [82]  = 27, [85]  = 38, [86]  =  4,
+    [88]  = 26, [90]  = 32, [92]  = 19, [93]  =  8, [101] = 36, [102] = 46,
+    [103] = 58, [105] = 49, [106] = 20, [107] = 54, [110] = 29, [111] = 15,
+    [112] = 43, [115] = 17, [118] = 28, [121] = 16,
 };
 
-static const unsigned char name2id[ 1 << XXH_NAME_WIDTH ] =
+/* Number of consecutive static table entries with non-empty values that
+ * begin at given ID.  All of them have the same name.
+ */
+static const unsigned char stx_nameval_count[ HPACK_STATIC_TABLE_SIZE + 1 ] =
 {
-    [215]  =  1,   [207]  =  2,   [286]  =  4,   [321]  =  6,   [289]  =  8,
-    [63]   =  15,  [122]  =  16,  [209]  =  17,  [194]  =  18,  [331]  =  19,
-    [273]  =  20,  [278]  =  21,  [431]  =  22,  [232]  =  23,  [182]  =  24,
-    [483]  =  25,  [59]   =  26,  [52]   =  27,  [422]  =  28,  [62]   =  29,
-    [381]  =  30,  [233]  =  31,  [110]  =  32,  [15]   =  33,  [85]   =  34,
-    [452]  =  35,  [28]   =  36,  [414]  =  37,  [82]   =  38,  [345]  =  39,
-    [467]  =  40,  [501]  =  41,  [299]  =  42,  [168]  =  43,  [326]  =  44,
-    [199]  =  45,  [360]  =  46,  [36]   =  47,  [349]  =  48,  [347]  =  49,
-    [126]  =  50,  [208]  =  51,  [416]  =  52,  [373]  =  53,  [477]  =  54,
-    [33]   =  55,  [316]  =  56,  [156]  =  57,  [386]  =  58,  [116]  =  59,
-    [450]  =  60,  [297]  =  61,
+    [2] = 2, [4] = 2, [6] = 2, [8] = 7, [16] = 1,
 };
 
 
@@ -5506,48 +6974,42 @@ static const unsigned char name2id[ 1 << XXH_NAME_WIDTH ] =
 #if !LS_HPACK_EMIT_TEST_CODE
 static
 #endif
-        unsigned
-lshpack_enc_get_static_nameval (uint32_t nameval_hash, const char *name,
-        unsigned name_len, const char *val, unsigned val_len)
+       unsigned
+lshpack_enc_get_static_name (const char *name, unsigned name_len)
 {
-    unsigned i;
- 
-    i = (nameval_hash >> XXH_NAMEVAL_SHIFT) & ((1 << XXH_NAMEVAL_WIDTH) - 1);
-    if (nameval2id[i])
-    {
-        i = nameval2id[i] - 1;
-        if (static_table[i].name_len == name_len
-            && static_table[i].val_len == val_len
-            && memcmp(name, static_table[i].name, name_len) == 0
-            && memcmp(val, static_table[i].val, val_len) == 0)
-        {
-            return i + 1;
-        }
-    }
+    uint32_t key;
+    unsigned id;
+
+    if (name_len == 0)
+        return 0;
+
+    key = name_len | (unsigned char) name[0] << 8
+                   | (unsigned char) name[name_len - 1] << 16;
+    id = stx_name2id[ (key * STX_PHASH_MULT) >> (32 - STX_PHASH_BITS) ];
+    if (id > 0
+        && static_table[id - 1].name_len == name_len
+        && memcmp(name, static_table[id - 1].name, name_len) == 0)
+        return id;
 
     return 0;
 }
 
 
+/* `name_id' is the value returned by lshpack_enc_get_static_name() */
 #if !LS_HPACK_EMIT_TEST_CODE
 static
 #endif
-       unsigned
-lshpack_enc_get_static_name (uint32_t name_hash, const char *name,
-                                            unsigned name_len)
+        unsigned
+lshpack_enc_get_static_nameval (unsigned name_id, const char *val,
+                                                        unsigned val_len)
 {
-    unsigned i;
+    unsigned i, end;
 
-    i = (name_hash >> XXH_NAME_SHIFT) & ((1 << XXH_NAME_WIDTH) - 1);
-    if (name2id[i])
-    {
-        i = name2id[i] - 1;
-        if (static_table[i].name_len == name_len
-            && memcmp(name, static_table[i].name, name_len) == 0)
-        {
+    end = name_id - 1 + stx_nameval_count[name_id];
+    for (i = name_id - 1; i < end; ++i)
+        if (static_table[i].val_len == val_len
+            && memcmp(val, static_table[i].val, val_len) == 0)
             return i + 1;
-        }
-    }
 
     return 0;
 }
@@ -5557,37 +7019,17 @@ unsigned
 lshpack_enc_get_stx_tab_id (const char *name, unsigned name_len,
                                     const char *val, unsigned val_len)
 {
-    uint32_t name_hash, nameval_hash;
-    unsigned i;
+    unsigned name_id, id;
 
-    name_hash = XXH32(name, name_len, 0);
-    nameval_hash = XXH32(val, val_len, name_hash);
-
-    i = (nameval_hash >> XXH_NAMEVAL_SHIFT) & ((1 << XXH_NAMEVAL_WIDTH) - 1);
-    if (nameval2id[i])
-    {
-        i = nameval2id[i] - 1;
-        if (static_table[i].name_len == name_len
-            && static_table[i].val_len == val_len
-            && memcmp(name, static_table[i].name, name_len) == 0
-            && memcmp(val, static_table[i].val, val_len) == 0)
-        {
-            return i + 1;
-        }
-    }
+    name_id = lshpack_enc_get_static_name(name, name_len);
+    if (name_id == 0)
+        return 0;
 
-    i = (name_hash >> XXH_NAME_SHIFT) & ((1 << XXH_NAME_WIDTH) - 1);
-    if (name2id[i])
-    {
-        i = name2id[i] - 1;
-        if (static_table[i].name_len == name_len
-            && memcmp(name, static_table[i].name, name_len) == 0)
-        {
-            return i + 1;
-        }
-    }
+    id = lshpack_enc_get_static_nameval(name_id, val, val_len);
+    if (id > 0)
+        return id;
 
-    return 0;
+    return name_id;
 }
 
 
@@ -5609,15 +7051,19 @@ henc_find_table_id (struct lshpack_enc *enc, uint32_t name_hash,
         unsigned value_len, int *val_matched)
 {
     struct lshpack_enc_table_entry *entry;
-    unsigned buckno, static_table_id;
+    unsigned buckno, static_table_id, static_name_id;
 
     /* First, look for a match in the static table: */
-    static_table_id = lshpack_enc_get_static_nameval(nameval_hash, name,
-                                            name_len, value, value_len);
-    if (static_table_id > 0)
+    static_name_id = lshpack_enc_get_static_name(name, name_len);
+    if (static_name_id > 0)
     {
-        *val_matched = 1;
-        return static_table_id;
+        static_table_id = lshpack_enc_get_static_nameval(static_name_id,
+                                                        value, value_len);
+        if (static_table_id > 0)
+        {
+            *val_matched = 1;
+            return static_table_id;
+        }
     }
 
     buckno = BUCKNO(enc->hpe_nbits, nameval_hash);
@@ -5633,11 +7079,10 @@ henc_find_table_id (struct lshpack_enc *enc, uint32_t name_hash,
             return henc_calc_table_id(enc, entry);
         }
 
-    static_table_id = lshpack_enc_get_static_name(name_hash, name, name_len);
-    if (static_table_id > 0)
+    if (static_name_id > 0)
     {
         *val_matched = 0;
-        return static_table_id;
+        return static_name_id;
     }
 
     /* Search by name only: */
@@ -5691,46 +7136,84 @@ lshpack_enc_enc_int (unsigned char *dst, unsigned char *const end,
 }
 
 
-#if !LS_HPACK_EMIT_TEST_CODE
-static 
-#endif
-       int
-henc_huffman_enc (const unsigned char *src, const unsigned char *const src_end,
-                                            unsigned char *dst, int dst_len)
+/* Return number of bytes `src' takes up when Huffman-encoded.  Four
+ * independent sums let the compiler overlap the table lookups.
+ */
+unsigned
+lshpack_enc_huff_len (const unsigned char *src,
+                                        const unsigned char *const src_end)
 {
-    const unsigned char *p_src = src;
-    unsigned char *p_dst = dst;
-    unsigned char *dst_end = p_dst + dst_len;
-    uint64_t bits = 0;
-    int bits_left = 40;
-    struct encode_el cur_enc_code;
+    const unsigned char *p = src;
+    unsigned n0 = 0, n1 = 0, n2 = 0, n3 = 0;
 
-    assert(dst_len > 0);
+    for ( ; src_end - p >= 4; p += 4)
+    {
+        n0 += encode_bits[p[0]];
+        n1 += encode_bits[p[1]];
+        n2 += encode_bits[p[2]];
+        n3 += encode_bits[p[3]];
+    }
+    for ( ; p < src_end; ++p)
+        n0 += encode_bits[*p];
 
-    while (p_src != src_end)
+    return (n0 + n1 + n2 + n3 + 7) / 8;
+}
+
+
+/* The caller guarantees that `dst' has room for lshpack_enc_huff_len()
+ * bytes.  Bits are accumulated in a 64-bit register and flushed to `dst'
+ * 32 bits at a time.  Because codes are at most 30 bits long, the
+ * accumulator never holds more than 31 + 30 bits.
+ */
+static unsigned
+henc_huff_encode (const unsigned char *src, const unsigned char *const src_end,
+                                                            unsigned char *dst)
+{
+    unsigned char *const dst_orig = dst;
+    struct encode_el code;
+    uint64_t bits = 0;
+    unsigned n_bits = 0, pad;
+    uint32_t word;
+
+    while (src < src_end)
     {
-        cur_enc_code = encode_table[(int) *p_src++];
-        assert(bits_left >= cur_enc_code.bits); //  (possible negative shift, undefined behavior)
-        bits |= (uint64_t)cur_enc_code.code << (bits_left - cur_enc_code.bits);
-        bits_left -= cur_enc_code.bits;
-        while (bits_left <= 32)
+        code = encode_table[*src++];
+        bits = (bits << code.bits) | code.code;
+        n_bits += code.bits;
+        if (n_bits >= 32)
         {
-            *p_dst++ = (unsigned char) (bits >> 32);
-            bits <<= 8;
-            bits_left += 8;
-            if (p_dst == dst_end)
-                return -1;  //dst does not have enough space
+            n_bits -= 32;
+            word = (uint32_t) (bits >> n_bits);
+            dst[0] = word >> 24;
+            dst[1] = word >> 16;
+            dst[2] = word >> 8;
+            dst[3] = word;
+            dst += 4;
         }
     }
 
-    if (bits_left != 40)
+    /* Pad with the most significant bits of EOS, which are all ones */
+    pad = (8 - (n_bits & 7)) & 7;
+    bits = (bits << pad) | ((1u << pad) - 1);
+    n_bits += pad;
+    while (n_bits > 0)
     {
-        assert(bits_left < 40 && bits_left > 0);
-        bits |= ((uint64_t)1 << bits_left) - 1;
-        *p_dst++ = (unsigned char) (bits >> 32);
+        n_bits -= 8;
+        *dst++ = (unsigned char) (bits >> n_bits);
     }
 
-    return p_dst - dst;
+    return dst - dst_orig;
+}
+
+
+int
+lshpack_enc_huff_encode (const unsigned char *src,
+        const unsigned char *const src_end, unsigned char *dst, int dst_len)
+{
+    if (lshpack_enc_huff_len(src, src_end) > (unsigned) dst_len)
+        return -1;  //dst does not have enough space
+
+    return henc_huff_encode(src, src_end, dst);
 }
 
 
@@ -5741,73 +7224,40 @@ static
 lshpack_enc_enc_str (unsigned char *const dst, size_t dst_len,
                         const unsigned char *str, unsigned str_len)
 {
-    unsigned char size_buf[4];
     unsigned char *p;
-    unsigned size_len;
-    int rc;
-
-    if (dst_len > 1)
-        /* We guess that the string size fits into a single byte -- meaning
-         * compressed string of size 126 and smaller -- which is the normal
-         * case.  Thus, we immediately write compressed string to the output
-         * buffer.  If our guess is not correct, we fix it later.
-         */
-        rc = henc_huffman_enc(str, str + str_len, dst + 1, dst_len - 1);
-    else if (dst_len == 1)
-        /* Here, the call can only succeed if the string to encode is empty. */
-        rc = 0;
-    else
-        return -1;
-
-    /*
-     * Check if need huffman encoding or not
-     * Comment: (size_t)rc <= str_len   = means if same length, still use
-     *                                                              Huffman
-     *                     ^
+    unsigned enc_len;
+    int huffman;
+
+    /* Compute Huffman length first, so that the choice between raw and
+     * Huffman encoding is made up front and the string is encoded once,
+     * directly after its size.  If Huffman encoding does not make the
+     * string shorter, raw encoding is used.  (Equal length still uses
+     * Huffman.)
      */
-    if (rc > 0 && (size_t)rc <= str_len)
-    {
-        if (rc < 127)
-        {
-            *dst = 0x80 | rc;
-            return 1 + rc;
-        }
-        size_buf[0] = 0x80;
-        str_len = rc;
-        str = dst + 1;
-    }
-    else if (str_len <= dst_len - 1)
-    {
-        if (str_len < 127)
-        {
-            *dst = (unsigned char) str_len;
-            memcpy(dst + 1, str, str_len);
-            return 1 + str_len;
-        }
-        size_buf[0] = 0x00;
-    }
-    else
-        return -1;
+    enc_len = lshpack_enc_huff_len(str, str + str_len);
+    huffman = str_len > 0 && enc_len <= str_len;
+    if (!huffman)
+        enc_len = str_len;
 
-    /* The guess of one-byte size was incorrect.  Perform necessary
-     * adjustments.
-     */
-    p = lshpack_enc_enc_int(size_buf, size_buf + sizeof(size_buf), str_len, 7);
-    if (p == size_buf)
+    if (dst_len < 1)
+        return -1;
+    *dst = huffman ? 0x80 : 0x00;
+    p = lshpack_enc_enc_int(dst, dst + dst_len, enc_len, 7);
+    if (p == dst)
         return -1;
 
-    size_len = p - size_buf;
-    assert(size_len > 1);
-
-    /* Check if there is enough room in the output buffer for both
-     * encoded size and the string.
-     */
-    if (size_len + str_len > dst_len)
+    if ((size_t) (dst + dst_len - p) < enc_len)
         return -1;
 
-    memmove(dst + size_len, str, str_len);
-    memcpy(dst, size_buf, size_len);
-    return size_len + str_len;
+    if (huffman)
+        p += henc_huff_encode(str, str + str_len, p);
+    else
+    {
+        memcpy(p, str, str_len);
+        p += str_len;
+    }
+
+    return p - dst;
 }
 
 
@@ -6294,8 +7744,11 @@ hdec_huff_dec4bits (uint8_t src_4bits, unsigned char *dst,
 }
 
 
-static int
-hdec_huff_decode (const unsigned char *src, int src_len,
+/* This is the reference decoder: it is simple, but slow, as it processes
+ * input four bits at a time.
+ */
+int
+lshpack_dec_huff_decode_nibbles (const unsigned char *src, int src_len,
                                             unsigned char *dst, int dst_len)
 {
     const unsigned char *p_src = src;
@@ -6326,6 +7779,134 @@ hdec_huff_decode (const unsigned char *src, int src_len,
 }
 
 
+/* Decode a code longer than HDEC_TABLE_BITS bits.  `code' contains the
+ * next 30 bits of input, padded with ones if necessary.  Returns the
+ * symbol and sets `len'; -1 is returned if the code is EOS or if it is
+ * longer than `avail_bits'.
+ */
+static int
+hdec_huff_decode_long (uint32_t code, unsigned avail_bits, unsigned *len)
+{
+    const struct hdec_long_el *el;
+    uint32_t prefix;
+    unsigned n_bits;
+    int sym;
+
+    for (n_bits = HDEC_TABLE_BITS + 1; n_bits <= 30; ++n_bits)
+    {
+        el = &hdec_long_codes[n_bits - HDEC_TABLE_BITS - 1];
+        prefix = code >> (30 - n_bits);
+        if (prefix - el->first < el->count)
+        {
+            sym = hdec_long_syms[el->offset + prefix - el->first];
+            if (sym == 256 || n_bits > avail_bits)
+                return -1;
+            *len = n_bits;
+            return sym;
+        }
+    }
+
+    return -1;
+}
+
+
+/* Decoding is performed using a 64-bit bit buffer.  The buffer is kept
+ * full, so that the table lookup (and, when necessary, decoding of a long
+ * code) does not need to check whether there is enough input.
+ *
+ * Returns number of bytes written to `dst', -1 if input is invalid, or
+ * -2 if `dst' is too small.
+ */
+int
+lshpack_dec_huff_decode (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_start = dst;
+    unsigned char *const dst_end = dst + dst_len;
+    struct hdec_el el;
+    uint64_t buf;
+    uint32_t code;
+    unsigned avail_bits, idx, n_syms, len;
+    int sym;
+
+    buf = 0;
+    avail_bits = 0;
+
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf = (buf << 8) | *src++;
+            avail_bits += 8;
+        }
+        /* If there are fewer than HDEC_TABLE_BITS bits, input is
+         * exhausted.
+         */
+        if (avail_bits < HDEC_TABLE_BITS)
+            break;
+
+        idx = (buf >> (avail_bits - HDEC_TABLE_BITS))
+                                        & ((1u << HDEC_TABLE_BITS) - 1);
+        el = hdec_table[idx];
+        if (el.len1)
+        {
+            n_syms = 1 + (el.len != el.len1);
+            if (dst_end - dst < (intptr_t) n_syms)
+                return -2;
+            dst[0] = el.sym[0];
+            if (n_syms > 1)
+                dst[1] = el.sym[1];
+            dst += n_syms;
+            avail_bits -= el.len;
+        }
+        else
+        {
+            if (avail_bits >= 30)
+                code = (uint32_t) (buf >> (avail_bits - 30)) & 0x3FFFFFFF;
+            else
+                code = (uint32_t) ((buf << (30 - avail_bits))
+                                    | ((1u << (30 - avail_bits)) - 1))
+                                                            & 0x3FFFFFFF;
+            sym = hdec_huff_decode_long(code, avail_bits, &len);
+            if (sym < 0)
+                return -1;
+            if (dst == dst_end)
+                return -2;
+            *dst++ = sym;
+            avail_bits -= len;
+        }
+    }
+
+    /* Fewer than HDEC_TABLE_BITS bits are left.  Pad them with ones and
+     * decode one symbol at a time: the second symbol in the table entry
+     * may include padding.
+     */
+    while (avail_bits > 0)
+    {
+        idx = ((buf << (HDEC_TABLE_BITS - avail_bits))
+                        | ((1u << (HDEC_TABLE_BITS - avail_bits)) - 1))
+                                        & ((1u << HDEC_TABLE_BITS) - 1);
+        el = hdec_table[idx];
+        if (el.len1 == 0 || el.len1 > avail_bits)
+            break;
+        if (dst == dst_end)
+            return -2;
+        *dst++ = el.sym[0];
+        avail_bits -= el.len1;
+    }
+
+    /* RFC 7541, Section 5.2: padding is the most significant bits of the
+     * EOS code (all ones) and must be strictly shorter than eight bits.
+     */
+    if (avail_bits >= 8
+            || (buf & ((1u << avail_bits) - 1)) != (1u << avail_bits) - 1)
+        return -1;
+
+    return dst - dst_start;
+}
+
+
 //reutrn the length in the dst, also update the src
 #if !LS_HPACK_EMIT_TEST_CODE
 static
@@ -6349,7 +7930,7 @@ hdec_dec_str (unsigned char *dst, size_t dst_len, const unsigned char **src,
 
     if (is_huffman)
     {
-        ret = hdec_huff_decode(*src, len, dst, dst_len);
+        ret = lshpack_dec_huff_decode(*src, len, dst, dst_len);
         if (ret < 0)
             return -3; //Wrong code
 
@@ -6357,7 +7938,7 @@ hdec_dec_str (unsigned char *dst, size_t dst_len, const unsigned char **src,
     }
     else
     {
-        if (dst_len < (size_t)(src_end - (*src)))
+        if (dst_len < len)
             ret = -3;  //dst not enough space
         else
         {
@@ -281,6 +281,33 @@ unsigned
 lshpack_enc_get_stx_tab_id (const char *name, unsigned name_len,
                                 const char *val, unsigned val_len);
 
+/* Huffman encoder and decoders are exposed for testing and benchmarking.
+ *
+ * The encoder returns number of bytes written to `dst' or -1 if `dst' is
+ * too small.  lshpack_enc_huff_len() returns the number of bytes the
+ * encoder would write.
+ */
+int
+lshpack_enc_huff_encode (const unsigned char *src,
+        const unsigned char *const src_end, unsigned char *dst, int dst_len);
+
+unsigned
+lshpack_enc_huff_len (const unsigned char *src,
+                                        const unsigned char *const src_end);
+
+/* The decoders return number of bytes written to `dst', -1 if input is
+ * not valid, or -2 if `dst' is too small.  lshpack_dec_huff_decode() is
+ * the one used by the library; lshpack_dec_huff_decode_nibbles() is the
+ * slower reference implementation.
+ */
+int
+lshpack_dec_huff_decode (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_nibbles (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
 #ifdef __cplusplus
 }
 #endif
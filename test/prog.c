@@ -415,6 +415,14 @@ prog_prep (struct prog *prog)
             return -1;
     }
 
+    /* Departure times are only useful if the kernel knows about them */
+    if (prog->prog_settings.es_txtime_horizon)
+    {
+        struct service_port *sport;
+        TAILQ_FOREACH(sport, prog->prog_sports, next_sport)
+            sport->sp_flags |= SPORT_TXTIME;
+    }
+
 
     prog->prog_eb = event_base_new();
     prog->prog_engine = lsquic_engine_new(prog->prog_engine_flags,
@@ -16,6 +16,11 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#if __linux__
+#include <netinet/udp.h>    /* For UDP_SEGMENT */
+#include <linux/net_tstamp.h>   /* For struct sock_txtime */
+#include <time.h>
+#endif
 #else
 #include <Windows.h>
 #include <WinSock2.h>
@@ -30,6 +35,23 @@
 #include <sys/types.h>
 
 #include "test_config.h"
+
+#if __linux__ && defined(SO_TXTIME)
+#   define TXTIME_SUPPORTED 1
+#   define TXTIME_CMSG_SZ CMSG_SPACE(sizeof(uint64_t))
+#else
+#   define TXTIME_SUPPORTED 0
+#   define TXTIME_CMSG_SZ 0
+#endif
+
+#if __linux__ && defined(UDP_SEGMENT)
+#   define GSO_SUPPORTED 1
+#   define GSO_CMSG_SZ CMSG_SPACE(sizeof(uint16_t))
+#else
+#   define GSO_SUPPORTED 0
+#   define GSO_CMSG_SZ 0
+#endif
+
 #if HAVE_REGEX
 #include <regex.h>
 #endif
@@ -94,6 +116,7 @@ struct packets_in
 #endif
     struct sockaddr_storage *local_addresses,
                             *peer_addresses;
+    struct lsquic_in_spec   *specs;
     unsigned                 n_alloc;
     unsigned                 data_sz;
 };
@@ -176,6 +199,7 @@ allocate_packets_in (SOCKET_TYPE fd)
     packs_in->vecs = malloc(n_alloc * sizeof(packs_in->vecs[0]));
     packs_in->local_addresses = malloc(n_alloc * sizeof(packs_in->local_addresses[0]));
     packs_in->peer_addresses = malloc(n_alloc * sizeof(packs_in->peer_addresses[0]));
+    packs_in->specs = malloc(n_alloc * sizeof(packs_in->specs[0]));
 
     return packs_in;
 }
@@ -184,6 +208,7 @@ allocate_packets_in (SOCKET_TYPE fd)
 static void
 free_packets_in (struct packets_in *packs_in)
 {
+    free(packs_in->specs);
     free(packs_in->peer_addresses);
     free(packs_in->local_addresses);
     free(packs_in->ctlmsg_data);
@@ -588,18 +613,21 @@ read_handler (evutil_socket_t fd, short flags, void *ctx)
         n_batches += iter.ri_idx > 0;
 
         for (n = 0; n < iter.ri_idx; ++n)
-            if (0 > lsquic_engine_packet_in(engine,
+        {
 #ifndef WIN32
-                        packs_in->vecs[n].iov_base,
-                        packs_in->vecs[n].iov_len,
+            packs_in->specs[n].buf = packs_in->vecs[n].iov_base;
+            packs_in->specs[n].sz  = packs_in->vecs[n].iov_len;
 #else
-                        (const unsigned char *) packs_in->vecs[n].buf,
-                        packs_in->vecs[n].len,
+            packs_in->specs[n].buf = (unsigned char *) packs_in->vecs[n].buf;
+            packs_in->specs[n].sz  = packs_in->vecs[n].len;
 #endif
-                        (struct sockaddr *) &packs_in->local_addresses[n],
-                        (struct sockaddr *) &packs_in->peer_addresses[n],
-                        sport))
-                break;
+            packs_in->specs[n].local_sa =
+                        (struct sockaddr *) &packs_in->local_addresses[n];
+            packs_in->specs[n].peer_sa =
+                        (struct sockaddr *) &packs_in->peer_addresses[n];
+            packs_in->specs[n].peer_ctx = sport;
+        }
+        (void) lsquic_engine_packets_in(engine, packs_in->specs, n);
 
         if (n > 0)
             prog_process_conns(sport->sp_prog);
@@ -742,6 +770,23 @@ sport_init_client (struct service_port *sport, struct lsquic_engine *engine,
     }
 #endif
 
+#if TXTIME_SUPPORTED
+    if (sport->sp_flags & SPORT_TXTIME)
+    {
+        /* The library's clock is CLOCK_MONOTONIC, which is what fq expects */
+        struct sock_txtime txtime_cfg = { .clockid = CLOCK_MONOTONIC, };
+        s = setsockopt(sockfd, SOL_SOCKET, SO_TXTIME, &txtime_cfg,
+                                                        sizeof(txtime_cfg));
+        if (0 != s)
+        {
+            saved_errno = errno;
+            CLOSE_SOCKET(sockfd);
+            errno = saved_errno;
+            return -1;
+        }
+    }
+#endif
+
     if (sport->sp_flags & SPORT_SET_SNDBUF)
     {
         s = setsockopt(sockfd, SOL_SOCKET, SO_SNDBUF,
@@ -878,11 +923,70 @@ setup_control_msg (
 }
 
 
+#if GSO_SUPPORTED
+/* Append UDP_SEGMENT control message to whatever control messages `msg'
+ * already has.
+ */
+static void
+add_gso_control_msg (struct msghdr *msg, const struct lsquic_out_spec *spec,
+                                            unsigned char *buf, size_t bufsz)
+{
+    struct cmsghdr *cmsg;
+    size_t off;
+    uint16_t segsz;
+
+    off = msg->msg_control ? CMSG_ALIGN(msg->msg_controllen) : 0;
+    assert(off + GSO_CMSG_SZ <= bufsz);
+    cmsg = (struct cmsghdr *) (buf + off);
+    segsz = spec->segsz;
+    cmsg->cmsg_level    = IPPROTO_UDP;
+    cmsg->cmsg_type     = UDP_SEGMENT;
+    cmsg->cmsg_len      = CMSG_LEN(sizeof(segsz));
+    memcpy(CMSG_DATA(cmsg), &segsz, sizeof(segsz));
+    msg->msg_control    = buf;
+    msg->msg_controllen = off + GSO_CMSG_SZ;
+}
+
+
+#endif
+
+
+#if TXTIME_SUPPORTED
+/* Append SCM_TXTIME control message to whatever control messages `msg'
+ * already has.  The kernel wants the time in nanoseconds.
+ */
+static void
+add_txtime_control_msg (struct msghdr *msg, const struct lsquic_out_spec *spec,
+                                            unsigned char *buf, size_t bufsz)
+{
+    struct cmsghdr *cmsg;
+    size_t off;
+    uint64_t txtime;
+
+    off = msg->msg_control ? CMSG_ALIGN(msg->msg_controllen) : 0;
+    assert(off + TXTIME_CMSG_SZ <= bufsz);
+    cmsg = (struct cmsghdr *) (buf + off);
+    txtime = spec->txtime * 1000;
+    cmsg->cmsg_level    = SOL_SOCKET;
+    cmsg->cmsg_type     = SCM_TXTIME;
+    cmsg->cmsg_len      = CMSG_LEN(sizeof(txtime));
+    memcpy(CMSG_DATA(cmsg), &txtime, sizeof(txtime));
+    msg->msg_control    = buf;
+    msg->msg_controllen = off + TXTIME_CMSG_SZ;
+}
+
+
+#endif
+
+
 static int
 send_packets_one_by_one (const struct lsquic_out_spec *specs, unsigned count)
 {
     const struct service_port *sport;
     unsigned n;
+#if !GSO_SUPPORTED
+    size_t seg;
+#endif
     int s = 0;
 #ifndef WIN32
     struct msghdr msg;
@@ -898,12 +1002,11 @@ send_packets_one_by_one (const struct lsquic_out_spec *specs, unsigned count)
 #	define SIZE1 sizeof(struct in_addr)
 #endif
         unsigned char buf[
-            CMSG_SPACE(MAX(SIZE1, sizeof(struct in6_pktinfo)))];
+            CMSG_SPACE(MAX(SIZE1, sizeof(struct in6_pktinfo))) + GSO_CMSG_SZ
+                                                        + TXTIME_CMSG_SZ];
         struct cmsghdr cmsg;
     } ancil;
-#ifndef WIN32
-    struct iovec iov;
-#else
+#ifdef WIN32
     WSABUF iov;
 #endif
 
@@ -934,18 +1037,12 @@ send_packets_one_by_one (const struct lsquic_out_spec *specs, unsigned count)
     {
         sport = specs[n].peer_ctx;
 #ifndef WIN32
-        iov.iov_base = (void *) specs[n].buf;
-        iov.iov_len = specs[n].sz;
         msg.msg_name       = (void *) specs[n].dest_sa;
         msg.msg_namelen    = (AF_INET == specs[n].dest_sa->sa_family ?
                                             sizeof(struct sockaddr_in) :
                                             sizeof(struct sockaddr_in6)),
-        msg.msg_iov        = &iov;
-        msg.msg_iovlen     = 1;
         msg.msg_flags      = 0;
 #else
-        iov.buf = (void *) specs[n].buf;
-        iov.len = specs[n].sz;
         msg.name           = (void *) specs[n].dest_sa;
         msg.namelen        = (AF_INET == specs[n].dest_sa->sa_family ?
                                             sizeof(struct sockaddr_in) :
@@ -966,10 +1063,38 @@ send_packets_one_by_one (const struct lsquic_out_spec *specs, unsigned count)
             msg.Control.len = 0;
 #endif
         }
-#ifndef WIN32
+#if GSO_SUPPORTED
+        if (specs[n].iovlen > 1)
+            add_gso_control_msg(&msg, &specs[n], ancil.buf, sizeof(ancil.buf));
+#endif
+#if TXTIME_SUPPORTED
+        if (specs[n].txtime && (sport->sp_flags & SPORT_TXTIME))
+            add_txtime_control_msg(&msg, &specs[n], ancil.buf,
+                                                        sizeof(ancil.buf));
+#endif
+#if GSO_SUPPORTED
+        msg.msg_iov        = (struct iovec *) specs[n].iov;
+        msg.msg_iovlen     = specs[n].iovlen;
         s = sendmsg(sport->fd, &msg, 0);
 #else
-        s = pfnWSASendMsg(sport->fd, &msg, 0, &bytes, NULL, NULL);
+        /* Without GSO, each datagram in the spec is sent separately.  If
+         * one of them cannot be sent, the whole spec is reported as not
+         * sent: the peer drops the duplicates when the spec is resent.
+         */
+        for (seg = 0; seg < specs[n].iovlen; ++seg)
+        {
+#ifndef WIN32
+            msg.msg_iov    = (struct iovec *) &specs[n].iov[seg];
+            msg.msg_iovlen = 1;
+            s = sendmsg(sport->fd, &msg, 0);
+#else
+            iov.buf = specs[n].iov[seg].iov_base;
+            iov.len = specs[n].iov[seg].iov_len;
+            s = pfnWSASendMsg(sport->fd, &msg, 0, &bytes, NULL, NULL);
+#endif
+            if (s < 0)
+                break;
+        }
 #endif
         if (s < 0)
         {
@@ -1029,6 +1154,19 @@ set_engine_option (struct lsquic_engine_settings *settings,
             return 0;
         }
         break;
+    case 3:
+        if (0 == strncmp(name, "gso", 3))
+        {
+#if GSO_SUPPORTED
+            settings->es_gso = atoi(val);
+#else
+            if (atoi(val))
+                LSQ_WARN("GSO is not supported on this platform: ignore "
+                                                            "`gso' option");
+#endif
+            return 0;
+        }
+        break;
     case 4:
         if (0 == strncmp(name, "cfcw", 4))
         {
@@ -1066,8 +1204,23 @@ set_engine_option (struct lsquic_engine_settings *settings,
             settings->es_rw_once = atoi(val);
             return 0;
         }
+        else if (0 == strncmp(name, "cc_algo", 7))
+        {
+            settings->es_cc_algo = atoi(val);
+            return 0;
+        }
+        else if (0 == strncmp(name, "hystart", 7))
+        {
+            settings->es_hystart = atoi(val);
+            return 0;
+        }
         break;
     case 8:
+        if (0 == strncmp(name, "ack_freq", 8))
+        {
+            settings->es_ack_freq = atoi(val);
+            return 0;
+        }
         if (0 == strncmp(name, "max_cfcw", 8))
         {
             settings->es_max_cfcw = atoi(val);
@@ -1085,6 +1238,11 @@ set_engine_option (struct lsquic_engine_settings *settings,
             settings->es_honor_prst = atoi(val);
             return 0;
         }
+        if (0 == strncmp(name, "attq_wheel", 10))
+        {
+            settings->es_attq_wheel = atoi(val);
+            return 0;
+        }
         break;
     case 12:
         if (0 == strncmp(name, "idle_conn_to", 12))
@@ -1126,12 +1284,29 @@ set_engine_option (struct lsquic_engine_settings *settings,
             settings->es_max_streams_in = atoi(val);
             return 0;
         }
+        if (0 == strncmp(name, "txtime_horizon", 14))
+        {
+            settings->es_txtime_horizon = atoi(val);
+            return 0;
+        }
+        if (0 == strncmp(name, "ack_decimation", 14))
+        {
+            settings->es_ack_decimation = atoi(val);
+            return 0;
+        }
         if (0 == strncmp(name, "progress_check", 14))
         {
             settings->es_progress_check = atoi(val);
             return 0;
         }
         break;
+    case 15:
+        if (0 == strncmp(name, "max_recv_ranges", 15))
+        {
+            settings->es_max_recv_ranges = atoi(val);
+            return 0;
+        }
+        break;
     case 16:
         if (0 == strncmp(name, "proc_time_thresh", 16))
         {
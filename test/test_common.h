@@ -29,6 +29,7 @@ enum sport_flags
     SPORT_SET_RCVBUF        = (1 << 2), /* SO_RCVBUF */
     SPORT_SERVER            = (1 << 3),
     SPORT_CONNECT           = (1 << 4),
+    SPORT_TXTIME            = (1 << 5), /* SO_TXTIME */
 };
 
 struct service_port {
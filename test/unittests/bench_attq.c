@@ -0,0 +1,131 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * This is not really a test: this program compares performance of the
+ * binary heap and timer wheel implementations of the Advisory Tick Time
+ * Queue.
+ *
+ * The workload mimics the engine: on each iteration, due connections are
+ * popped and most connections that were ticked get rescheduled, either
+ * a little later (active connections) or much later (idle timers).
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_attq.h"
+#include "lsquic_conn.h"
+#include "lsquic_util.h"
+
+
+static lsquic_time_t
+next_adv_time (lsquic_time_t now, unsigned active_pct)
+{
+    if ((unsigned) (rand() % 100) < active_pct)
+        return now + 1000 + rand() % 50000;             /* Up to 50 ms */
+    else
+        return now + 1000000 + rand() % 30000000;       /* Up to 30 sec */
+}
+
+
+static lsquic_time_t
+run (struct attq *q, unsigned n_conns, unsigned n_iters, unsigned active_pct)
+{
+    struct lsquic_conn *conns, *conn;
+    lsquic_time_t now, start, end;
+    unsigned i;
+
+    srand(1);
+    conns = calloc(n_conns, sizeof(conns[0]));
+    if (!conns)
+    {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+
+    now = 1000000;
+    for (i = 0; i < n_conns; ++i)
+        (void) attq_add(q, &conns[i], next_adv_time(now, active_pct));
+
+    start = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+    {
+        now += 1000;
+        while ((conn = attq_pop(q, now)))
+            (void) attq_add(q, conn, next_adv_time(now, active_pct));
+        /* Some connections are rescheduled before their time is up */
+        conn = &conns[rand() % n_conns];
+        if (conn->cn_attq_elem)
+        {
+            attq_remove(q, conn);
+            (void) attq_add(q, conn, next_adv_time(now, active_pct));
+        }
+        (void) attq_next_time(q);
+    }
+    end = lsquic_time_now();
+
+    free(conns);
+    return end - start;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    struct attq *q;
+    unsigned n_conns = 100000, n_iters = 10000, active_pct = 10;
+    unsigned granularity = LSQUIC_DF_CLOCK_GRANULARITY;
+    lsquic_time_t heap_usec, wheel_usec;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:i:a:g:h")))
+    {
+        switch (opt)
+        {
+        case 'n':
+            n_conns = atoi(optarg);
+            break;
+        case 'i':
+            n_iters = atoi(optarg);
+            break;
+        case 'a':
+            active_pct = atoi(optarg);
+            break;
+        case 'g':
+            granularity = atoi(optarg);
+            break;
+        case 'h':
+            printf(
+"Usage: %s [-n conns] [-i iterations] [-a active percent] [-g granularity]\n"
+                , argv[0]);
+            return 0;
+        default:
+            return 1;
+        }
+    }
+
+    if (n_conns == 0)
+        n_conns = 1;
+
+    q = attq_create();
+    heap_usec = run(q, n_conns, n_iters, active_pct);
+    attq_destroy(q);
+
+    q = attq_wheel_create(granularity, 1000000);
+    wheel_usec = run(q, n_conns, n_iters, active_pct);
+    attq_destroy(q);
+
+    printf("conns: %u; iterations: %u; active: %u%%\n",
+                                            n_conns, n_iters, active_pct);
+    printf("heap:  %"PRIu64" usec\n", heap_usec);
+    printf("wheel: %"PRIu64" usec\n", wheel_usec);
+    return 0;
+}
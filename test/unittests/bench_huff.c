@@ -0,0 +1,198 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * This is not really a test: this program compares throughput of the
+ * table-driven and the reference (nibble-at-a-time) Huffman decoders.
+ * It also reports Huffman encoder throughput.
+ *
+ * The corpus consists of header values typical for HTTP requests and
+ * responses.  Each value is Huffman-encoded once; then the encoded values
+ * are decoded repeatedly by each decoder.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_util.h"
+#include "lshpack.h"
+
+
+static const char *const corpus[] =
+{
+    "www.example.com",
+    "/index.html",
+    "/static/js/main.8f3a2c1e.chunk.js?v=20190412",
+    "/api/v2/users/1234567/profile?fields=name,email,avatar&lang=en-US",
+    "https",
+    "GET",
+    "200",
+    "text/html; charset=utf-8",
+    "application/json",
+    "gzip, deflate, br",
+    "en-US,en;q=0.9,de;q=0.8",
+    "text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,"
+        "image/apng,*/*;q=0.8",
+    "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 "
+        "(KHTML, like Gecko) Chrome/73.0.3683.103 Safari/537.36",
+    "Mozilla/5.0 (iPhone; CPU iPhone OS 12_2 like Mac OS X) "
+        "AppleWebKit/605.1.15 (KHTML, like Gecko) Version/12.1 "
+        "Mobile/15E148 Safari/604.1",
+    "max-age=0, no-cache, no-store, must-revalidate",
+    "public, max-age=31536000, immutable",
+    "Wed, 17 Apr 2019 14:22:31 GMT",
+    "Thu, 01 Jan 1970 00:00:00 GMT",
+    "\"5cb73a1f-2b4e\"",
+    "W/\"0815-4a7f8c22d1e09\"",
+    "https://www.example.com/search?q=quic+huffman&source=hp",
+    "_ga=GA1.2.1234567890.1555512345; _gid=GA1.2.987654321.1555512345; "
+        "sessionid=3f9a8b7c6d5e4f3a2b1c0d9e8f7a6b5c; csrftoken=Zx9Yw8Vu7Ts6R"
+        "q5Po4Nm3Lk2Ji1Hg0Fe",
+    "id=a3fWa; Expires=Wed, 21 Oct 2019 07:28:00 GMT; Secure; HttpOnly",
+    "bytes=0-1048575",
+    "keep-alive",
+    "nginx/1.15.12",
+    "LiteSpeed",
+    "SAMEORIGIN",
+    "max-age=63072000; includeSubDomains; preload",
+    "default-src 'self'; script-src 'self' https://cdn.example.com; "
+        "img-src * data:",
+    "Accept-Encoding, Origin",
+    "1; mode=block",
+    "nosniff",
+    "h3-Q046=\":443\"; ma=2592000; v=\"46,44,43,39\"",
+};
+
+#define N_VALUES (sizeof(corpus) / sizeof(corpus[0]))
+
+
+struct encoded
+{
+    unsigned char  *buf;
+    int             len;
+};
+
+
+static lsquic_time_t
+run (int (*decode)(const unsigned char *, int, unsigned char *, int),
+            const struct encoded *enc, unsigned n_iters, uint64_t *n_bytes)
+{
+    unsigned char out[0x400];
+    lsquic_time_t start, end;
+    unsigned i, j;
+    int n;
+
+    *n_bytes = 0;
+    start = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+        for (j = 0; j < N_VALUES; ++j)
+        {
+            n = decode(enc[j].buf, enc[j].len, out, sizeof(out));
+            if (n < 0)
+            {
+                fprintf(stderr, "decoding failed\n");
+                exit(EXIT_FAILURE);
+            }
+            *n_bytes += n;
+        }
+    end = lsquic_time_now();
+
+    return end - start;
+}
+
+
+static lsquic_time_t
+run_enc (const struct encoded *enc, unsigned n_iters)
+{
+    unsigned char out[0x400];
+    lsquic_time_t start, end;
+    unsigned i, j;
+    size_t len;
+    int n;
+
+    start = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+        for (j = 0; j < N_VALUES; ++j)
+        {
+            len = strlen(corpus[j]);
+            n = lshpack_enc_huff_encode((const unsigned char *) corpus[j],
+                    (const unsigned char *) corpus[j] + len, out, sizeof(out));
+            if (n != enc[j].len)
+            {
+                fprintf(stderr, "encoding failed\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+    end = lsquic_time_now();
+
+    return end - start;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    struct encoded enc[N_VALUES];
+    unsigned n_iters = 100000, i;
+    lsquic_time_t table_usec, nibble_usec, enc_usec;
+    uint64_t n_bytes;
+    size_t len;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "i:h")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            n_iters = atoi(optarg);
+            break;
+        case 'h':
+            printf("Usage: %s [-i iterations]\n", argv[0]);
+            return 0;
+        default:
+            return 1;
+        }
+    }
+
+    for (i = 0; i < N_VALUES; ++i)
+    {
+        len = strlen(corpus[i]);
+        enc[i].buf = malloc(len * 4 + 1);
+        if (!enc[i].buf)
+        {
+            perror("malloc");
+            exit(EXIT_FAILURE);
+        }
+        enc[i].len = lshpack_enc_huff_encode(
+                                (const unsigned char *) corpus[i],
+                                (const unsigned char *) corpus[i] + len,
+                                enc[i].buf, len * 4 + 1);
+    }
+
+    table_usec = run(lshpack_dec_huff_decode, enc, n_iters, &n_bytes);
+    nibble_usec = run(lshpack_dec_huff_decode_nibbles, enc, n_iters,
+                                                                &n_bytes);
+
+    enc_usec = run_enc(enc, n_iters);
+
+    printf("values: %u; iterations: %u; decoded: %"PRIu64" bytes\n",
+                                    (unsigned) N_VALUES, n_iters, n_bytes);
+    printf("table:  %"PRIu64" usec (%.1f MB/s)\n", table_usec,
+                    table_usec ? (double) n_bytes / table_usec : 0.);
+    printf("nibble: %"PRIu64" usec (%.1f MB/s)\n", nibble_usec,
+                    nibble_usec ? (double) n_bytes / nibble_usec : 0.);
+    printf("encode: %"PRIu64" usec (%.1f MB/s)\n", enc_usec,
+                    enc_usec ? (double) n_bytes / enc_usec : 0.);
+
+    for (i = 0; i < N_VALUES; ++i)
+        free(enc[i].buf);
+    return 0;
+}
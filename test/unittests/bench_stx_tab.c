@@ -0,0 +1,115 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * This is not really a test: this program measures how long it takes to
+ * look up common request headers in the HPACK static table.
+ *
+ * For comparison, it also reports the time it takes to hash the same
+ * headers using XXH32, which is what static table lookup used to cost
+ * before the table was probed.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_util.h"
+#include "lsquic_xxhash.h"
+#include "lshpack.h"
+
+
+static const struct {
+    const char *name, *value;
+} headers[] =
+{
+    { ":method",            "GET", },
+    { ":scheme",            "https", },
+    { ":authority",         "www.example.com", },
+    { ":path",              "/index.html", },
+    { ":path",              "/static/js/main.8f3a2c1e.chunk.js", },
+    { "user-agent",         "Mozilla/5.0 (X11; Linux x86_64; rv:66.0) "
+                            "Gecko/20100101 Firefox/66.0", },
+    { "accept",             "text/html,application/xhtml+xml,"
+                            "application/xml;q=0.9,*/*;q=0.8", },
+    { "accept-language",    "en-US,en;q=0.5", },
+    { "accept-encoding",    "gzip, deflate", },
+    { "referer",            "https://www.example.com/", },
+    { "cookie",             "sessionid=3f9a8b7c6d5e4f3a", },
+    { "cache-control",      "max-age=0", },
+    { "if-none-match",      "\"5cb73a1f-2b4e\"", },
+    { "if-modified-since",  "Wed, 17 Apr 2019 14:22:31 GMT", },
+    { "upgrade-insecure-requests", "1", },
+    { "dnt",                "1", },
+    { "x-requested-with",   "XMLHttpRequest", },
+};
+
+#define N_HEADERS (sizeof(headers) / sizeof(headers[0]))
+
+
+int
+main (int argc, char **argv)
+{
+    unsigned name_len[N_HEADERS], val_len[N_HEADERS];
+    unsigned n_iters = 1000000, i, j;
+    lsquic_time_t start, lookup_usec, hash_usec;
+    uint32_t name_hash, nameval_hash, sum;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "i:h")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            n_iters = atoi(optarg);
+            break;
+        case 'h':
+            printf("Usage: %s [-i iterations]\n", argv[0]);
+            return 0;
+        default:
+            return 1;
+        }
+    }
+
+    for (j = 0; j < N_HEADERS; ++j)
+    {
+        name_len[j] = strlen(headers[j].name);
+        val_len[j] = strlen(headers[j].value);
+    }
+
+    /* The sums are printed so that the compiler does not optimize the
+     * loops away.
+     */
+    sum = 0;
+    start = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+        for (j = 0; j < N_HEADERS; ++j)
+            sum += lshpack_enc_get_stx_tab_id(headers[j].name, name_len[j],
+                                            headers[j].value, val_len[j]);
+    lookup_usec = lsquic_time_now() - start;
+    printf("lookup: %"PRIu64" usec (%.1f ns/header); sum: %"PRIu32"\n",
+        lookup_usec, lookup_usec * 1000.0 / ((double) n_iters * N_HEADERS),
+        sum);
+
+    sum = 0;
+    start = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+        for (j = 0; j < N_HEADERS; ++j)
+        {
+            name_hash = XXH32(headers[j].name, name_len[j], 0);
+            nameval_hash = XXH32(headers[j].value, val_len[j], name_hash);
+            sum += nameval_hash;
+        }
+    hash_usec = lsquic_time_now() - start;
+    printf("XXH32:  %"PRIu64" usec (%.1f ns/header); sum: %"PRIu32"\n",
+        hash_usec, hash_usec * 1000.0 / ((double) n_iters * N_HEADERS), sum);
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * This is not really a test: this program runs a bulk transfer over a
+ * simulated path using each of the congestion controllers and prints
+ * out goodput, queueing delay, and number of lost packets.  CUBIC is run
+ * with and without HyStart++: compare how much the queue overshoots and
+ * how many packets are lost when slow start ends.
+ *
+ * The path is a bottleneck link with a tail-drop FIFO queue in front of
+ * it, followed by fixed delay.  In addition, packets may be lost at
+ * random.  Each packet is acknowledged separately.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_mm.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cong_ctl.h"
+#include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
+#include "lsquic_logger.h"
+
+
+#define PACKET_SZ 1370
+
+struct path
+{
+    uint64_t            bw;             /* Bytes per second */
+    lsquic_time_t       rtt;            /* Propagation delay */
+    unsigned            queue_sz;       /* In packets */
+    unsigned            loss_ppm;       /* Random loss, parts per million */
+};
+
+struct sim_packet
+{
+    lsquic_packno_t     packno;
+    lsquic_time_t       sent;
+    lsquic_time_t       arrives;        /* When ACK arrives back at sender */
+    int                 lost;
+};
+
+#define MAX_IN_FLIGHT (1 << 20)
+
+struct stats
+{
+    uint64_t            bytes_acked;
+    unsigned            n_sent;
+    unsigned            n_lost;
+    unsigned            n_loss_events;
+    unsigned            n_lost_first;   /* Lost in the first loss event */
+    unsigned            max_queue;      /* In packets */
+    lsquic_time_t       sum_rtt;
+};
+
+
+static void
+run (const struct cong_ctl_if *cci, int hystart, const struct path *path,
+                                lsquic_time_t duration, struct stats *stats)
+{
+    union {
+        struct lsquic_cubic     cubic;
+        struct lsquic_bbr       bbr;
+    } cc;
+    struct lsquic_conn lconn;
+    struct lsquic_engine_public enpub;
+    struct lsquic_conn_public conn_pub;
+    struct sim_packet *in_flight, *packet;
+    lsquic_time_t now, end, next_send, link_busy_until, departs;
+    lsquic_packno_t next_packno, end_of_recovery;
+    unsigned head, tail, bytes_in_flight, queue;
+    uint64_t pacing_rate;
+    int can_send;
+
+    in_flight = malloc(sizeof(in_flight[0]) * MAX_IN_FLIGHT);
+    if (!in_flight)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    memset(&lconn, 0, sizeof(lconn));
+    memset(&enpub, 0, sizeof(enpub));
+    enpub.enp_settings.es_hystart = hystart;
+    memset(&conn_pub, 0, sizeof(conn_pub));
+    conn_pub.lconn = &lconn;
+    conn_pub.enpub = &enpub;
+    memset(stats, 0, sizeof(*stats));
+    cci->cci_init(&cc, &conn_pub);
+
+    now = 1000000;
+    end = now + duration;
+    next_send = now;
+    link_busy_until = 0;
+    next_packno = 1;
+    end_of_recovery = 0;
+    head = tail = 0;
+    bytes_in_flight = 0;
+
+    while (now < end)
+    {
+        can_send = bytes_in_flight + PACKET_SZ <= cci->cci_get_cwnd(&cc)
+                                            && tail - head < MAX_IN_FLIGHT;
+        packet = head < tail ? &in_flight[ head % MAX_IN_FLIGHT ] : NULL;
+        if (can_send && (!packet || next_send <= packet->arrives))
+        {
+            if (now < next_send)
+                now = next_send;
+            packet = &in_flight[ tail++ % MAX_IN_FLIGHT ];
+            packet->packno = next_packno++;
+            packet->sent = now;
+            departs = link_busy_until > now ? link_busy_until : now;
+            queue = (departs - now) * path->bw / 1000000 / PACKET_SZ;
+            if (queue > stats->max_queue)
+                stats->max_queue = queue;
+            packet->lost = queue >= path->queue_sz
+                || (unsigned) (rand() % 1000000) < path->loss_ppm;
+            departs += PACKET_SZ * 1000000 / path->bw;
+            if (!packet->lost)
+                link_busy_until = departs;
+            packet->arrives = departs + path->rtt;
+            cci->cci_sent(&cc, packet->packno, PACKET_SZ, now,
+                                                        bytes_in_flight, 0);
+            bytes_in_flight += PACKET_SZ;
+            ++stats->n_sent;
+            pacing_rate = cci->cci_pacing_rate(&cc,
+                                next_packno - 1 <= end_of_recovery);
+            next_send = now + PACKET_SZ * 1000000 / (pacing_rate ? pacing_rate : 1);
+        }
+        else
+        {
+            assert(packet);
+            if (now < packet->arrives)
+                now = packet->arrives;
+            ++head;
+            cci->cci_begin_ack(&cc, now, bytes_in_flight);
+            bytes_in_flight -= PACKET_SZ;
+            if (packet->lost)
+            {
+                ++stats->n_lost;
+                cci->cci_lost(&cc, packet->packno, PACKET_SZ);
+                /* One loss event per window of data, as in NewReno */
+                if (packet->packno > end_of_recovery)
+                {
+                    ++stats->n_loss_events;
+                    cci->cci_loss(&cc);
+                    end_of_recovery = next_packno - 1;
+                }
+                if (stats->n_loss_events == 1)
+                    ++stats->n_lost_first;
+            }
+            else
+            {
+                lsquic_rtt_stats_update(&conn_pub.rtt_stats,
+                                                    now - packet->sent, 0);
+                cci->cci_ack(&cc, packet->packno, PACKET_SZ, packet->sent,
+                                                                    now, 0);
+                stats->bytes_acked += PACKET_SZ;
+                stats->sum_rtt += now - packet->sent;
+            }
+            cci->cci_end_ack(&cc, bytes_in_flight);
+        }
+    }
+
+    cci->cci_cleanup(&cc);
+    free(in_flight);
+}
+
+
+static void
+print_stats (const char *name, const struct path *path,
+                    lsquic_time_t duration, const struct stats *stats)
+{
+    unsigned n_acked;
+    uint64_t goodput;
+
+    n_acked = stats->bytes_acked / PACKET_SZ;
+    goodput = stats->bytes_acked * 8 * 1000000 / duration;
+    printf("%-8s goodput: %6.2f Mbps (%5.1f%%); avg queueing delay: %6.2f ms; "
+        "lost: %u of %u packets; loss events: %u\n", name,
+        (double) goodput / 1000000,
+        (double) goodput * 100 / (path->bw * 8),
+        n_acked ? (double) (stats->sum_rtt / n_acked - path->rtt) / 1000 : 0.,
+        stats->n_lost, stats->n_sent, stats->n_loss_events);
+    printf("%-8s max queue: %u packets; lost in first loss event: %u\n", "",
+        stats->max_queue, stats->n_lost_first);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    struct path path = {
+        .bw         = 10 * 1000 * 1000 / 8,
+        .rtt        = 50000,
+        .queue_sz   = 0,
+        .loss_ppm   = 0,
+    };
+    lsquic_time_t duration = 30 * 1000000;
+    struct stats stats;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "b:r:q:p:t:l:h")))
+    {
+        switch (opt)
+        {
+        case 'b':
+            path.bw = atof(optarg) * 1000 * 1000 / 8;
+            break;
+        case 'r':
+            path.rtt = atof(optarg) * 1000;
+            break;
+        case 'q':
+            path.queue_sz = atoi(optarg);
+            break;
+        case 'p':
+            path.loss_ppm = atof(optarg) * 10000;
+            break;
+        case 't':
+            duration = atof(optarg) * 1000000;
+            break;
+        case 'l':
+            lsquic_log_to_fstream(stderr, 0);
+            lsquic_logger_lopt(optarg);
+            break;
+        case 'h':
+            printf(
+"Usage: %s [options]\n"
+"\n"
+"   -b MBPS     Bottleneck bandwidth in megabits per second.  Defaults to 10.\n"
+"   -r MS       Round-trip propagation delay in milliseconds.  Defaults to 50.\n"
+"   -q N        Bottleneck queue size in packets.  Defaults to one BDP.\n"
+"   -p PCT      Random loss, percent.  Defaults to 0.\n"
+"   -t SEC      Duration of the transfer in seconds.  Defaults to 30.\n"
+"   -l LOPT     Logger options, for example -l bbr=debug.\n"
+                , argv[0]);
+            return 0;
+        default:
+            return 1;
+        }
+    }
+
+    if (path.bw < PACKET_SZ)
+        path.bw = PACKET_SZ;
+    if (path.queue_sz == 0)
+    {
+        path.queue_sz = path.bw * path.rtt / 1000000 / PACKET_SZ;
+        if (path.queue_sz == 0)
+            path.queue_sz = 1;
+    }
+
+    printf("bandwidth: %.2f Mbps; rtt: %.1f ms; queue: %u packets; "
+        "random loss: %.4f%%; duration: %.1f s\n",
+        (double) path.bw * 8 / 1000000, (double) path.rtt / 1000,
+        path.queue_sz, (double) path.loss_ppm / 10000,
+        (double) duration / 1000000);
+
+    srand(1);
+    run(&lsquic_cong_cubic_if, 0, &path, duration, &stats);
+    print_stats("cubic", &path, duration, &stats);
+
+    srand(1);
+    run(&lsquic_cong_cubic_if, 1, &path, duration, &stats);
+    print_stats("cubic+hs", &path, duration, &stats);
+
+    srand(1);
+    run(&lsquic_cong_bbr_if, 0, &path, duration, &stats);
+    print_stats("bbr", &path, duration, &stats);
+
+    return 0;
+}
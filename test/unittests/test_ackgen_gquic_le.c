@@ -26,7 +26,7 @@ test1 (void) /* Inverse of quic_framer_test.cc -- NewAckFrameOneAckBlock */
     lsquic_time_t now = lsquic_time_now();
     lsquic_packno_t largest = 0;
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     unsigned i;
     for (i = 1; i <= 0x1234; ++i)
@@ -46,7 +46,7 @@ test1 (void) /* Inverse of quic_framer_test.cc -- NewAckFrameOneAckBlock */
         (gaf_rechist_first_f)        lsquic_rechist_first,
         (gaf_rechist_next_f)         lsquic_rechist_next,
         (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-        &rechist, now + 0x7FF8000, &has_missing, &largest);
+        &rechist, now + 0x7FF8000, &has_missing, &largest, NULL);
     assert(("ACK frame generation successful", w > 0));
     assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
     assert(("ACK frame contents are as expected",
@@ -65,7 +65,7 @@ test2 (void) /* Inverse of quic_framer_test.cc -- NewAckFrameOneAckBlock, minus
     lsquic_rechist_t rechist;
     lsquic_time_t now = lsquic_time_now();
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     /* Encode the following ranges:
      *    high      low
@@ -107,7 +107,7 @@ test2 (void) /* Inverse of quic_framer_test.cc -- NewAckFrameOneAckBlock, minus
         (gaf_rechist_first_f)        lsquic_rechist_first,
         (gaf_rechist_next_f)         lsquic_rechist_next,
         (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-        &rechist, now, &has_missing, &largest);
+        &rechist, now, &has_missing, &largest, NULL);
     assert(("ACK frame generation successful", w > 0));
     assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
     assert(("ACK frame contents are as expected",
@@ -124,7 +124,7 @@ test3 (void)
     lsquic_rechist_t rechist;
     lsquic_time_t now = lsquic_time_now();
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     /* Encode the following ranges:
      *    high      low
@@ -152,7 +152,7 @@ test3 (void)
         (gaf_rechist_first_f)        lsquic_rechist_first,
         (gaf_rechist_next_f)         lsquic_rechist_next,
         (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-        &rechist, now, &has_missing, &largest);
+        &rechist, now, &has_missing, &largest, NULL);
     assert(("ACK frame generation successful", w > 0));
     assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
     assert(("ACK frame contents are as expected",
@@ -170,7 +170,7 @@ test4 (void)
     lsquic_rechist_t rechist;
     int i;
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     lsquic_time_t now = lsquic_time_now();
     lsquic_rechist_received(&rechist, 1, now);
@@ -190,7 +190,7 @@ test4 (void)
             (gaf_rechist_first_f)        lsquic_rechist_first,
             (gaf_rechist_next_f)         lsquic_rechist_next,
             (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-            &rechist, now, &has_missing, &largest);
+            &rechist, now, &has_missing, &largest, NULL);
         assert(("ACK frame generation successful", w > 0));
         assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
         assert(("ACK frame contents are as expected",
@@ -220,7 +220,7 @@ test4 (void)
             (gaf_rechist_first_f)        lsquic_rechist_first,
             (gaf_rechist_next_f)         lsquic_rechist_next,
             (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-            &rechist, now, &has_missing, &largest);
+            &rechist, now, &has_missing, &largest, NULL);
         assert(("ACK frame generation successful", w > 0));
         assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
         assert(("ACK frame contents are as expected",
@@ -238,18 +238,16 @@ test_4byte_packnos (void)
 {
     lsquic_packno_t packno;
     lsquic_rechist_t rechist;
-    struct packet_interval *pint;
     lsquic_time_t now = lsquic_time_now();
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     packno = 0x23456789;
     (void) lsquic_rechist_received(&rechist, packno - 33, now);
-    pint = TAILQ_FIRST(&rechist.rh_pints.pk_intervals);
     (void) lsquic_rechist_received(&rechist, packno, now);
 
     /* Adjust: */
-    pint->range.low = 1;
+    rechist.rh_elems[0].low = 1;
 
     const unsigned char expected_ack_frame[] = {
         0x60
@@ -272,7 +270,7 @@ test_4byte_packnos (void)
         (gaf_rechist_first_f)        lsquic_rechist_first,
         (gaf_rechist_next_f)         lsquic_rechist_next,
         (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-        &rechist, now, &has_missing, &largest);
+        &rechist, now, &has_missing, &largest, NULL);
     assert(("ACK frame generation successful", w > 0));
     assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
     assert(("ACK frame contents are as expected",
@@ -289,18 +287,16 @@ test_6byte_packnos (void)
 {
     lsquic_packno_t packno;
     lsquic_rechist_t rechist;
-    struct packet_interval *pint;
     lsquic_time_t now = lsquic_time_now();
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     packno = 0xABCD23456789;
     (void) lsquic_rechist_received(&rechist, packno - 33, now);
-    pint = TAILQ_FIRST(&rechist.rh_pints.pk_intervals);
     (void) lsquic_rechist_received(&rechist, packno, now);
 
     /* Adjust: */
-    pint->range.low = 1;
+    rechist.rh_elems[0].low = 1;
 
     const unsigned char expected_ack_frame[] = {
         0x60
@@ -323,7 +319,7 @@ test_6byte_packnos (void)
         (gaf_rechist_first_f)        lsquic_rechist_first,
         (gaf_rechist_next_f)         lsquic_rechist_next,
         (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
-        &rechist, now, &has_missing, &largest);
+        &rechist, now, &has_missing, &largest, NULL);
     assert(("ACK frame generation successful", w > 0));
     assert(("ACK frame length is correct", w == sizeof(expected_ack_frame)));
     assert(("ACK frame contents are as expected",
@@ -336,6 +332,73 @@ test_6byte_packnos (void)
 
 
 
+/* ACK frames generated using cached ACK blocks are the same as those
+ * generated from scratch.
+ */
+static void
+test_cached_blocks (void)
+{
+    lsquic_rechist_t rechist;
+    lsquic_time_t now = lsquic_time_now();
+    lsquic_packno_t packno, largest;
+    unsigned char buf_cached[0x200], buf_full[0x200];
+    size_t sz;
+    int w_cached, w_full, has_missing, i;
+
+    lsquic_rechist_init(&rechist, 0, 0);
+    srand(0x5EED);
+
+    for (packno = 1; packno <= 2000; ++packno)
+    {
+        /* Mostly in-order packets with occasional losses and reordering,
+         * including gaps longer than 0xFF.
+         */
+        i = rand() % 100;
+        if (i < 3)
+            packno += 1 + rand() % 3;
+        else if (i < 4)
+            packno += 300;
+        else if (i < 6 && packno > 10)
+            (void) lsquic_rechist_received(&rechist, packno - 1 - rand() % 8,
+                                                                        now);
+        (void) lsquic_rechist_received(&rechist, packno, now);
+        if (packno % 500 == 0)
+            lsquic_rechist_stop_wait(&rechist, packno - 400);
+
+        /* Vary buffer size to exercise truncated ACK frames, too */
+        sz = rand() % 4 ? sizeof(buf_cached) : (size_t) (20 + rand() % 40);
+        w_cached = pf->pf_gen_ack_frame(buf_cached, sz,
+            (gaf_rechist_first_f)        lsquic_rechist_first,
+            (gaf_rechist_next_f)         lsquic_rechist_next,
+            (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
+            &rechist, now, &has_missing, &largest,
+            lsquic_rechist_ack_cache(&rechist));
+        w_full = pf->pf_gen_ack_frame(buf_full, sz,
+            (gaf_rechist_first_f)        lsquic_rechist_first,
+            (gaf_rechist_next_f)         lsquic_rechist_next,
+            (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
+            &rechist, now, &has_missing, &largest, NULL);
+        assert(w_cached > 0);
+        assert(w_cached == w_full);
+        assert(0 == memcmp(buf_cached, buf_full, w_full));
+    }
+
+    /* In-order packet does not invalidate the cache */
+    w_full = pf->pf_gen_ack_frame(buf_full, sizeof(buf_full),
+        (gaf_rechist_first_f)        lsquic_rechist_first,
+        (gaf_rechist_next_f)         lsquic_rechist_next,
+        (gaf_rechist_largest_recv_f) lsquic_rechist_largest_recv,
+        &rechist, now, &has_missing, &largest,
+        lsquic_rechist_ack_cache(&rechist));
+    assert(w_full > 0);
+    assert(lsquic_rechist_ack_cache(&rechist)->agc_valid);
+    (void) lsquic_rechist_received(&rechist, largest + 1, now);
+    assert(lsquic_rechist_ack_cache(&rechist)->agc_valid);
+
+    lsquic_rechist_cleanup(&rechist);
+}
+
+
 int
 main (void)
 {
@@ -355,5 +418,7 @@ main (void)
 
     test_6byte_packnos();
 
+    test_cached_blocks();
+
     return 0;
 }
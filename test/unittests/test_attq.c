@@ -49,6 +49,20 @@ cmp_chars_desc (const void *ap, const void *bp)
 }
 
 
+/* Zero means binary heap, otherwise timer wheel with this granularity */
+static unsigned s_granularity;
+
+
+static struct attq *
+new_attq (void)
+{
+    if (s_granularity)
+        return attq_wheel_create(s_granularity, 0);
+    else
+        return attq_create();
+}
+
+
 enum sort_action { SORT_NONE, SORT_ASC, SORT_DESC, };
 
 static void
@@ -75,7 +89,7 @@ test_attq_ordering (enum sort_action sa)
         break;
     }
 
-    q = attq_create();
+    q = new_attq();
 
     conns = calloc(sizeof(curiosity), sizeof(conns[0]));
     for (i = 0; i < sizeof(curiosity); ++i)
@@ -134,7 +148,7 @@ test_attq_removal_1 (void)
     struct attq *q;
     struct lsquic_conn *conns;
 
-    q = attq_create();
+    q = new_attq();
     conns = calloc(6, sizeof(conns[0]));
 
     attq_add(q, &conns[0], 1);
@@ -158,7 +172,7 @@ test_attq_removal_2 (void)
     struct attq *q;
     struct lsquic_conn *conns;
 
-    q = attq_create();
+    q = new_attq();
     conns = calloc(9, sizeof(conns[0]));
 
     attq_add(q, &conns[0], 1);
@@ -185,7 +199,7 @@ test_attq_removal_3 (void)
     struct attq *q;
     struct lsquic_conn *conns;
 
-    q = attq_create();
+    q = new_attq();
     conns = calloc(9, sizeof(conns[0]));
 
     attq_add(q, &conns[0], 1);
@@ -205,14 +219,78 @@ test_attq_removal_3 (void)
 }
 
 
+/* Compare pops against brute-force search.  Times are spread far enough
+ * apart to exercise all levels of the timer wheel.
+ */
+static void
+test_attq_random (void)
+{
+    struct attq *q;
+    struct lsquic_conn *conns, *conn;
+    lsquic_time_t *times, now, start;
+    const unsigned n_conns = 1000;
+    unsigned i, n_left, n_due;
+    int s;
+
+    srand(1);
+    q = new_attq();
+    conns = calloc(n_conns, sizeof(conns[0]));
+    times = calloc(n_conns, sizeof(times[0]));
+
+    start = 1000000000;
+    for (i = 0; i < n_conns; ++i)
+    {
+        times[i] = start + ((lsquic_time_t) rand() << (i % 20));
+        s = attq_add(q, &conns[i], times[i]);
+        assert(s == 0);
+    }
+
+    for (i = 0; i < n_conns; i += 3)
+        attq_remove(q, &conns[i]);
+    n_left = n_conns - (n_conns + 2) / 3;
+
+    for (now = start; n_left > 0; now += now - start + 1)
+    {
+        while ((conn = attq_pop(q, now)))
+        {
+            i = conn - conns;
+            assert(i % 3 != 0);
+            assert(times[i] < now);
+            assert(!conn->cn_attq_elem);
+            --n_left;
+        }
+        n_due = 0;
+        for (i = 0; i < n_conns; ++i)
+            n_due += conns[i].cn_attq_elem && times[i] < now;
+        assert(n_due == 0);
+        assert(n_left == attq_count_before(q, ~0ULL));
+        if (n_left)
+            assert(attq_next_time(q));
+    }
+
+    assert(!attq_next_time(q));
+    free(times);
+    free(conns);
+    attq_destroy(q);
+}
+
+
 int
 main (void)
 {
-    test_attq_ordering(SORT_NONE);
-    test_attq_ordering(SORT_ASC);
-    test_attq_ordering(SORT_DESC);
-    test_attq_removal_1();
-    test_attq_removal_2();
-    test_attq_removal_3();
+    static const unsigned granularities[] = { 0, 1, 10, 1000, };
+    unsigned i;
+
+    for (i = 0; i < sizeof(granularities) / sizeof(granularities[0]); ++i)
+    {
+        s_granularity = granularities[i];
+        test_attq_ordering(SORT_NONE);
+        test_attq_ordering(SORT_ASC);
+        test_attq_ordering(SORT_DESC);
+        test_attq_removal_1();
+        test_attq_removal_2();
+        test_attq_removal_3();
+        test_attq_random();
+    }
     return 0;
 }
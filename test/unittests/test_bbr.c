@@ -0,0 +1,415 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test BBR congestion controller, its delivery rate sampler, and the
+ * windowed max filter.
+ *
+ * BBR is run against a simulated path: a bottleneck link of fixed
+ * bandwidth with a FIFO queue in front of it, followed by fixed delay.
+ */
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_cong_ctl.h"
+#include "lsquic_bbr.h"
+#include "lsquic_logger.h"
+
+
+static void
+test_minmax (void)
+{
+    struct minmax mm;
+
+    minmax_init(&mm, 10);
+    lsquic_minmax_upmax(&mm, 1, 100);
+    assert(100 == minmax_get(&mm));
+
+    /* Smaller values do not replace the maximum until it ages out */
+    lsquic_minmax_upmax(&mm, 4, 50);
+    lsquic_minmax_upmax(&mm, 8, 70);
+    assert(100 == minmax_get(&mm));
+    lsquic_minmax_upmax(&mm, 12, 60);
+    assert(70 == minmax_get(&mm));
+
+    /* Larger value replaces the maximum immediately */
+    lsquic_minmax_upmax(&mm, 13, 200);
+    assert(200 == minmax_get(&mm));
+
+    /* No samples for more than a window: new value is taken as is */
+    lsquic_minmax_upmax(&mm, 100, 10);
+    assert(10 == minmax_get(&mm));
+
+    minmax_init(&mm, 10);
+    lsquic_minmax_upmin(&mm, 1, 100);
+    lsquic_minmax_upmin(&mm, 5, 150);
+    assert(100 == minmax_get(&mm));
+    lsquic_minmax_upmin(&mm, 6, 90);
+    assert(90 == minmax_get(&mm));
+}
+
+
+/* Packets are sent every millisecond and acked 50 milliseconds later:
+ * delivery rate is one packet per millisecond.
+ */
+static void
+test_bw_sampler (void)
+{
+    struct bw_sampler sampler;
+    struct bw_sample sample;
+    lsquic_packno_t packno;
+    lsquic_time_t now;
+    unsigned n_samples;
+    int s;
+
+    lsquic_bw_sampler_init(&sampler, 0);
+
+    n_samples = 0;
+    for (packno = 1; packno <= 1000; ++packno)
+    {
+        now = packno * 1000;
+        s = lsquic_bw_sampler_packet_sent(&sampler, packno, 1000, now,
+                                    packno > 50 ? 50 * 1000 : (packno - 1) * 1000);
+        assert(0 == s);
+        if (packno > 50)
+        {
+            s = lsquic_bw_sampler_packet_acked(&sampler, packno - 50,
+                                                            now, &sample);
+            if (0 == s)
+            {
+                ++n_samples;
+                assert(sample.rtt == 50000);
+                /* Packets sent before the first ACK was received
+                 * measure the delivery interval from the first packet.
+                 */
+                if (packno > 101)
+                    assert(sample.bandwidth == 1000000);
+            }
+        }
+    }
+    assert(n_samples > 900);
+    assert(lsquic_bw_sampler_total_acked(&sampler) == 950 * 1000);
+
+    /* Lost packet produces no sample; unknown packet does not either */
+    lsquic_bw_sampler_packet_lost(&sampler, 951);
+    s = lsquic_bw_sampler_packet_acked(&sampler, 951, now, &sample);
+    assert(-1 == s);
+    s = lsquic_bw_sampler_packet_acked(&sampler, 5000, now, &sample);
+    assert(-1 == s);
+
+    /* Packets sent while application-limited produce app-limited samples
+     * until a packet sent after the app-limited phase is acked.
+     */
+    lsquic_bw_sampler_app_limited(&sampler);
+    assert(lsquic_bw_sampler_is_app_limited(&sampler));
+    s = lsquic_bw_sampler_packet_sent(&sampler, 1001, 1000, now + 1000,
+                                                                    49 * 1000);
+    assert(0 == s);
+    s = lsquic_bw_sampler_packet_acked(&sampler, 952, now + 1000, &sample);
+    assert(0 == s);
+    assert(!sample.is_app_limited);
+    assert(lsquic_bw_sampler_is_app_limited(&sampler));
+    for (packno = 953; packno <= 1001; ++packno)
+    {
+        s = lsquic_bw_sampler_packet_acked(&sampler, packno, now + 2000,
+                                                                    &sample);
+        assert(0 == s);
+    }
+    assert(sample.is_app_limited);
+    assert(!lsquic_bw_sampler_is_app_limited(&sampler));
+
+    lsquic_bw_sampler_cleanup(&sampler);
+}
+
+
+#define PACKET_SZ 1370
+
+struct sim_packet
+{
+    lsquic_packno_t     packno;
+    lsquic_time_t       sent;
+    lsquic_time_t       arrives;    /* When ACK arrives back at the sender */
+    int                 lost;
+};
+
+struct sim
+{
+    /* Path */
+    uint64_t                    bw;         /* Bytes per second */
+    lsquic_time_t               rtt;        /* Propagation delay */
+    unsigned                    loss_pct;
+    lsquic_time_t               link_busy_until;
+
+    /* Sender */
+    struct lsquic_conn          lconn;
+    struct lsquic_conn_public   conn_pub;
+    struct lsquic_bbr           bbr;
+    const struct cong_ctl_if   *cci;
+    lsquic_time_t               now;
+    lsquic_time_t               next_send;
+    lsquic_packno_t             next_packno;
+    unsigned                    bytes_in_flight;
+    uint64_t                    bytes_acked;
+
+    /* Packets in flight in the order in which their ACKs arrive */
+    struct sim_packet           in_flight[1 << 16];
+    unsigned                    head, tail;
+
+    unsigned                    modes_seen;
+};
+
+
+static void
+sim_init (struct sim *sim, uint64_t bw, lsquic_time_t rtt, unsigned loss_pct)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->bw = bw;
+    sim->rtt = rtt;
+    sim->loss_pct = loss_pct;
+    sim->conn_pub.lconn = &sim->lconn;
+    sim->cci = &lsquic_cong_bbr_if;
+    sim->cci->cci_init(&sim->bbr, &sim->conn_pub);
+    sim->now = 1000000;
+    sim->next_send = sim->now;
+    sim->next_packno = 1;
+    sim->modes_seen = 1 << sim->bbr.bbr_mode;
+}
+
+
+static void
+sim_send (struct sim *sim)
+{
+    struct sim_packet *packet;
+    lsquic_time_t departs;
+
+    packet = &sim->in_flight[ sim->tail++ % (sizeof(sim->in_flight)
+                                            / sizeof(sim->in_flight[0])) ];
+    assert(sim->tail - sim->head <=
+                        sizeof(sim->in_flight) / sizeof(sim->in_flight[0]));
+    packet->packno = sim->next_packno++;
+    packet->sent = sim->now;
+    packet->lost = (unsigned) (rand() % 100) < sim->loss_pct;
+    if (sim->link_busy_until > sim->now)
+        departs = sim->link_busy_until;
+    else
+        departs = sim->now;
+    departs += PACKET_SZ * 1000000 / sim->bw;
+    if (!packet->lost)
+        sim->link_busy_until = departs;
+    packet->arrives = departs + sim->rtt;
+
+    sim->cci->cci_sent(&sim->bbr, packet->packno, PACKET_SZ, sim->now,
+                                                    sim->bytes_in_flight, 0);
+    sim->bytes_in_flight += PACKET_SZ;
+    sim->next_send = sim->now + PACKET_SZ * 1000000
+                                / sim->cci->cci_pacing_rate(&sim->bbr, 0);
+}
+
+
+/* Each ACK acknowledges a single packet.  A lost packet is detected when
+ * the ACK that would have acknowledged it arrives.
+ */
+static void
+sim_ack (struct sim *sim)
+{
+    struct sim_packet *packet;
+
+    packet = &sim->in_flight[ sim->head++ % (sizeof(sim->in_flight)
+                                            / sizeof(sim->in_flight[0])) ];
+    sim->cci->cci_begin_ack(&sim->bbr, sim->now, sim->bytes_in_flight);
+    sim->bytes_in_flight -= PACKET_SZ;
+    if (packet->lost)
+    {
+        sim->cci->cci_lost(&sim->bbr, packet->packno, PACKET_SZ);
+        sim->cci->cci_loss(&sim->bbr);
+    }
+    else
+    {
+        lsquic_rtt_stats_update(&sim->conn_pub.rtt_stats,
+                                                sim->now - packet->sent, 0);
+        sim->cci->cci_ack(&sim->bbr, packet->packno, PACKET_SZ, packet->sent,
+                                                                sim->now, 0);
+        sim->bytes_acked += PACKET_SZ;
+    }
+    sim->cci->cci_end_ack(&sim->bbr, sim->bytes_in_flight);
+    sim->modes_seen |= 1 << sim->bbr.bbr_mode;
+}
+
+
+static void
+sim_run (struct sim *sim, lsquic_time_t duration)
+{
+    const lsquic_time_t end = sim->now + duration;
+    struct sim_packet *next_ack;
+    int can_send;
+
+    while (sim->now < end)
+    {
+        can_send = sim->bytes_in_flight + PACKET_SZ
+                                    <= sim->cci->cci_get_cwnd(&sim->bbr);
+        if (sim->head < sim->tail)
+            next_ack = &sim->in_flight[ sim->head % (sizeof(sim->in_flight)
+                                            / sizeof(sim->in_flight[0])) ];
+        else
+            next_ack = NULL;
+        assert(can_send || next_ack);
+        if (can_send && (!next_ack || sim->next_send <= next_ack->arrives))
+        {
+            if (sim->now < sim->next_send)
+                sim->now = sim->next_send;
+            sim_send(sim);
+        }
+        else
+        {
+            if (sim->now < next_ack->arrives)
+                sim->now = next_ack->arrives;
+            sim_ack(sim);
+        }
+    }
+}
+
+
+static void
+sim_cleanup (struct sim *sim)
+{
+    sim->cci->cci_cleanup(&sim->bbr);
+}
+
+
+/* BBR should go through STARTUP and DRAIN into PROBE_BW, estimate link
+ * bandwidth and RTT correctly, and make full use of the link.
+ */
+static void
+test_bbr_path (uint64_t bw, lsquic_time_t rtt, unsigned loss_pct)
+{
+    struct sim *sim;
+    uint64_t est_bw, acked_before;
+    lsquic_time_t min_rtt;
+
+    srand(0);
+    sim = malloc(sizeof(*sim));
+    sim_init(sim, bw, rtt, loss_pct);
+    assert(sim->bbr.bbr_mode == BBR_MODE_STARTUP);
+
+    sim_run(sim, 5 * 1000000);
+    assert(sim->modes_seen & (1 << BBR_MODE_DRAIN));
+    assert(sim->bbr.bbr_mode == BBR_MODE_PROBE_BW);
+    est_bw = lsquic_bbr_get_bandwidth(&sim->bbr);
+    assert(est_bw > bw * 9 / 10 && est_bw < bw * 11 / 10);
+    min_rtt = sim->bbr.bbr_min_rtt;
+    assert(min_rtt >= rtt && min_rtt < rtt + rtt / 10);
+
+    acked_before = sim->bytes_acked;
+    sim_run(sim, 5 * 1000000);
+    assert((sim->bytes_acked - acked_before) / 5 > bw * (100 - loss_pct)
+                                                            / 100 * 9 / 10);
+
+    /* Path RTT goes up.  The minimum RTT estimate is no longer refreshed
+     * and expires after ten seconds, at which point BBR probes RTT and
+     * picks up the new value.
+     */
+    assert(!(sim->modes_seen & (1 << BBR_MODE_PROBE_RTT)));
+    sim->rtt += rtt / 2;
+    sim_run(sim, 12 * 1000000);
+    assert(sim->modes_seen & (1 << BBR_MODE_PROBE_RTT));
+    assert(sim->bbr.bbr_mode == BBR_MODE_PROBE_BW);
+    assert(sim->bbr.bbr_min_rtt >= rtt + rtt / 2);
+
+    sim_cleanup(sim);
+    free(sim);
+}
+
+
+/* In recovery, congestion window is reduced and restored when recovery
+ * ends.
+ */
+static void
+test_bbr_recovery (void)
+{
+    struct lsquic_conn lconn;
+    struct lsquic_conn_public conn_pub;
+    struct lsquic_bbr bbr;
+    const struct cong_ctl_if *const cci = &lsquic_cong_bbr_if;
+    unsigned long init_cwnd;
+    lsquic_packno_t packno;
+
+    memset(&lconn, 0, sizeof(lconn));
+    memset(&conn_pub, 0, sizeof(conn_pub));
+    conn_pub.lconn = &lconn;
+    cci->cci_init(&bbr, &conn_pub);
+    init_cwnd = cci->cci_get_cwnd(&bbr);
+
+    for (packno = 1; packno <= 20; ++packno)
+        cci->cci_sent(&bbr, packno, PACKET_SZ, 1000000, (packno - 1)
+                                                            * PACKET_SZ, 0);
+
+    /* Packet 1 is lost, packets 2 and 3 are acked */
+    cci->cci_begin_ack(&bbr, 1100000, 20 * PACKET_SZ);
+    cci->cci_ack(&bbr, 2, PACKET_SZ, 1000000, 1100000, 0);
+    cci->cci_ack(&bbr, 3, PACKET_SZ, 1000000, 1100000, 0);
+    cci->cci_lost(&bbr, 1, PACKET_SZ);
+    cci->cci_loss(&bbr);
+    cci->cci_end_ack(&bbr, 17 * PACKET_SZ);
+    assert(bbr.bbr_flags & BBR_FLAG_IN_RECOVERY);
+    assert(cci->cci_get_cwnd(&bbr) < init_cwnd);
+
+    /* Acking a packet sent after the loss ends recovery */
+    cci->cci_sent(&bbr, 21, PACKET_SZ, 1100000, 17 * PACKET_SZ, 0);
+    cci->cci_begin_ack(&bbr, 1200000, 18 * PACKET_SZ);
+    for (packno = 4; packno <= 21; ++packno)
+        cci->cci_ack(&bbr, packno, PACKET_SZ, packno == 21 ? 1100000
+                                                    : 1000000, 1200000, 0);
+    cci->cci_end_ack(&bbr, 0);
+    assert(!(bbr.bbr_flags & BBR_FLAG_IN_RECOVERY));
+    assert(cci->cci_get_cwnd(&bbr) >= init_cwnd);
+
+    cci->cci_timeout(&bbr);
+    assert(cci->cci_get_cwnd(&bbr) == bbr.bbr_min_cwnd);
+
+    cci->cci_cleanup(&bbr);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "l:")))
+    {
+        switch (opt)
+        {
+        case 'l':
+            lsquic_log_to_fstream(stderr, 0);
+            lsquic_logger_lopt(optarg);
+            break;
+        default:
+            exit(1);
+        }
+    }
+
+    test_minmax();
+    test_bw_sampler();
+    test_bbr_recovery();
+    test_bbr_path(10 * 1000 * 1000 / 8, 50000, 0);
+    test_bbr_path(100 * 1000 * 1000 / 8, 20000, 0);
+    test_bbr_path(10 * 1000 * 1000 / 8, 100000, 1);
+
+    return 0;
+}
@@ -78,6 +78,54 @@ main (int argc, char **argv)
 
     assert(0 == conn_hash_count(&conn_hash));
 
+    /* Churn: keep adding and removing connections.  This exercises reuse
+     * of deleted slots and rehashing while a resize is in progress.
+     */
+    for (n = 0, lconn = lsquic_malo_first(malo); lconn;
+                                    ++n, lconn = lsquic_malo_next(malo))
+    {
+        s = conn_hash_add(&conn_hash, lconn);
+        assert(0 == s);
+        lconn->cn_flags = 1;
+        if (n & 1)
+        {
+            find_lsconn = conn_hash_find_by_cid(&conn_hash,
+                                    (uintptr_t) lconn - sizeof(*lconn) * 7);
+            if (find_lsconn)
+            {
+                conn_hash_remove(&conn_hash, find_lsconn);
+                find_lsconn->cn_flags = 0;
+            }
+        }
+    }
+
+    for (lconn = lsquic_malo_first(malo); lconn;
+             lconn = lsquic_malo_next(malo))
+    {
+        find_lsconn = conn_hash_find_by_cid(&conn_hash, lconn->cn_cid);
+        assert(find_lsconn == (lconn->cn_flags ? lconn : NULL));
+    }
+
+    /* Remove connections while iterating, the way the engine does it when
+     * it is destroyed.
+     */
+    nelems = conn_hash_count(&conn_hash);
+    n = 0;
+    for (lconn = conn_hash_first(&conn_hash); lconn;
+                                        lconn = conn_hash_next(&conn_hash))
+    {
+        assert(lconn->cn_flags == 1);
+        conn_hash_remove(&conn_hash, lconn);
+        lconn->cn_flags = 0;
+        ++n;
+    }
+
+    assert(n == nelems);
+    assert(0 == conn_hash_count(&conn_hash));
+    for (lconn = lsquic_malo_first(malo); lconn;
+             lconn = lsquic_malo_next(malo))
+        assert(lconn->cn_flags == 0);
+
     conn_hash_cleanup(&conn_hash);
     lsquic_malo_destroy(malo);
 
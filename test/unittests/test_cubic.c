@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/queue.h>
 #ifndef WIN32
 #include <unistd.h>
 #else
@@ -11,6 +12,16 @@
 
 #include "lsquic.h"
 #include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_rtt.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_conn.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_mm.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
 #include "lsquic_logger.h"
 
@@ -67,6 +78,106 @@ test_post_quiescence_explosion2 (void)
 }
 
 
+struct hystart_test
+{
+    struct lsquic_cubic             cubic;
+    struct lsquic_conn              lconn;
+    struct lsquic_engine_public     enpub;
+    struct lsquic_conn_public       conn_pub;
+    lsquic_packno_t                 packno;
+    lsquic_time_t                   now;
+};
+
+
+static void
+hystart_test_init (struct hystart_test *ht)
+{
+    memset(ht, 0, sizeof(*ht));
+    ht->enpub.enp_settings.es_hystart = 1;
+    ht->conn_pub.lconn = &ht->lconn;
+    ht->conn_pub.enpub = &ht->enpub;
+    ht->now = 1000000;
+    lsquic_cong_cubic_if.cci_init(&ht->cubic, &ht->conn_pub);
+    assert(ht->cubic.cu_flags & CU_HYSTART);
+}
+
+
+/* Send a window's worth of packets and ack them all after `rtt' */
+static void
+hystart_test_round (struct hystart_test *ht, lsquic_time_t rtt)
+{
+    const struct cong_ctl_if *const cci = &lsquic_cong_cubic_if;
+    lsquic_packno_t first, packno;
+    unsigned n;
+
+    n = cci->cci_get_cwnd(&ht->cubic) / 1370;
+    first = ht->packno + 1;
+    while (n--)
+        cci->cci_sent(&ht->cubic, ++ht->packno, 1370, ht->now, 0, 0);
+    for (packno = first; packno <= ht->packno; ++packno)
+        cci->cci_ack(&ht->cubic, packno, 1370, ht->now, ht->now + rtt, 0);
+    ht->now += rtt;
+}
+
+
+/* Rising RTT switches slow start to CSS; after five rounds in CSS, slow
+ * start is over.
+ */
+static void
+test_hystart_exit (void)
+{
+    struct hystart_test ht;
+    unsigned long cwnd;
+    unsigned i;
+
+    hystart_test_init(&ht);
+
+    for (i = 0; i < 3; ++i)
+        hystart_test_round(&ht, 50000);
+    assert(HS_SLOW_START == ht.cubic.cu_hs.state);
+
+    /* Below threshold of max(4 ms, 50 ms / 8): */
+    hystart_test_round(&ht, 56000);
+    assert(HS_SLOW_START == ht.cubic.cu_hs.state);
+
+    hystart_test_round(&ht, 63000);
+    assert(HS_CSS == ht.cubic.cu_hs.state);
+
+    /* In CSS, cwnd grows at quarter speed */
+    cwnd = lsquic_cubic_get_cwnd(&ht.cubic);
+    hystart_test_round(&ht, 63000);
+    assert(HS_CSS == ht.cubic.cu_hs.state);
+    assert(lsquic_cubic_get_cwnd(&ht.cubic) == cwnd
+                            + cwnd / 1370 * (TCP_MSS / 4));
+
+    for (i = 0; i < 4; ++i)
+        hystart_test_round(&ht, 63000);
+    assert(HS_DONE == ht.cubic.cu_hs.state);
+    assert(!lsquic_cubic_in_slow_start(&ht.cubic));
+    assert(ht.cubic.cu_ssthresh < 10000 * TCP_MSS);
+}
+
+
+/* If RTT falls back below the CSS baseline, slow start resumes */
+static void
+test_hystart_resume (void)
+{
+    struct hystart_test ht;
+
+    hystart_test_init(&ht);
+    hystart_test_round(&ht, 50000);
+    hystart_test_round(&ht, 50000);
+    hystart_test_round(&ht, 70000);
+    assert(HS_CSS == ht.cubic.cu_hs.state);
+    hystart_test_round(&ht, 50000);
+    assert(HS_SLOW_START == ht.cubic.cu_hs.state);
+    assert(lsquic_cubic_in_slow_start(&ht.cubic));
+
+    /* Loss ends HyStart++ */
+    lsquic_cong_cubic_if.cci_loss(&ht.cubic);
+    assert(HS_DONE == ht.cubic.cu_hs.state);
+}
+
 
 int
 main (int argc, char **argv)
@@ -90,6 +201,8 @@ main (int argc, char **argv)
 
     test_post_quiescence_explosion();
     test_post_quiescence_explosion2();
+    test_hystart_exit();
+    test_hystart_resume();
 
     exit(EXIT_SUCCESS);
 }
@@ -5,6 +5,7 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/queue.h>
 #ifdef WIN32
@@ -310,6 +311,80 @@ run_di_nocopy_test (const struct nocopy_test *test)
 }
 
 
+/* Heavily reordered frames are inserted without switching to another
+ * data_in implementation and are read back in order.
+ */
+static void
+test_reordered (int reverse)
+{
+    struct lsquic_mm mm;
+    struct lsquic_conn_public conn_pub;
+    struct lsquic_conn conn;
+    struct stream_frame *frame;
+    struct data_in *di;
+    struct data_frame *data_frame;
+    enum ins_frame ins;
+    unsigned order[600], i, j, tmp;
+    const unsigned n_frames = sizeof(order) / sizeof(order[0]);
+    const unsigned frame_sz = 1000;
+    uint64_t read_offset;
+
+    lsquic_mm_init(&mm);
+    memset(&conn, 0, sizeof(conn));
+    conn_pub.lconn = &conn;
+    conn_pub.mm = &mm;
+
+    di = data_in_nocopy_new(&conn_pub, 3);
+
+    for (i = 0; i < n_frames; ++i)
+        order[i] = reverse ? n_frames - 1 - i : i;
+    if (!reverse)
+        for (i = n_frames - 1; i > 0; --i)
+        {
+            j = rand() % (i + 1);
+            tmp = order[i];
+            order[i] = order[j];
+            order[j] = tmp;
+        }
+
+    read_offset = 0;
+    for (i = 0; i < n_frames; ++i)
+    {
+        frame = lsquic_malo_get(mm.malo.stream_frame);
+        frame->packet_in = lsquic_mm_get_packet_in(&mm);
+        frame->packet_in->pi_refcnt = 1;
+        frame->data_frame = (struct data_frame)
+                            F(order[i] * frame_sz, frame_sz,
+                                                order[i] == n_frames - 1);
+        ins = di->di_if->di_insert_frame(di, frame, read_offset);
+        assert(INS_FRAME_OK == ins);
+        assert(!(di->di_flags & DI_SWITCH_IMPL));
+
+        /* Read whatever is available every now and then */
+        if (i % 50 == 49)
+            while ((data_frame = di->di_if->di_get_frame(di, read_offset)))
+            {
+                data_frame->df_read_off = data_frame->df_size;
+                read_offset += data_frame->df_size;
+                di->di_if->di_frame_done(di, data_frame);
+            }
+    }
+
+    while ((data_frame = di->di_if->di_get_frame(di, read_offset)))
+    {
+        assert(data_frame->df_offset == read_offset);
+        data_frame->df_read_off = data_frame->df_size;
+        read_offset += data_frame->df_size;
+        di->di_if->di_frame_done(di, data_frame);
+    }
+    assert(read_offset == (uint64_t) n_frames * frame_sz);
+    assert(di->di_if->di_empty(di));
+
+    di->di_if->di_destroy(di);
+    lsquic_mm_cleanup(&mm);
+}
+
+
 int
 main (int argc, char **argv)
 {
@@ -333,5 +408,8 @@ main (int argc, char **argv)
     for (test = tests; test < tests + sizeof(tests) / sizeof(tests[0]); ++test)
         run_di_nocopy_test(test);
 
+    test_reordered(0);
+    test_reordered(1);
+
     return 0;
 }
@@ -0,0 +1,163 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_str.h"
+#include "lsquic_handshake.h"
+
+
+#define N_ENGINES 4
+
+
+/* Make a gQUIC packet with connection ID and one-byte packet number */
+static void
+make_packet (unsigned char *buf, size_t bufsz, lsquic_cid_t cid)
+{
+    memset(buf, 0, bufsz);
+    buf[0] = 0x08;
+    memcpy(buf + 1, &cid, sizeof(cid));
+    buf[9] = 1;
+}
+
+
+static int s_enc_session;
+
+
+static lsquic_enc_session_t *
+mock_create_client (const char *domain, lsquic_cid_t cid,
+                    const struct lsquic_engine_public *enpub,
+                    const unsigned char *zero_rtt, size_t zero_rtt_len)
+{
+    return (lsquic_enc_session_t *) &s_enc_session;
+}
+
+
+static void
+mock_destroy (lsquic_enc_session_t *enc_session)
+{
+}
+
+
+static lsquic_conn_ctx_t *
+on_new_conn (void *stream_if_ctx, lsquic_conn_t *lconn)
+{
+    return NULL;
+}
+
+
+static void
+on_conn_closed (lsquic_conn_t *lconn)
+{
+}
+
+
+static const struct lsquic_stream_if stream_if =
+{
+    .on_new_conn    = on_new_conn,
+    .on_conn_closed = on_conn_closed,
+};
+
+
+/* Connection created by an engine in a group is steered back to it */
+static void
+test_connect (void)
+{
+    struct lsquic_engine_api apis[N_ENGINES];
+    lsquic_engine_group_t *group;
+    lsquic_conn_t *conn;
+    struct sockaddr_in local_sa, peer_sa;
+    unsigned char buf[20];
+    unsigned i;
+
+    memset(apis, 0, sizeof(apis));
+    for (i = 0; i < N_ENGINES; ++i)
+    {
+        apis[i].ea_packets_out = (void *) (uintptr_t) 1;
+        apis[i].ea_stream_if = &stream_if;
+    }
+
+    memset(&local_sa, 0, sizeof(local_sa));
+    local_sa.sin_family = AF_INET;
+    local_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    peer_sa = local_sa;
+    peer_sa.sin_port = htons(443);
+
+    group = lsquic_engine_group_new(0, apis, N_ENGINES);
+    assert(group);
+    for (i = 0; i < N_ENGINES; ++i)
+    {
+        local_sa.sin_port = htons(12345 + i);
+        conn = lsquic_engine_connect(lsquic_engine_group_get(group, i),
+                        (struct sockaddr *) &local_sa,
+                        (struct sockaddr *) &peer_sa, NULL, NULL,
+                        "www.example.com", 0, NULL, 0);
+        assert(conn);
+        make_packet(buf, sizeof(buf), lsquic_conn_id(conn));
+        assert((int) i == lsquic_engine_group_steer(group, buf, sizeof(buf)));
+    }
+    lsquic_engine_group_destroy(group);
+}
+
+
+int
+main (void)
+{
+    struct lsquic_engine_api apis[N_ENGINES];
+    lsquic_engine_group_t *group;
+    unsigned char buf[20];
+    unsigned i;
+    int shard;
+
+    memset(apis, 0, sizeof(apis));
+    for (i = 0; i < N_ENGINES; ++i)
+        apis[i].ea_packets_out = (void *) (uintptr_t) 1;
+
+    group = lsquic_engine_group_new(0, apis, N_ENGINES);
+    assert(group);
+    assert(N_ENGINES == lsquic_engine_group_count(group));
+    for (i = 0; i < N_ENGINES; ++i)
+    {
+        assert(lsquic_engine_group_get(group, i));
+        assert(0 == (lsquic_engine_quic_versions(
+                                        lsquic_engine_group_get(group, i))
+                                            & LSQUIC_FORCED_TCID0_VERSIONS));
+    }
+    assert(!lsquic_engine_group_get(group, N_ENGINES));
+
+    for (i = 0; i < N_ENGINES + 2; ++i)
+    {
+        make_packet(buf, sizeof(buf),
+                    lsquic_cid_set_shard(0x1234567890ABCDEFULL, i));
+        shard = lsquic_engine_group_steer(group, buf, sizeof(buf));
+        if (i < N_ENGINES)
+            assert(shard == (int) i);
+        else
+            assert(shard == -1);
+    }
+
+    /* No connection ID */
+    buf[0] = 0x00;
+    assert(-1 == lsquic_engine_group_steer(group, buf, sizeof(buf)));
+
+    lsquic_engine_group_destroy(group);
+
+    assert(!lsquic_engine_group_new(LSENG_SERVER, apis, N_ENGINES));
+    assert(!lsquic_engine_group_new(0, apis, 0));
+    assert(!lsquic_engine_group_new(0, apis, LSQUIC_MAX_ENGINES_IN_GROUP + 1));
+
+    /* In debug builds, the encryption session functions can be replaced */
+    lsquic_enc_session_gquic_1.esf_create_client = mock_create_client;
+    lsquic_enc_session_gquic_1.esf_destroy = mock_destroy;
+    test_connect();
+
+    return 0;
+}
@@ -0,0 +1,1091 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test how the engine passes packets between the application and
+ * connections.  Connections are replaced by mock connections: the test
+ * overrides full_conn_client_new() so that lsquic_engine_connect() returns
+ * one of them.  Mock connections record the packets they are given to send
+ * and the incoming packets the engine passes to them.
+ */
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_in.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_parse.h"
+#include "lsquic_conn.h"
+#include "lsquic_str.h"
+#include "lsquic_handshake.h"
+#include "lsquic_full_conn.h"
+#include "lsquic_util.h"
+
+
+#define MAX_PACKETS 16
+#define MAX_PACKETS_IN 128
+
+
+/* Buffers given back via ea_packin_release, in order */
+struct release_rec
+{
+    const unsigned char        *bufs[MAX_PACKETS_IN];
+    unsigned                    n_released;
+};
+
+
+static void
+packin_release (void *ctx, void *buf)
+{
+    struct release_rec *const rec = ctx;
+    assert(rec->n_released < MAX_PACKETS_IN);
+    rec->bufs[ rec->n_released++ ] = buf;
+}
+
+
+static unsigned
+n_releases (const struct release_rec *rec, const unsigned char *buf)
+{
+    unsigned n, count = 0;
+
+    for (n = 0; n < rec->n_released; ++n)
+        count += rec->bufs[n] == buf;
+    return count;
+}
+
+
+struct test_conn
+{
+    struct lsquic_conn          lconn;
+    /* Packets the connection wants to send, in order */
+    struct lsquic_packet_out   *queue[MAX_PACKETS];
+    unsigned                    n_queued;
+    /* Packets reported as sent by the engine, in order */
+    struct lsquic_packet_out   *sent[MAX_PACKETS];
+    unsigned                    n_sent;
+    /* Packets the engine passed to the connection, in order */
+    struct {
+        const unsigned char    *data;
+        size_t                  sz;
+        lsquic_packno_t         packno;
+        /* Set if `decrypt' is set: */
+        int                     decrypt_st;
+        const unsigned char    *decrypted;
+        unsigned                n_releases;     /* Before decryption */
+    }                           in[MAX_PACKETS_IN];
+    unsigned                    n_in;
+    /* If set, incoming packets are decrypted using mock_esf */
+    int                         decrypt;
+    const struct release_rec   *released;
+    struct lsquic_engine_public *enpub;
+    lsquic_conn_ctx_t          *conn_ctx;
+    int                         destroyed;
+};
+
+
+static enum tick_st
+test_conn_tick (struct lsquic_conn *lconn, lsquic_time_t now)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    return conn->n_queued ? TICK_SEND : TICK_QUIET;
+}
+
+
+static struct lsquic_packet_out *
+test_conn_next_packet_to_send (struct lsquic_conn *lconn)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    struct lsquic_packet_out *packet_out;
+
+    if (conn->n_queued == 0)
+        return NULL;
+    packet_out = conn->queue[0];
+    --conn->n_queued;
+    memmove(conn->queue, conn->queue + 1,
+                                conn->n_queued * sizeof(conn->queue[0]));
+    return packet_out;
+}
+
+
+static void
+test_conn_packet_sent (struct lsquic_conn *lconn,
+                                        struct lsquic_packet_out *packet_out)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    assert(conn->n_sent < MAX_PACKETS);
+    conn->sent[ conn->n_sent++ ] = packet_out;
+}
+
+
+static void
+test_conn_packet_not_sent (struct lsquic_conn *lconn,
+                                        struct lsquic_packet_out *packet_out)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    assert(conn->n_queued < MAX_PACKETS);
+    memmove(conn->queue + 1, conn->queue,
+                                conn->n_queued * sizeof(conn->queue[0]));
+    conn->queue[0] = packet_out;
+    ++conn->n_queued;
+}
+
+
+static void
+test_conn_packet_in (struct lsquic_conn *lconn,
+                                        struct lsquic_packet_in *packet_in)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    assert(conn->n_in < MAX_PACKETS_IN);
+    conn->in[ conn->n_in ].data   = packet_in->pi_data;
+    conn->in[ conn->n_in ].sz     = packet_in->pi_data_sz;
+    conn->in[ conn->n_in ].packno = packet_in->pi_packno;
+    if (conn->decrypt)
+    {
+        if (conn->released)
+            conn->in[ conn->n_in ].n_releases
+                            = n_releases(conn->released, packet_in->pi_data);
+        conn->in[ conn->n_in ].decrypt_st
+                    = lsquic_conn_decrypt_packet(lconn, conn->enpub, packet_in);
+        conn->in[ conn->n_in ].decrypted = packet_in->pi_data;
+    }
+    ++conn->n_in;
+}
+
+
+static void
+test_conn_destroy (struct lsquic_conn *lconn)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    conn->destroyed = 1;
+}
+
+
+static int
+test_conn_is_tickable (struct lsquic_conn *lconn)
+{
+    return 0;
+}
+
+
+static lsquic_time_t
+test_conn_next_tick_time (struct lsquic_conn *lconn)
+{
+    return lsquic_time_now() + 10000000;
+}
+
+
+static const struct conn_iface test_conn_iface =
+{
+    .ci_tick                = test_conn_tick,
+    .ci_next_packet_to_send = test_conn_next_packet_to_send,
+    .ci_packet_sent         = test_conn_packet_sent,
+    .ci_packet_not_sent     = test_conn_packet_not_sent,
+    .ci_packet_in           = test_conn_packet_in,
+    .ci_destroy             = test_conn_destroy,
+    .ci_is_tickable         = test_conn_is_tickable,
+    .ci_next_tick_time      = test_conn_next_tick_time,
+};
+
+
+/* The mock cipher flips all bits of the payload.  Decryption fails if the
+ * first byte of ciphertext is DECRYPT_FAIL; the payload is clobbered then,
+ * like a real cipher could do when decrypting in place.
+ */
+#define DECRYPT_FAIL 0xFF
+
+static enum enc_level
+mock_decrypt (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+                   uint8_t path_id, uint64_t pack_num,
+                   unsigned char *buf, size_t *header_len, size_t data_len,
+                   unsigned char *diversification_nonce,
+                   unsigned char *buf_out, size_t max_out_len, size_t *out_len)
+{
+    size_t n;
+
+    assert(*header_len + data_len <= max_out_len);
+    if (data_len > 0 && buf[*header_len] == DECRYPT_FAIL)
+    {
+        memset(buf_out + *header_len, 0x11, data_len);
+        return (enum enc_level) -1;
+    }
+
+    if (buf_out != buf)
+        memcpy(buf_out, buf, *header_len);
+    for (n = *header_len; n < *header_len + data_len; ++n)
+        buf_out[n] = ~buf[n];
+    *out_len = data_len;
+    return ENC_LEV_FORW;
+}
+
+
+static const struct enc_session_funcs mock_esf =
+{
+    .esf_decrypt = mock_decrypt,
+};
+
+
+/* The connection to be returned by the next call to full_conn_client_new */
+static struct test_conn *s_next_conn;
+static lsquic_cid_t s_next_cid = 1;
+
+
+struct lsquic_conn *
+full_conn_client_new (struct lsquic_engine_public *enpub,
+               const struct lsquic_stream_if *stream_if,
+               void *stream_if_ctx,
+               unsigned flags,
+               const char *hostname, unsigned short max_packet_size,
+               const unsigned char *zero_rtt, size_t zero_rtt_len)
+{
+    struct test_conn *const conn = s_next_conn;
+
+    assert(conn);
+    s_next_conn = NULL;
+    conn->lconn.cn_if       = &test_conn_iface;
+    conn->lconn.cn_cid      = s_next_cid++;
+    conn->lconn.cn_version  = LSQVER_039;
+    conn->lconn.cn_pf       = select_pf_by_ver(LSQVER_039);
+    conn->lconn.cn_pack_size = max_packet_size;
+    conn->lconn.cn_esf      = &mock_esf;
+    conn->enpub             = enpub;
+    return &conn->lconn;
+}
+
+
+void
+full_conn_client_call_on_new (struct lsquic_conn *lconn)
+{
+}
+
+
+void
+lsquic_conn_set_ctx (lsquic_conn_t *lconn, lsquic_conn_ctx_t *ctx)
+{
+    struct test_conn *const conn = (struct test_conn *) lconn;
+    conn->conn_ctx = ctx;
+}
+
+
+#define MAX_SPECS 32
+
+/* What the engine passed to packets_out callback */
+struct out_rec
+{
+    unsigned            n_specs;
+    struct {
+        void               *peer_ctx;
+        const struct sockaddr *dest_sa;
+        size_t              iovlen;
+        unsigned short      segsz;
+        const unsigned char *bufs[MAX_PACKETS];
+        size_t              lens[MAX_PACKETS];
+    }                   specs[MAX_SPECS];
+    /* How many specs the callback reports as sent.  Negative value means
+     * all of them.
+     */
+    int                 n_to_accept;
+};
+
+
+static int
+packets_out (void *ctx, const struct lsquic_out_spec *specs, unsigned count)
+{
+    struct out_rec *const rec = ctx;
+    unsigned n, i;
+
+    if (rec->n_to_accept >= 0 && count > (unsigned) rec->n_to_accept)
+        count = rec->n_to_accept;
+
+    for (n = 0; n < count; ++n)
+    {
+        assert(rec->n_specs < MAX_SPECS);
+        assert(specs[n].iovlen <= MAX_PACKETS);
+        /* The first datagram is also described by `buf' and `sz' */
+        assert(specs[n].buf == specs[n].iov[0].iov_base);
+        assert(specs[n].sz == specs[n].iov[0].iov_len);
+        rec->specs[rec->n_specs].peer_ctx = specs[n].peer_ctx;
+        rec->specs[rec->n_specs].dest_sa  = specs[n].dest_sa;
+        rec->specs[rec->n_specs].iovlen   = specs[n].iovlen;
+        rec->specs[rec->n_specs].segsz    = specs[n].segsz;
+        for (i = 0; i < specs[n].iovlen; ++i)
+        {
+            rec->specs[rec->n_specs].bufs[i] = specs[n].iov[i].iov_base;
+            rec->specs[rec->n_specs].lens[i] = specs[n].iov[i].iov_len;
+        }
+        ++rec->n_specs;
+    }
+
+    return (int) count;
+}
+
+
+/* If `released' is not NULL, the engine owns incoming packet buffers */
+static struct lsquic_engine *
+new_engine (struct out_rec *rec, int gso, struct release_rec *released)
+{
+    struct lsquic_engine_settings settings;
+    struct lsquic_engine_api api;
+
+    lsquic_engine_init_settings(&settings, 0);
+    settings.es_gso = gso;
+    /* Look up connections by connection ID, not by local address */
+    settings.es_versions = 1 << LSQVER_039;
+    settings.es_support_tcid0 = 0;
+
+    memset(&api, 0, sizeof(api));
+    api.ea_settings = &settings;
+    api.ea_packets_out = packets_out;
+    api.ea_packets_out_ctx = rec;
+    if (released)
+    {
+        api.ea_packin_release = packin_release;
+        api.ea_packin_release_ctx = released;
+    }
+    return lsquic_engine_new(0, &api);
+}
+
+
+static void
+init_addrs (struct sockaddr_in *local, struct sockaddr_in *peer,
+                                                        unsigned short port)
+{
+    memset(local, 0, sizeof(*local));
+    local->sin_family = AF_INET;
+    local->sin_port = htons(port);
+    memset(peer, 0, sizeof(*peer));
+    peer->sin_family = AF_INET;
+    peer->sin_port = htons(443);
+}
+
+
+static void
+connect_conn (struct lsquic_engine *engine, struct test_conn *conn,
+                                                        unsigned short port)
+{
+    struct sockaddr_in local, peer;
+    lsquic_conn_t *lconn;
+
+    init_addrs(&local, &peer, port);
+    s_next_conn = conn;
+    lconn = lsquic_engine_connect(engine, (struct sockaddr *) &local,
+                    (struct sockaddr *) &peer, conn /* peer_ctx */, NULL,
+                    "localhost", 0, NULL, 0);
+    assert(lconn == &conn->lconn);
+}
+
+
+struct test_packets
+{
+    struct lsquic_packet_out    packets[MAX_PACKETS];
+    unsigned char               bufs[MAX_PACKETS][1400];
+};
+
+
+/* Queue unencrypted packets of given sizes on the connection */
+static void
+queue_packets (struct test_conn *conn, struct test_packets *tp,
+                                    const unsigned short *sizes, unsigned n)
+{
+    unsigned i;
+
+    memset(tp, 0, sizeof(*tp));
+    for (i = 0; i < n; ++i)
+    {
+        tp->packets[i].po_packno  = i + 1;
+        tp->packets[i].po_flags   = PO_NOENCRYPT;
+        tp->packets[i].po_data    = tp->bufs[i];
+        tp->packets[i].po_data_sz = sizes[i];
+        tp->packets[i].po_n_alloc = sizeof(tp->bufs[i]);
+        conn->queue[ conn->n_queued++ ] = &tp->packets[i];
+    }
+}
+
+
+/* Check that the specs carrying this connection's packets contain exactly
+ * the packets the connection was told were sent, in order, and that they
+ * are grouped as expected.  `expected' is the number of datagrams in each
+ * spec, terminated by zero.
+ */
+static void
+verify_specs (const struct out_rec *rec, const struct test_conn *conn,
+                                                    const unsigned *expected)
+{
+    unsigned n, i, n_packets = 0;
+
+    for (n = 0; n < rec->n_specs; ++n)
+    {
+        if (rec->specs[n].peer_ctx != conn)
+            continue;
+        assert(*expected);
+        assert(rec->specs[n].iovlen == *expected);
+        ++expected;
+        assert(rec->specs[n].dest_sa
+                        == (struct sockaddr *) conn->lconn.cn_peer_addr);
+        assert(rec->specs[n].segsz == rec->specs[n].lens[0]);
+        for (i = 0; i < rec->specs[n].iovlen; ++i)
+        {
+            /* All datagrams but the last one are the same size; the last
+             * one may be shorter.
+             */
+            if (i + 1 < rec->specs[n].iovlen)
+                assert(rec->specs[n].lens[i] == rec->specs[n].segsz);
+            else
+                assert(rec->specs[n].lens[i] <= rec->specs[n].segsz);
+            assert(n_packets < conn->n_sent);
+            assert(rec->specs[n].bufs[i] == conn->sent[n_packets]->po_data);
+            assert(rec->specs[n].lens[i]
+                                    == conn->sent[n_packets]->po_data_sz);
+            ++n_packets;
+        }
+    }
+    assert(0 == *expected);
+    assert(n_packets == conn->n_sent);
+}
+
+
+/* With GSO, consecutive packets from the same connection are coalesced
+ * into one spec for as long as they are the same size.  A shorter packet
+ * ends the spec; a longer one starts a new spec.
+ */
+static void
+test_coalesce (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conns[2];
+    struct test_packets tps[2];
+    static const unsigned short sizes_a[] = { 1200, 1200, 1200, 800, 1200, };
+    static const unsigned short sizes_b[] = { 1000, 1200, 1200, };
+    static const unsigned expected_a[] = { 4, 1, 0, };
+    static const unsigned expected_b[] = { 1, 2, 0, };
+
+    memset(&rec, 0, sizeof(rec));
+    rec.n_to_accept = -1;
+    memset(conns, 0, sizeof(conns));
+    engine = new_engine(&rec, 1, NULL);
+    assert(engine);
+    connect_conn(engine, &conns[0], 10000);
+    connect_conn(engine, &conns[1], 10001);
+    queue_packets(&conns[0], &tps[0], sizes_a, 5);
+    queue_packets(&conns[1], &tps[1], sizes_b, 3);
+
+    lsquic_engine_process_conns(engine);
+
+    assert(4 == rec.n_specs);
+    assert(0 == conns[0].n_queued);
+    assert(0 == conns[1].n_queued);
+    assert(5 == conns[0].n_sent);
+    assert(3 == conns[1].n_sent);
+    verify_specs(&rec, &conns[0], expected_a);
+    verify_specs(&rec, &conns[1], expected_b);
+
+    lsquic_engine_destroy(engine);
+    assert(conns[0].destroyed);
+    assert(conns[1].destroyed);
+}
+
+
+/* Without GSO, each packet gets its own spec */
+static void
+test_no_coalesce (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    struct test_packets tp;
+    static const unsigned short sizes[] = { 1200, 1200, 1200, 800, };
+    static const unsigned expected[] = { 1, 1, 1, 1, 0, };
+
+    memset(&rec, 0, sizeof(rec));
+    rec.n_to_accept = -1;
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+    queue_packets(&conn, &tp, sizes, 4);
+
+    lsquic_engine_process_conns(engine);
+
+    assert(4 == rec.n_specs);
+    verify_specs(&rec, &conn, expected);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* If only some of the specs are sent, the packets in them -- and only
+ * those -- are reported as sent.  The rest go back to the connection in
+ * the original order and are sent later.
+ */
+static void
+test_partial_send (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    struct test_packets tp;
+    static const unsigned short sizes[] = { 1200, 1200, 700, 1200, 1200, };
+    static const unsigned expected_first[] = { 3, 0, };
+    static const unsigned expected_all[] = { 3, 2, 0, };
+
+    memset(&rec, 0, sizeof(rec));
+    rec.n_to_accept = 1;
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 1, NULL);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+    queue_packets(&conn, &tp, sizes, 5);
+
+    lsquic_engine_process_conns(engine);
+
+    assert(1 == rec.n_specs);
+    assert(3 == conn.n_sent);
+    verify_specs(&rec, &conn, expected_first);
+    assert(2 == conn.n_queued);
+    assert(conn.queue[0] == &tp.packets[3]);
+    assert(conn.queue[1] == &tp.packets[4]);
+    assert(lsquic_engine_has_unsent_packets(engine));
+
+    rec.n_to_accept = -1;
+    lsquic_engine_send_unsent_packets(engine);
+
+    assert(2 == rec.n_specs);
+    assert(5 == conn.n_sent);
+    assert(0 == conn.n_queued);
+    verify_specs(&rec, &conn, expected_all);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Write a gQUIC packet addressed to `conn' into `buf' and pad it to `sz'
+ * bytes.  Packet number is one byte long.
+ */
+static void
+write_packet (unsigned char *buf, size_t sz, const struct test_conn *conn,
+                                                    lsquic_packno_t packno)
+{
+    assert(sz >= 10);
+    memset(buf, 0, sz);
+    buf[0] = PACKET_PUBLIC_FLAGS_8BYTE_CONNECTION_ID;
+    memcpy(buf + 1, &conn->lconn.cn_cid, 8);
+    buf[9] = (unsigned char) packno;
+}
+
+
+static int
+gro_in (struct lsquic_engine *engine, const unsigned char *buf, size_t bufsz,
+                                                size_t segsz, void *peer_ctx)
+{
+    struct sockaddr_in local, peer;
+
+    init_addrs(&local, &peer, 10000);
+    return lsquic_engine_packet_in_gro(engine, buf, bufsz, segsz,
+            (struct sockaddr *) &local, (struct sockaddr *) &peer, peer_ctx);
+}
+
+
+static void
+verify_in (const struct test_conn *conn, unsigned idx,
+            const unsigned char *data, size_t sz, lsquic_packno_t packno)
+{
+    assert(idx < conn->n_in);
+    assert(conn->in[idx].data == data);
+    assert(conn->in[idx].sz == sz);
+    assert(conn->in[idx].packno == packno);
+}
+
+
+/* The GRO buffer is split into segments of equal size; the last one may
+ * be shorter.  Each segment is passed to the connection whose ID it
+ * carries.
+ */
+static void
+test_gro_short_tail (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conns[2];
+    unsigned char buf[100 * 3 + 40];
+    int peer_ctx, n;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(conns, 0, sizeof(conns));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conns[0], 10000);
+    connect_conn(engine, &conns[1], 10001);
+
+    write_packet(buf,       100, &conns[0], 1);
+    write_packet(buf + 100, 100, &conns[1], 1);
+    write_packet(buf + 200, 100, &conns[0], 2);
+    write_packet(buf + 300,  40, &conns[1], 2);
+    n = gro_in(engine, buf, sizeof(buf), 100, &peer_ctx);
+
+    assert(4 == n);
+    assert(2 == conns[0].n_in);
+    verify_in(&conns[0], 0, buf,       100, 1);
+    verify_in(&conns[0], 1, buf + 200, 100, 2);
+    assert(2 == conns[1].n_in);
+    verify_in(&conns[1], 0, buf + 100, 100, 1);
+    verify_in(&conns[1], 1, buf + 300,  40, 2);
+    assert(conns[0].lconn.cn_peer_ctx == &peer_ctx);
+    assert(conns[1].lconn.cn_peer_ctx == &peer_ctx);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* When the buffer size is a multiple of segment size, there is no short
+ * tail and no empty segment.  Buffers larger than the engine's batch are
+ * processed in several batches.
+ */
+static void
+test_gro_exact_multiple (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conns[2];
+    unsigned char buf[20 * 100];
+    unsigned i;
+    int n;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(conns, 0, sizeof(conns));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conns[0], 10000);
+    connect_conn(engine, &conns[1], 10001);
+
+    for (i = 0; i < 100; ++i)
+        write_packet(buf + i * 20, 20, &conns[i & 1], 1 + i / 2);
+    n = gro_in(engine, buf, sizeof(buf), 20, NULL);
+
+    assert(100 == n);
+    for (i = 0; i < 100; ++i)
+        verify_in(&conns[i & 1], i / 2, buf + i * 20, 20, 1 + i / 2);
+    assert(50 == conns[0].n_in);
+    assert(50 == conns[1].n_in);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Segment size larger than the buffer: the whole buffer is one packet */
+static void
+test_gro_large_segsz (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    unsigned char buf[150];
+    int n;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+
+    write_packet(buf, sizeof(buf), &conn, 1);
+    n = gro_in(engine, buf, sizeof(buf), 1350, NULL);
+
+    assert(1 == n);
+    assert(1 == conn.n_in);
+    verify_in(&conn, 0, buf, sizeof(buf), 1);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Zero segment size is an error: nothing is processed */
+static void
+test_gro_zero_segsz (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    unsigned char buf[150];
+    int n;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+
+    write_packet(buf, sizeof(buf), &conn, 1);
+    errno = 0;
+    n = gro_in(engine, buf, sizeof(buf), 0, NULL);
+
+    assert(-1 == n);
+    assert(EINVAL == errno);
+    assert(0 == conn.n_in);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+static int
+packet_in (struct lsquic_engine *engine, const unsigned char *buf, size_t sz)
+{
+    struct sockaddr_in local, peer;
+
+    init_addrs(&local, &peer, 10000);
+    return lsquic_engine_packet_in(engine, buf, sz,
+                (struct sockaddr *) &local, (struct sockaddr *) &peer, NULL);
+}
+
+
+/* Return true if all `sz' bytes at `p' are equal to `byte' */
+static int
+all_bytes (const unsigned char *p, size_t sz, unsigned char byte)
+{
+    while (sz > 0 && *p == byte)
+        ++p, --sz;
+    return sz == 0;
+}
+
+
+static void
+init_specs (struct lsquic_in_spec *specs, unsigned n_specs,
+            struct sockaddr_in *local, struct sockaddr_in *peer)
+{
+    unsigned i;
+
+    init_addrs(local, peer, 10000);
+    for (i = 0; i < n_specs; ++i)
+    {
+        specs[i].local_sa = (struct sockaddr *) local;
+        specs[i].peer_sa  = (struct sockaddr *) peer;
+        specs[i].peer_ctx = NULL;
+    }
+}
+
+
+/* When the engine owns packet buffers, packets are decrypted in place in
+ * the caller's buffer, which is released exactly once after the connection
+ * is done with it -- whether decryption succeeded or not.
+ */
+static void
+test_decrypt_in_place (void)
+{
+    struct out_rec rec;
+    struct release_rec released;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    unsigned char good[100], bad[100];
+    int s;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(&released, 0, sizeof(released));
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 0, &released);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+    conn.decrypt = 1;
+    conn.released = &released;
+
+    write_packet(good, sizeof(good), &conn, 1);
+    s = packet_in(engine, good, sizeof(good));
+    assert(0 == s);
+    assert(1 == conn.n_in);
+    assert(0 == conn.in[0].decrypt_st);
+    assert(0 == conn.in[0].n_releases);
+    assert(conn.in[0].data == good);
+    assert(conn.in[0].decrypted == good);
+    assert(all_bytes(good + 10, sizeof(good) - 10, 0xFF));
+    assert(1 == n_releases(&released, good));
+
+    write_packet(bad, sizeof(bad), &conn, 2);
+    bad[10] = DECRYPT_FAIL;
+    s = packet_in(engine, bad, sizeof(bad));
+    assert(0 == s);
+    assert(2 == conn.n_in);
+    assert(-1 == conn.in[1].decrypt_st);
+    assert(0 == conn.in[1].n_releases);
+    /* The tail is restored for stateless reset check */
+    assert(all_bytes(bad + sizeof(bad) - SRST_LENGTH, SRST_LENGTH, 0));
+    assert(1 == n_releases(&released, bad));
+
+    assert(2 == released.n_released);
+    lsquic_engine_destroy(engine);
+    assert(2 == released.n_released);
+}
+
+
+/* Without ea_packin_release, the caller's buffer is not modified: the
+ * packet is decrypted into a buffer of its own.
+ */
+static void
+test_decrypt_copy (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conn;
+    unsigned char buf[100];
+    int s;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(&conn, 0, sizeof(conn));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+    conn.decrypt = 1;
+
+    write_packet(buf, sizeof(buf), &conn, 1);
+    s = packet_in(engine, buf, sizeof(buf));
+    assert(0 == s);
+    assert(1 == conn.n_in);
+    assert(0 == conn.in[0].decrypt_st);
+    assert(conn.in[0].data == buf);
+    assert(conn.in[0].decrypted != buf);
+    assert(all_bytes(buf + 10, sizeof(buf) - 10, 0));
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Packets dropped before they reach a connection are released exactly
+ * once, on all input paths.
+ */
+static void
+test_release_dropped (void)
+{
+    struct out_rec rec;
+    struct release_rec released;
+    struct lsquic_engine *engine;
+    struct test_conn conn, other;
+    unsigned char unknown[100], short_hdr[5], prst[100], big[2000],
+                  good[100], gro[60 * 3];
+    struct lsquic_in_spec specs[5];
+    struct sockaddr_in local, peer;
+    unsigned i;
+    int s;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(&released, 0, sizeof(released));
+    memset(&conn, 0, sizeof(conn));
+    memset(&other, 0, sizeof(other));
+    engine = new_engine(&rec, 0, &released);
+    assert(engine);
+    connect_conn(engine, &conn, 10000);
+    other.lconn.cn_cid = 12345;     /* Not in the engine */
+
+    write_packet(unknown, sizeof(unknown), &other, 1);
+    memset(short_hdr, 0, sizeof(short_hdr));
+    short_hdr[0] = PACKET_PUBLIC_FLAGS_8BYTE_CONNECTION_ID;
+    write_packet(prst, sizeof(prst), &conn, 1);
+    prst[0] |= PACKET_PUBLIC_FLAGS_RST;
+    write_packet(big, sizeof(big), &conn, 1);
+    write_packet(good, sizeof(good), &conn, 1);
+
+    /* One packet at a time */
+    s = packet_in(engine, unknown, sizeof(unknown));
+    assert(1 == s);
+    s = packet_in(engine, short_hdr, sizeof(short_hdr));
+    assert(-1 == s);
+    s = packet_in(engine, prst, sizeof(prst));
+    assert(1 == s);
+    s = packet_in(engine, big, sizeof(big));
+    assert(-1 == s);
+    assert(0 == conn.n_in);
+    assert(4 == released.n_released);
+    assert(1 == n_releases(&released, unknown));
+    assert(1 == n_releases(&released, short_hdr));
+    assert(1 == n_releases(&released, prst));
+    assert(1 == n_releases(&released, big));
+
+    /* Batch: the good packet is processed, the rest are dropped */
+    memset(&released, 0, sizeof(released));
+    init_specs(specs, 5, &local, &peer);
+    specs[0].buf = unknown;
+    specs[0].sz  = sizeof(unknown);
+    specs[1].buf = short_hdr;
+    specs[1].sz  = sizeof(short_hdr);
+    specs[2].buf = good;
+    specs[2].sz  = sizeof(good);
+    specs[3].buf = prst;
+    specs[3].sz  = sizeof(prst);
+    specs[4].buf = big;
+    specs[4].sz  = sizeof(big);
+    s = lsquic_engine_packets_in(engine, specs, 5);
+    assert(1 == s);
+    assert(1 == conn.n_in);
+    assert(5 == released.n_released);
+    for (i = 0; i < 5; ++i)
+        assert(1 == n_releases(&released, specs[i].buf));
+
+    /* GRO: each segment is released; with zero segment size, the whole
+     * buffer is.
+     */
+    memset(&released, 0, sizeof(released));
+    write_packet(gro,       60, &other, 2);
+    write_packet(gro + 60,  60, &conn, 2);
+    write_packet(gro + 120, 60, &other, 3);
+    s = gro_in(engine, gro, sizeof(gro), 60, NULL);
+    assert(1 == s);
+    assert(2 == conn.n_in);
+    assert(3 == released.n_released);
+    assert(1 == n_releases(&released, gro));
+    assert(1 == n_releases(&released, gro + 60));
+    assert(1 == n_releases(&released, gro + 120));
+
+    memset(&released, 0, sizeof(released));
+    s = gro_in(engine, gro, sizeof(gro), 0, NULL);
+    assert(-1 == s);
+    assert(2 == conn.n_in);
+    assert(1 == released.n_released);
+    assert(1 == n_releases(&released, gro));
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Packets in a batch are grouped by connection.  Each connection gets its
+ * packets in the order they arrived.  A packet that cannot be processed
+ * does not stop processing of the packets that follow it, and it is not
+ * counted in the return value.
+ */
+static void
+test_packets_in_mixed (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conns[3], other;
+    unsigned char bufs[10][100];
+    struct lsquic_in_spec specs[10];
+    struct sockaddr_in local, peer;
+    int peer_ctx, s;
+    unsigned i;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(conns, 0, sizeof(conns));
+    memset(&other, 0, sizeof(other));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conns[0], 10000);
+    connect_conn(engine, &conns[1], 10001);
+    connect_conn(engine, &conns[2], 10002);
+    other.lconn.cn_cid = 12345;     /* Not in the engine */
+
+    write_packet(bufs[0], 100, &conns[2], 1);
+    write_packet(bufs[1], 100, &conns[0], 1);
+    write_packet(bufs[2], 100, &conns[2], 2);
+    write_packet(bufs[3], 100, &other, 1);
+    write_packet(bufs[4], 100, &conns[1], 1);
+    write_packet(bufs[5], 100, &conns[0], 2);   /* Truncated below */
+    write_packet(bufs[6], 100, &conns[0], 3);
+    write_packet(bufs[7], 100, &conns[2], 3);
+    write_packet(bufs[8], 100, &conns[1], 2);
+    bufs[8][0] |= PACKET_PUBLIC_FLAGS_RST;
+    write_packet(bufs[9], 100, &conns[1], 3);
+
+    init_specs(specs, 10, &local, &peer);
+    for (i = 0; i < 10; ++i)
+    {
+        specs[i].buf = bufs[i];
+        specs[i].sz  = 100;
+        specs[i].peer_ctx = &peer_ctx;
+    }
+    specs[5].sz = 5;    /* Too short to contain the header */
+    s = lsquic_engine_packets_in(engine, specs, 10);
+
+    assert(7 == s);
+    assert(2 == conns[0].n_in);
+    verify_in(&conns[0], 0, bufs[1], 100, 1);
+    verify_in(&conns[0], 1, bufs[6], 100, 3);
+    assert(2 == conns[1].n_in);
+    verify_in(&conns[1], 0, bufs[4], 100, 1);
+    verify_in(&conns[1], 1, bufs[9], 100, 3);
+    assert(3 == conns[2].n_in);
+    verify_in(&conns[2], 0, bufs[0], 100, 1);
+    verify_in(&conns[2], 1, bufs[2], 100, 2);
+    verify_in(&conns[2], 2, bufs[7], 100, 3);
+    for (i = 0; i < 3; ++i)
+        assert(conns[i].lconn.cn_peer_ctx == &peer_ctx);
+
+    /* Empty batch */
+    s = lsquic_engine_packets_in(engine, specs, 0);
+    assert(0 == s);
+
+    lsquic_engine_destroy(engine);
+}
+
+
+/* Batches larger than the engine's internal batch are split without
+ * losing or reordering packets.
+ */
+static void
+test_packets_in_large (void)
+{
+    struct out_rec rec;
+    struct lsquic_engine *engine;
+    struct test_conn conns[2], other;
+    unsigned char bufs[150][20];
+    struct lsquic_in_spec specs[150];
+    struct sockaddr_in local, peer;
+    unsigned i, n_in[2];
+    int s;
+
+    memset(&rec, 0, sizeof(rec));
+    memset(conns, 0, sizeof(conns));
+    memset(&other, 0, sizeof(other));
+    engine = new_engine(&rec, 0, NULL);
+    assert(engine);
+    connect_conn(engine, &conns[0], 10000);
+    connect_conn(engine, &conns[1], 10001);
+    other.lconn.cn_cid = 12345;
+
+    init_specs(specs, 150, &local, &peer);
+    n_in[0] = n_in[1] = 0;
+    for (i = 0; i < 150; ++i)
+    {
+        if (i % 10 == 9)
+            write_packet(bufs[i], 20, &other, 1);
+        else
+            write_packet(bufs[i], 20, &conns[i & 1], ++n_in[i & 1]);
+        specs[i].buf = bufs[i];
+        specs[i].sz  = 20;
+    }
+    s = lsquic_engine_packets_in(engine, specs, 150);
+
+    assert(135 == s);
+    assert(n_in[0] == conns[0].n_in);
+    assert(n_in[1] == conns[1].n_in);
+    n_in[0] = n_in[1] = 0;
+    for (i = 0; i < 150; ++i)
+        if (i % 10 != 9)
+        {
+            verify_in(&conns[i & 1], n_in[i & 1], bufs[i], 20,
+                                                        n_in[i & 1] + 1);
+            ++n_in[i & 1];
+        }
+
+    lsquic_engine_destroy(engine);
+}
+
+
+int
+main (void)
+{
+    test_coalesce();
+    test_no_coalesce();
+    test_partial_send();
+    test_gro_short_tail();
+    test_gro_exact_multiple();
+    test_gro_large_segsz();
+    test_gro_zero_segsz();
+    test_decrypt_in_place();
+    test_decrypt_copy();
+    test_release_dropped();
+    test_packets_in_mixed();
+    test_packets_in_large();
+
+    return 0;
+}
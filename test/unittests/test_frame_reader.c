@@ -43,6 +43,9 @@ struct callback_value   /* What callback returns */
         CV_ERROR,
     }                                   type;
     unsigned                            stream_off; /* Checked only if not zero */
+    int                                 in_block;   /* Raised while decoding
+                                                     * header block
+                                                     */
     union {
         struct headers {
             uint32_t                stream_id;
@@ -121,12 +124,22 @@ compare_errors (const struct cv_error *got_err,
 }
 
 
+/* When the header block is decoded in place, callbacks issued during
+ * decoding precede consumption of the block.  Thus, stream offsets of
+ * such callbacks are only checked when the block is copied.
+ */
+static int s_in_place;
+
+/* Number of times readf_from_stream() consumed data */
+static unsigned s_n_readf;
+
+
 static void
 compare_cb_vals (const struct callback_value *got,
                  const struct callback_value *exp)
 {
     assert(got->type == exp->type);
-    if (exp->stream_off)
+    if (exp->stream_off && !(s_in_place && exp->in_block))
         assert(exp->stream_off == got->stream_off);
     switch (got->type)
     {
@@ -289,6 +302,31 @@ read_from_stream (struct lsquic_stream *stream, void *buf, size_t sz)
 }
 
 
+/* Like lsquic_stream_readf(): offer what read_from_stream() would return
+ * in a single call.
+ */
+static ssize_t
+readf_from_stream (struct lsquic_stream *stream,
+        size_t (*readf)(void *, const unsigned char *, size_t, int), void *ctx)
+{
+    size_t sz, nread;
+
+    sz = input.in_sz - input.in_off;
+    if (sz > input.in_max_sz)
+        sz = input.in_max_sz;
+    nread = readf(ctx, input.in_buf + input.in_off, sz, 0);
+    input.in_off += nread;
+    if (nread > 0)
+        ++s_n_readf;
+    if (nread == 0)
+    {
+        errno = EWOULDBLOCK;
+        return -1;
+    }
+    return nread;
+}
+
+
 struct frame_reader_test {
     unsigned                        frt_lineno;
     /* Input */
@@ -299,6 +337,9 @@ struct frame_reader_test {
     /* Output */
     unsigned short                  frt_in_off;
     int                             frt_err;      /* True if expecting error */
+    int                             frt_in_place; /* True if header block is
+                                                   * decoded in place
+                                                   */
     unsigned                        frt_n_cb_vals;
     struct callback_value           frt_cb_vals[10];
 };
@@ -319,6 +360,7 @@ static const struct frame_reader_test tests[] = {
                                 0x48, 0x82, 0x64, 0x02,
         },
         .frt_bufsz  = 13,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -351,6 +393,7 @@ static const struct frame_reader_test tests[] = {
                                 0xFF,
         },
         .frt_bufsz  = 9 + 1 + 4 + 17,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -395,6 +438,7 @@ static const struct frame_reader_test tests[] = {
         },
         .frt_bufsz  = 9 + 1 + 5 + 4 + 17
                     + 9 + 5,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 2,
         .frt_cb_vals = {
             {
@@ -436,6 +480,7 @@ static const struct frame_reader_test tests[] = {
                                 0x48, 0x82, 0x64, 0x02,
         },
         .frt_bufsz  = 9 + 5 + 4,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -469,6 +514,7 @@ static const struct frame_reader_test tests[] = {
                                 0x60, 0x03, 0x61, 0x3d, 0x62,
         },
         .frt_bufsz  = 9 + 5 + 4 + 5,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -505,6 +551,7 @@ static const struct frame_reader_test tests[] = {
                                 0x60, 0x03, 0x65, 0x3d, 0x66,
         },
         .frt_bufsz  = 9 + 5 + 4 + 15,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -549,6 +596,7 @@ static const struct frame_reader_test tests[] = {
                     + 9 + 0 + 8,
         .frt_err = 1,
         .frt_in_off = 9 + 5 + 17 + 9,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -592,6 +640,7 @@ static const struct frame_reader_test tests[] = {
                     + 9 + 0 + 8,
         .frt_err = 1,
         .frt_in_off = 9 + 5 + 17 + 9,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -727,6 +776,7 @@ static const struct frame_reader_test tests[] = {
         .frt_bufsz  = 9 + 0 + 16
                     + 9 + 5 + 21
                     + 9 + 0 + 17,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 3,
         .frt_cb_vals = {
             {
@@ -772,6 +822,7 @@ static const struct frame_reader_test tests[] = {
                                 0xff,
         },
         .frt_bufsz  = 9 + 0 + 0x15,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 1,
         .frt_cb_vals = {
             {
@@ -935,11 +986,13 @@ static const struct frame_reader_test tests[] = {
         },
         .frt_bufsz  = 9 + 5 + 4 + 9 + 6,
         .frt_max_headers_sz = 10,
+        .frt_in_place = 1,
         .frt_n_cb_vals = 2,
         .frt_cb_vals = {
             {
                 .type = CV_ERROR,
                 .stream_off = 9 + 5 + 4,
+                .in_block = 1,
                 .u.error.code = FR_ERR_HEADERS_TOO_LARGE,
                 .u.error.stream_id = 12345,
             },
@@ -1098,7 +1151,7 @@ static const struct frame_reader_test tests[] = {
 
 
 static void
-test_one_frt (const struct frame_reader_test *frt)
+test_one_frt (const struct frame_reader_test *frt, int in_place)
 {
     struct lsquic_frame_reader *fr;
     unsigned short exp_off;
@@ -1120,6 +1173,8 @@ test_one_frt (const struct frame_reader_test *frt)
     stream.conn_pub = &conn_pub;
     conn_pub.lconn = &lconn;
 
+    s_in_place = in_place;
+    s_n_readf = 0;
     lsquic_mm_init(&mm);
     lshpack_dec_init(&hdec);
     memset(&input, 0, sizeof(input));
@@ -1133,7 +1188,9 @@ test_one_frt (const struct frame_reader_test *frt)
         ++input.in_max_sz;
 
         fr = lsquic_frame_reader_new(frt->frt_fr_flags, frt->frt_max_headers_sz,
-                &mm, &stream, read_from_stream, &hdec, &frame_callbacks, &g_cb_ctx,
+                &mm, &stream, read_from_stream,
+                in_place ? readf_from_stream : NULL, &hdec, &frame_callbacks,
+                &g_cb_ctx,
 #if LSQUIC_CONN_STATS
                 &conn_stats,
 #endif
@@ -1162,6 +1219,249 @@ test_one_frt (const struct frame_reader_test *frt)
         lsquic_frame_reader_destroy(fr);
     }
     while (input.in_max_sz < input.in_max_req_sz);
+    assert(!!s_n_readf == (in_place && frt->frt_in_place));
+    lshpack_dec_cleanup(&hdec);
+    lsquic_mm_cleanup(&mm);
+}
+
+
+/* Header set that provides memory to decode headers into and keeps
+ * pointers to the decoded names and values instead of copying them.
+ * It hands out small buffers to exercise the retry logic.
+ */
+struct zc_hset
+{
+    char                zh_arena[0x400];
+    unsigned            zh_off;         /* Used part of the arena */
+    unsigned            zh_n_prepare;
+    unsigned            zh_n_headers;
+    int                 zh_done;
+    struct {
+        const char     *name,
+                       *value;
+        unsigned        name_len,
+                        val_len;
+    }                   zh_headers[10];
+};
+
+
+static struct zc_hset *s_zc_hset;
+
+
+static void *
+zc_create_header_set (void *hsi_ctx, int is_push_promise)
+{
+    assert(!s_zc_hset);
+    s_zc_hset = calloc(1, sizeof(*s_zc_hset));
+    return s_zc_hset;
+}
+
+
+static char *
+zc_prepare_decode (void *hset_p, unsigned min_space, unsigned *space)
+{
+    struct zc_hset *const hset = hset_p;
+
+    ++hset->zh_n_prepare;
+    if (min_space < 16)
+        min_space = 16;
+    if (min_space > sizeof(hset->zh_arena) - hset->zh_off)
+        return NULL;
+    *space = min_space;
+    return hset->zh_arena + hset->zh_off;
+}
+
+
+static enum lsquic_header_status
+zc_process_header (void *hset_p, unsigned name_idx,
+                   const char *name, unsigned name_len,
+                   const char *value, unsigned value_len)
+{
+    struct zc_hset *const hset = hset_p;
+    unsigned i;
+
+    if (!name)
+    {
+        hset->zh_done = 1;
+        return LSQUIC_HDR_OK;
+    }
+
+    /* Header was decoded in place */
+    assert(name == hset->zh_arena + hset->zh_off);
+    assert(value == name + name_len);
+
+    i = hset->zh_n_headers++;
+    assert(i < sizeof(hset->zh_headers) / sizeof(hset->zh_headers[0]));
+    hset->zh_headers[i].name     = name;
+    hset->zh_headers[i].name_len = name_len;
+    hset->zh_headers[i].value    = value;
+    hset->zh_headers[i].val_len  = value_len;
+    hset->zh_off += name_len + value_len;
+    return LSQUIC_HDR_OK;
+}
+
+
+static void
+zc_discard_header_set (void *hset_p)
+{
+    assert(hset_p == s_zc_hset);
+    free(hset_p);
+    s_zc_hset = NULL;
+}
+
+
+static const struct lsquic_hset_if zc_hsi_if =
+{
+    .hsi_create_header_set  = zc_create_header_set,
+    .hsi_process_header     = zc_process_header,
+    .hsi_discard_header_set = zc_discard_header_set,
+    .hsi_prepare_decode     = zc_prepare_decode,
+};
+
+
+static struct uncompressed_headers *s_zc_uh;
+
+
+static void
+zc_on_headers (void *ctx, struct uncompressed_headers *uh)
+{
+    assert(!s_zc_uh);
+    assert(!(uh->uh_flags & UH_H1H));
+    s_zc_uh = uh;
+}
+
+
+static void
+zc_on_error (void *ctx, uint32_t stream_id, enum frame_reader_error error)
+{
+    assert(0);
+}
+
+
+static const struct frame_reader_callbacks zc_frame_callbacks = {
+    .frc_on_headers      = zc_on_headers,
+    .frc_on_push_promise = zc_on_headers,
+    .frc_on_settings     = on_settings,
+    .frc_on_priority     = on_priority,
+    .frc_on_error        = zc_on_error,
+};
+
+
+/* If `size_update' is set, the header block begins with a dynamic table
+ * size update.  The first header does not fit into the initial buffer, so
+ * the update is applied again when decoding of that header is retried.
+ */
+static void
+test_prepare_decode (int size_update)
+{
+    static const struct {
+        const char *name, *value;
+    } headers[] = {
+        { "content-type", "text/html; charset=utf-8", },
+        { ":status", "200", },
+        { "x-long-header", "0123456789abcdef0123456789abcdef0123456789abcdef"
+                           "0123456789abcdef0123456789abcdef0123456789abcdef", },
+        /* Repeated: refers to the dynamic table entry */
+        { "x-long-header", "0123456789abcdef0123456789abcdef0123456789abcdef"
+                           "0123456789abcdef0123456789abcdef0123456789abcdef", },
+    };
+    const unsigned n_headers = sizeof(headers) / sizeof(headers[0]);
+    struct lsquic_frame_reader *fr;
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsquic_mm mm;
+    struct lsquic_conn lconn;
+    struct lsquic_conn_public conn_pub;
+    struct lsquic_stream stream;
+    unsigned char *p, *end;
+    unsigned i, block_sz;
+    int s;
+
+#if LSQUIC_CONN_STATS
+    struct conn_stats conn_stats;
+    memset(&conn_stats, 0, sizeof(conn_stats));
+#endif
+
+    memset(&stream, 0, sizeof(stream));
+    memset(&lconn, 0, sizeof(lconn));
+    memset(&conn_pub, 0, sizeof(conn_pub));
+    stream.conn_pub = &conn_pub;
+    conn_pub.lconn = &lconn;
+
+    s = lshpack_enc_init(&henc);
+    assert(0 == s);
+    memset(&input, 0, sizeof(input));
+    p = input.in_buf + 9;
+    end = input.in_buf + sizeof(input.in_buf);
+    if (size_update)
+    {
+        /* Dynamic table size update to 256 */
+        lshpack_enc_set_max_capacity(&henc, 256);
+        *p++ = 0x20 | 0x1F;
+        *p++ = 0x80 | ((256 - 0x1F) & 0x7F);
+        *p++ = (256 - 0x1F) >> 7;
+    }
+    for (i = 0; i < n_headers; ++i)
+    {
+        p = lshpack_enc_encode2(&henc, p, end,
+                headers[i].name, strlen(headers[i].name),
+                headers[i].value, strlen(headers[i].value), 0);
+        assert(p < end);
+    }
+    lshpack_enc_cleanup(&henc);
+
+    block_sz = p - input.in_buf - 9;
+    input.in_buf[0] = block_sz >> 16;
+    input.in_buf[1] = block_sz >> 8;
+    input.in_buf[2] = block_sz;
+    input.in_buf[3] = HTTP_FRAME_HEADERS;
+    input.in_buf[4] = HFHF_END_HEADERS;
+    input.in_buf[8] = 1;    /* Stream ID */
+    input.in_sz = p - input.in_buf;
+    input.in_max_sz = input.in_sz;
+
+    lsquic_mm_init(&mm);
+    lshpack_dec_init(&hdec);
+    fr = lsquic_frame_reader_new(0, 0, &mm, &stream, read_from_stream,
+                readf_from_stream, &hdec, &zc_frame_callbacks, &g_cb_ctx,
+#if LSQUIC_CONN_STATS
+                &conn_stats,
+#endif
+                &zc_hsi_if, NULL);
+    do
+    {
+        s = lsquic_frame_reader_read(fr);
+        assert(0 == s);
+    }
+    while (input.in_off < input.in_sz);
+
+    assert(s_zc_uh);
+    assert(s_zc_uh->uh_hset == s_zc_hset);
+    assert(s_zc_hset->zh_done);
+    assert(s_zc_hset->zh_n_headers == n_headers);
+    for (i = 0; i < n_headers; ++i)
+    {
+        assert(s_zc_hset->zh_headers[i].name_len == strlen(headers[i].name));
+        assert(0 == memcmp(s_zc_hset->zh_headers[i].name, headers[i].name,
+                                        s_zc_hset->zh_headers[i].name_len));
+        assert(s_zc_hset->zh_headers[i].val_len == strlen(headers[i].value));
+        assert(0 == memcmp(s_zc_hset->zh_headers[i].value, headers[i].value,
+                                        s_zc_hset->zh_headers[i].val_len));
+    }
+    /* Headers that did not fit were retried with larger buffers */
+    assert(s_zc_hset->zh_n_prepare > n_headers);
+    /* Applying the size update again on retry is harmless */
+    if (size_update)
+        assert(hdec.hpd_cur_max_capacity == 256);
+    /* Retries did not add extra entries to the dynamic table */
+    assert(hdec.hpd_cur_capacity == 2 * 32
+                    + strlen(headers[0].name) + strlen(headers[0].value)
+                    + strlen(headers[2].name) + strlen(headers[2].value));
+
+    zc_discard_header_set(s_zc_uh->uh_hset);
+    free(s_zc_uh);
+    s_zc_uh = NULL;
+    lsquic_frame_reader_destroy(fr);
     lshpack_dec_cleanup(&hdec);
     lsquic_mm_cleanup(&mm);
 }
@@ -1187,6 +1487,11 @@ main (int argc, char **argv)
 
     const struct frame_reader_test *frt;
     for (frt = tests; frt->frt_bufsz > 0; ++frt)
-        test_one_frt(frt);
+    {
+        test_one_frt(frt, 0);
+        test_one_frt(frt, 1);
+    }
+    test_prepare_decode(0);
+    test_prepare_decode(1);
     return 0;
 }
@@ -229,8 +229,8 @@ test_rw (unsigned max_frame_sz)
         uh = NULL;
         stream->sm_off = 0;
 
-        fr = lsquic_frame_reader_new(0, 0, &mm, stream, read_from_stream, &hdec,
-                                &frame_callbacks, &uh,
+        fr = lsquic_frame_reader_new(0, 0, &mm, stream, read_from_stream,
+                                NULL, &hdec, &frame_callbacks, &uh,
 #if LSQUIC_CONN_STATS
                                 &conn_stats,
 #endif
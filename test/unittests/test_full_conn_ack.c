@@ -0,0 +1,421 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test when full connection decides to send ACKs: ACK frequency, ACK
+ * decimation, and the ACK timer.
+ *
+ * A real client connection is created with a mock encryption session.
+ * Incoming packets are marked as decrypted and passed to the connection
+ * directly, bypassing the engine.
+ */
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_in.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_parse.h"
+#include "lsquic_parse_common.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_str.h"
+#include "lsquic_handshake.h"
+#include "lsquic_full_conn.h"
+#include "lsquic_version.h"
+
+
+/* Frames the test server sends: */
+static const unsigned char ping_frame[] = { 0x07, };
+/* ACK of packet 1 (the CHLO) with zero ACK delay: */
+static const unsigned char ack_frame[] =
+                                    { 0x40, 0x01, 0x00, 0x00, 0x01, 0x00, };
+
+
+/* Streams call this engine function.  The test does not have an engine. */
+void
+lsquic_engine_add_conn_to_tickable (struct lsquic_engine_public *enpub,
+                                    lsquic_conn_t *conn)
+{
+}
+
+
+static int s_enc_session;
+
+
+static lsquic_enc_session_t *
+mock_create_client (const char *domain, lsquic_cid_t cid,
+                    const struct lsquic_engine_public *enpub,
+                    const unsigned char *zero_rtt, size_t zero_rtt_len)
+{
+    return (lsquic_enc_session_t *) &s_enc_session;
+}
+
+
+static void
+mock_destroy (lsquic_enc_session_t *enc_session)
+{
+}
+
+
+static int
+mock_gen_chlo (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+               uint8_t *buf, size_t *len)
+{
+    memset(buf, 'C', 100);
+    *len = 100;
+    return 0;
+}
+
+
+static int
+mock_is_zero_rtt_enabled (const lsquic_enc_session_t *enc_session)
+{
+    return 0;
+}
+
+
+static size_t
+mock_mem_used (lsquic_enc_session_t *enc_session)
+{
+    return 0;
+}
+
+
+static void
+on_conn_closed (lsquic_conn_t *lconn)
+{
+}
+
+
+static const struct lsquic_stream_if stream_if =
+{
+    .on_conn_closed = on_conn_closed,
+};
+
+
+struct test_env
+{
+    struct lsquic_engine_public     enpub;
+    struct lsquic_conn             *lconn;
+};
+
+
+static void
+init_env (struct test_env *env, unsigned ack_freq, int ack_decimation)
+{
+    memset(env, 0, sizeof(*env));
+    lsquic_mm_init(&env->enpub.enp_mm);
+    lsquic_engine_init_settings(&env->enpub.enp_settings, 0);
+    env->enpub.enp_settings.es_versions = 1 << LSQVER_039;
+    env->enpub.enp_settings.es_ack_freq = ack_freq;
+    env->enpub.enp_settings.es_ack_decimation = ack_decimation;
+    /* Pacer would schedule ticks using the engine */
+    env->enpub.enp_settings.es_pace_packets = 0;
+    env->lconn = full_conn_client_new(&env->enpub, &stream_if, NULL, 0,
+                                    "www.example.com", 1370, NULL, 0);
+    assert(env->lconn);
+}
+
+
+static void
+cleanup_env (struct test_env *env)
+{
+    env->lconn->cn_if->ci_destroy(env->lconn);
+    lsquic_mm_cleanup(&env->enpub.enp_mm);
+}
+
+
+/* Pass packet `packno' carrying `frames' to the connection as if it had
+ * been received at time `now'.
+ */
+static void
+packet_in (struct test_env *env, lsquic_packno_t packno,
+           const unsigned char *frames, size_t frames_sz, lsquic_time_t now)
+{
+    struct lsquic_packet_in *packet_in;
+    struct packin_parse_state ppstate;
+    size_t sz;
+    int s;
+
+    assert(packno < 0x100);     /* One-byte packet numbers */
+    packet_in = lsquic_mm_get_packet_in(&env->enpub.enp_mm);
+    packet_in->pi_data = lsquic_mm_get_1370(&env->enpub.enp_mm);
+    packet_in->pi_flags |= PI_OWN_DATA;
+    /* Public flags: 8-byte CID, one-byte packet number */
+    packet_in->pi_data[0] = PACKET_PUBLIC_FLAGS_8BYTE_CONNECTION_ID;
+    memcpy(packet_in->pi_data + 1, &env->lconn->cn_cid, 8);
+    packet_in->pi_data[9] = packno;
+    memcpy(packet_in->pi_data + 10, frames, frames_sz);
+    sz = 10 + frames_sz;
+    s = lsquic_parse_packet_in_begin(packet_in, sz, 0, &ppstate);
+    assert(0 == s);
+    env->lconn->cn_pf->pf_parse_packet_in_finish(packet_in, &ppstate);
+    packet_in->pi_flags |= PI_DECRYPTED;
+    packet_in->pi_received = now;
+    lsquic_packet_in_upref(packet_in);
+    env->lconn->cn_if->ci_packet_in(env->lconn, packet_in);
+    lsquic_packet_in_put(&env->enpub.enp_mm, packet_in);
+}
+
+
+static void
+ping (struct test_env *env, lsquic_packno_t packno, lsquic_time_t now)
+{
+    packet_in(env, packno, ping_frame, sizeof(ping_frame), now);
+}
+
+
+static int
+ack_queued (const struct test_env *env)
+{
+    return env->lconn->cn_if->ci_can_write_ack(env->lconn);
+}
+
+
+/* Tick the connection and mark all the packets it produced as sent.
+ * Return true if one of them carried an ACK.
+ */
+static int
+tick (struct test_env *env, lsquic_time_t now)
+{
+    struct lsquic_packet_out *packet_out;
+    int had_ack;
+
+    (void) env->lconn->cn_if->ci_tick(env->lconn, now);
+    had_ack = 0;
+    while ((packet_out = env->lconn->cn_if->ci_next_packet_to_send(
+                                                                env->lconn)))
+    {
+        had_ack |= !!(packet_out->po_frame_types & (1 << QUIC_FRAME_ACK));
+        packet_out->po_sent = now;
+        env->lconn->cn_if->ci_packet_sent(env->lconn, packet_out);
+    }
+    return had_ack;
+}
+
+
+/* Without decimation, an ACK is queued every es_ack_freq ackable packets;
+ * in between, the ACK timer is set.
+ */
+static void
+test_ack_freq (void)
+{
+    struct test_env env;
+    lsquic_time_t now = 1000000;
+    lsquic_packno_t packno;
+    unsigned n;
+
+    init_env(&env, 3, 0);
+
+    packno = 1;
+    for (n = 0; n < 3; ++n)
+    {
+        ping(&env, packno++, now);
+        assert(!ack_queued(&env));
+        assert(env.lconn->cn_if->ci_next_tick_time(env.lconn)
+                                                    == now + ACK_TIMEOUT);
+        ping(&env, packno++, now);
+        assert(!ack_queued(&env));
+        ping(&env, packno++, now);
+        assert(ack_queued(&env));
+        assert(tick(&env, now));
+        assert(!ack_queued(&env));
+        now += 1000;
+    }
+
+    /* Packets with no ackable frames do not count */
+    packet_in(&env, packno++, ack_frame, sizeof(ack_frame), now);
+    packet_in(&env, packno++, ack_frame, sizeof(ack_frame), now);
+    packet_in(&env, packno++, ack_frame, sizeof(ack_frame), now);
+    assert(!ack_queued(&env));
+
+    cleanup_env(&env);
+}
+
+
+/* Feed packets from `first' to `last' and return the list of packet
+ * numbers after which ACK was queued.  The connection sends an ACK
+ * every time one is queued.
+ */
+static unsigned
+acks_after (struct test_env *env, lsquic_packno_t first,
+            lsquic_packno_t last, lsquic_packno_t *acked)
+{
+    lsquic_time_t now = 1000000;
+    lsquic_packno_t packno;
+    unsigned n_acks;
+
+    n_acks = 0;
+    for (packno = first; packno <= last; ++packno)
+    {
+        ping(env, packno, now);
+        if (ack_queued(env))
+        {
+            acked[n_acks++] = packno;
+            assert(tick(env, now));
+        }
+        now += 1000;
+    }
+    return n_acks;
+}
+
+
+/* Decimation begins once packet ACK_DECIMATION_MIN_PACKNO is received.
+ * From then on, every ACK_DECIMATION_FREQ-th packet is ACKed.
+ */
+static void
+test_decimation_threshold (void)
+{
+    struct test_env env;
+    lsquic_packno_t acked[30];
+    unsigned n_acks;
+
+    /* Decimation off: ACK every two packets all the way */
+    init_env(&env, 2, 0);
+    n_acks = acks_after(&env, 95, 125, acked);
+    assert(n_acks == 15);
+    assert(acked[0] == 96);
+    assert(acked[1] == 98);
+    assert(acked[2] == 100);
+    assert(acked[14] == 124);
+    cleanup_env(&env);
+
+    /* Decimation on: ACK every two packets until the threshold */
+    init_env(&env, 2, 1);
+    n_acks = acks_after(&env, 95, 125, acked);
+    assert(n_acks == 4);
+    assert(acked[0] == 96);
+    assert(acked[1] == 98);
+    /* Packet 99 counts toward the first decimated ACK */
+    assert(acked[2] == 99 + ACK_DECIMATION_FREQ - 1);
+    assert(acked[3] == 99 + ACK_DECIMATION_FREQ * 2 - 1);
+    cleanup_env(&env);
+
+    /* A larger configured frequency is not lowered by decimation */
+    init_env(&env, 15, 1);
+    n_acks = acks_after(&env, 95, 125, acked);
+    assert(n_acks == 2);
+    assert(acked[0] == 109);
+    assert(acked[1] == 124);
+    cleanup_env(&env);
+}
+
+
+/* The ACK timer is a quarter of smoothed RTT when decimation is on and
+ * ACK_TIMEOUT otherwise.
+ */
+static void
+test_decimated_timer (void)
+{
+    struct test_env env;
+    unsigned char frames[sizeof(ack_frame) + sizeof(ping_frame)];
+    lsquic_time_t now = 1000000;
+    const lsquic_time_t rtt = 80000;
+
+    memcpy(frames, ack_frame, sizeof(ack_frame));
+    memcpy(frames + sizeof(ack_frame), ping_frame, sizeof(ping_frame));
+
+    init_env(&env, 20, 1);
+    /* Send CHLO in packet 1 */
+    assert(!tick(&env, now));
+    /* The server ACKs it, establishing RTT */
+    now += rtt;
+    packet_in(&env, 90, frames, sizeof(frames), now);
+    (void) tick(&env, now);
+
+    now += 1000;
+    ping(&env, 91, now);
+    assert(!ack_queued(&env));
+    assert(env.lconn->cn_if->ci_next_tick_time(env.lconn)
+                                                    == now + ACK_TIMEOUT);
+
+    now += 1000;
+    ping(&env, ACK_DECIMATION_MIN_PACKNO, now);
+    assert(!ack_queued(&env));
+    assert(env.lconn->cn_if->ci_next_tick_time(env.lconn) == now + rtt / 4);
+
+    /* When the timer expires, the ACK is sent */
+    now += rtt / 4 + 1;
+    assert(tick(&env, now));
+    assert(!ack_queued(&env));
+
+    cleanup_env(&env);
+
+    /* The decimated delay is capped at ACK_TIMEOUT */
+    init_env(&env, 20, 1);
+    now = 1000000;
+    assert(!tick(&env, now));
+    now += ACK_TIMEOUT * 8;
+    packet_in(&env, ACK_DECIMATION_MIN_PACKNO, frames, sizeof(frames), now);
+    (void) tick(&env, now);
+    now += 1000;
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 1, now);
+    assert(env.lconn->cn_if->ci_next_tick_time(env.lconn)
+                                                    == now + ACK_TIMEOUT);
+    cleanup_env(&env);
+}
+
+
+/* If the last ACK reported missing packets, a packet filling the gap is
+ * ACKed right away, even when decimation is on.
+ */
+static void
+test_reordered (void)
+{
+    struct test_env env;
+    lsquic_time_t now = 1000000;
+
+    init_env(&env, 2, 1);
+    ping(&env, ACK_DECIMATION_MIN_PACKNO, now);
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 2, now);
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 3, now);
+    assert(!ack_queued(&env));
+
+    /* ACK timer expires: the ACK reports packet 101 missing */
+    now += ACK_TIMEOUT + 1;
+    assert(tick(&env, now));
+    assert(!ack_queued(&env));
+
+    now += 1000;
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 4, now);
+    assert(!ack_queued(&env));
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 1, now);
+    assert(ack_queued(&env));
+    assert(tick(&env, now));
+
+    /* The last ACK had no missing packets: out-of-order packet does not
+     * trigger an immediate ACK.
+     */
+    now += 1000;
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 7, now);
+    ping(&env, ACK_DECIMATION_MIN_PACKNO + 6, now);
+    assert(!ack_queued(&env));
+
+    cleanup_env(&env);
+}
+
+
+int
+main (void)
+{
+    /* In debug builds, the encryption session functions can be replaced */
+    lsquic_enc_session_gquic_1.esf_create_client = mock_create_client;
+    lsquic_enc_session_gquic_1.esf_destroy = mock_destroy;
+    lsquic_enc_session_gquic_1.esf_gen_chlo = mock_gen_chlo;
+    lsquic_enc_session_gquic_1.esf_is_zero_rtt_enabled =
+                                                    mock_is_zero_rtt_enabled;
+    lsquic_enc_session_gquic_1.esf_mem_used = mock_mem_used;
+
+    test_ack_freq();
+    test_decimation_threshold();
+    test_decimated_timer();
+    test_reordered();
+
+    return 0;
+}
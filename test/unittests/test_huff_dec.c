@@ -0,0 +1,186 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test the Huffman encoder and the table-driven Huffman decoder against
+ * known vectors and against the reference nibble-at-a-time decoder.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lshpack.h"
+
+
+struct huff_test
+{
+    int                 lineno;
+    const char         *plain;
+    unsigned            enc_len;
+    unsigned char       enc[16];
+};
+
+
+/* RFC 7541, Appendix C.4 */
+static const struct huff_test tests[] =
+{
+    {   .lineno     = __LINE__,
+        .plain      = "www.example.com",
+        .enc_len    = 12,
+        .enc        = { 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0,
+                        0xab, 0x90, 0xf4, 0xff, },
+    },
+
+    {   .lineno     = __LINE__,
+        .plain      = "no-cache",
+        .enc_len    = 6,
+        .enc        = { 0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf, },
+    },
+
+    {   .lineno     = __LINE__,
+        .plain      = "custom-key",
+        .enc_len    = 8,
+        .enc        = { 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xa9, 0x7d, 0x7f, },
+    },
+
+    {   .lineno     = __LINE__,
+        .plain      = "custom-value",
+        .enc_len    = 9,
+        .enc        = { 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xb8, 0xe8, 0xb4,
+                        0xbf, },
+    },
+
+    {   .lineno     = __LINE__,
+        .plain      = "",
+        .enc_len    = 0,
+    },
+};
+
+
+static void
+run_test (const struct huff_test *test)
+{
+    unsigned char buf[0x100];
+    size_t plain_len;
+    int n;
+
+    plain_len = strlen(test->plain);
+
+    n = lshpack_enc_huff_encode((const unsigned char *) test->plain,
+            (const unsigned char *) test->plain + plain_len, buf, sizeof(buf));
+    assert(n == (int) test->enc_len);
+    assert(0 == memcmp(buf, test->enc, test->enc_len));
+
+    n = lshpack_dec_huff_decode(test->enc, test->enc_len, buf, sizeof(buf));
+    assert(n == (int) plain_len);
+    assert(0 == memcmp(buf, test->plain, plain_len));
+
+    /* Output buffer one byte too small */
+    if (plain_len > 0)
+    {
+        n = lshpack_dec_huff_decode(test->enc, test->enc_len, buf,
+                                                            plain_len - 1);
+        assert(-2 == n);
+    }
+}
+
+
+static void
+test_bad_padding (void)
+{
+    /* "no-cache" with a zero bit in the padding */
+    static const unsigned char zero_pad[] = { 0xa8, 0xeb, 0x10, 0x64, 0x9c,
+                                                                    0xbe, };
+    /* "no-cache" followed by a byte of ones: padding is too long */
+    static const unsigned char long_pad[] = { 0xa8, 0xeb, 0x10, 0x64, 0x9c,
+                                                            0xbf, 0xff, };
+    /* EOS: 30 ones */
+    static const unsigned char eos[] = { 0xff, 0xff, 0xff, 0xff, };
+    unsigned char buf[0x100];
+
+    assert(-1 == lshpack_dec_huff_decode(zero_pad, sizeof(zero_pad), buf,
+                                                                sizeof(buf)));
+    assert(-1 == lshpack_dec_huff_decode(long_pad, sizeof(long_pad), buf,
+                                                                sizeof(buf)));
+    assert(-1 == lshpack_dec_huff_decode(eos, sizeof(eos), buf, sizeof(buf)));
+}
+
+
+/* Random strings are encoded and then decoded by both decoders */
+static void
+test_random_strings (void)
+{
+    unsigned char plain[300], enc[sizeof(plain) * 4 + 1],
+                  out_fast[sizeof(plain)], out_ref[sizeof(plain)];
+    unsigned i, j, len;
+    int n_enc, n_fast, n_ref;
+
+    for (i = 0; i < 20000; ++i)
+    {
+        len = rand() % sizeof(plain);
+        for (j = 0; j < len; ++j)
+            if (i & 1)
+                plain[j] = 0x20 + rand() % 0x5F;    /* Printable */
+            else
+                plain[j] = rand();
+        n_enc = lshpack_enc_huff_encode(plain, plain + len, enc, sizeof(enc));
+        assert(n_enc >= 0);
+        assert(lshpack_enc_huff_len(plain, plain + len) == (unsigned) n_enc);
+        if (n_enc > 0)
+            assert(-1 == lshpack_enc_huff_encode(plain, plain + len, enc,
+                                                                n_enc - 1));
+        n_fast = lshpack_dec_huff_decode(enc, n_enc, out_fast,
+                                                            sizeof(out_fast));
+        n_ref = lshpack_dec_huff_decode_nibbles(enc, n_enc, out_ref,
+                                                            sizeof(out_ref));
+        assert(n_fast == (int) len);
+        assert(n_ref == (int) len);
+        assert(0 == memcmp(out_fast, plain, len));
+        assert(0 == memcmp(out_ref, plain, len));
+    }
+}
+
+
+/* Random input is likely to be invalid: both decoders should agree */
+static void
+test_random_input (void)
+{
+    unsigned char in[40], out_fast[sizeof(in) * 2], out_ref[sizeof(in) * 2];
+    unsigned i, j, len;
+    int n_fast, n_ref;
+
+    for (i = 0; i < 200000; ++i)
+    {
+        len = rand() % sizeof(in);
+        for (j = 0; j < len; ++j)
+            /* Bias towards ones to hit long codes and padding */
+            in[j] = rand() | (i & 1 ? rand() : 0);
+        n_fast = lshpack_dec_huff_decode(in, len, out_fast, sizeof(out_fast));
+        n_ref = lshpack_dec_huff_decode_nibbles(in, len, out_ref,
+                                                            sizeof(out_ref));
+        assert((n_fast < 0) == (n_ref < 0));
+        if (n_fast >= 0)
+        {
+            assert(n_fast == n_ref);
+            assert(0 == memcmp(out_fast, out_ref, n_fast));
+        }
+    }
+}
+
+
+int
+main (void)
+{
+    const struct huff_test *test;
+
+    for (test = tests; test < tests + sizeof(tests) / sizeof(tests[0]); ++test)
+        run_test(test);
+
+    test_bad_padding();
+
+    srand(0x1234);
+    test_random_strings();
+    test_random_input();
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_pacer.h"
+
+
+#define TX_TIME 1000    /* One packet per millisecond */
+
+static lsquic_time_t
+tx_time (void *ctx)
+{
+    return TX_TIME;
+}
+
+
+/* Use up initial burst tokens */
+static void
+use_up_tokens (struct pacer *pacer)
+{
+    lsquic_time_t txtime;
+
+    while (pacer->pa_burst_tokens > 0)
+    {
+        assert(pacer_can_schedule(pacer, 1));
+        txtime = pacer_packet_scheduled(pacer, 1, 0, tx_time, NULL);
+        assert(0 == txtime);
+    }
+}
+
+
+/* Without horizon, a packet can be scheduled if it is due within clock
+ * granularity.
+ */
+static void
+test_no_horizon (void)
+{
+    struct pacer pacer;
+    const lsquic_time_t now = 1000000;
+    lsquic_time_t txtime;
+
+    pacer_init(&pacer, 0, 1000, 0);
+    pacer_tick(&pacer, now);
+    use_up_tokens(&pacer);
+
+    assert(pacer_can_schedule(&pacer, 1));
+    txtime = pacer_packet_scheduled(&pacer, 1, 0, tx_time, NULL);
+    assert(0 == txtime);
+
+    assert(pacer_can_schedule(&pacer, 1));
+    txtime = pacer_packet_scheduled(&pacer, 1, 0, tx_time, NULL);
+    assert(now + TX_TIME == txtime);
+
+    assert(!pacer_can_schedule(&pacer, 1));
+    assert(pacer_delayed(&pacer));
+    assert(now + 2 * TX_TIME == pacer_next_sched(&pacer));
+
+    pacer_cleanup(&pacer);
+}
+
+
+/* With horizon, packets are released ahead of time, each with its own
+ * departure time.
+ */
+static void
+test_horizon (void)
+{
+    struct pacer pacer;
+    const lsquic_time_t now = 1000000, horizon = 10 * TX_TIME;
+    lsquic_time_t txtime;
+    unsigned n;
+
+    pacer_init(&pacer, 0, 1000, horizon);
+    pacer_tick(&pacer, now);
+    use_up_tokens(&pacer);
+
+    for (n = 0; pacer_can_schedule(&pacer, 1); ++n)
+    {
+        txtime = pacer_packet_scheduled(&pacer, 1, 0, tx_time, NULL);
+        if (n == 0)
+            assert(0 == txtime);
+        else
+            assert(now + n * TX_TIME == txtime);
+    }
+    assert(11 == n);
+    assert(pacer_delayed(&pacer));
+    /* Next packet is due in 11 ms: it can be scheduled in 1 ms */
+    assert(now + TX_TIME == pacer_next_sched(&pacer));
+
+    /* The pacer keeps the schedule when it is woken up */
+    pacer_tick(&pacer, now + TX_TIME);
+    assert(pacer_can_schedule(&pacer, 1));
+    txtime = pacer_packet_scheduled(&pacer, 1, 0, tx_time, NULL);
+    assert(now + 11 * TX_TIME == txtime);
+
+    pacer_cleanup(&pacer);
+}
+
+
+int
+main (void)
+{
+    test_no_horizon();
+    test_horizon();
+    return 0;
+}
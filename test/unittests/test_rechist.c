@@ -21,7 +21,7 @@ test4 (void)
     const struct lsquic_packno_range *range;
     lsquic_packno_t packno;
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     for (packno = 11917; packno <= 11941; ++packno)
         lsquic_rechist_received(&rechist, packno, 0);
@@ -122,7 +122,7 @@ test5 (void)
     lsquic_rechist_t rechist;
     char buf[100];
 
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     lsquic_rechist_received(&rechist, 1, 0);
     /* Packet 2 omitted because it could not be decrypted */
@@ -164,6 +164,61 @@ test5 (void)
 }
 
 
+/* When the number of ranges reaches the limit, the oldest range is dropped
+ * and packets in it are treated as duplicates.
+ */
+static void
+test_max_ranges (void)
+{
+    lsquic_rechist_t rechist;
+    enum received_st st;
+    char buf[100];
+
+    lsquic_rechist_init(&rechist, 0, 3);
+
+    lsquic_rechist_received(&rechist, 1, 0);
+    lsquic_rechist_received(&rechist, 4, 0);
+    lsquic_rechist_received(&rechist, 7, 0);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[7-7][4-4][1-1]"));
+
+    /* Growing existing ranges does not need more room */
+    st = lsquic_rechist_received(&rechist, 5, 0);
+    assert(REC_ST_OK == st);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[7-7][5-4][1-1]"));
+
+    lsquic_rechist_received(&rechist, 10, 0);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[10-10][7-7][5-4]"));
+    assert(1 == rechist.rh_max_dropped);
+
+    st = lsquic_rechist_received(&rechist, 1, 0);
+    assert(REC_ST_DUP == st);
+    /* Packet 2 is older than anything tracked: there is no room for it */
+    st = lsquic_rechist_received(&rechist, 2, 0);
+    assert(REC_ST_DUP == st);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[10-10][7-7][5-4]"));
+
+    /* Filling the gap frees up room */
+    st = lsquic_rechist_received(&rechist, 6, 0);
+    assert(REC_ST_OK == st);
+    st = lsquic_rechist_received(&rechist, 2, 0);
+    assert(REC_ST_OK == st);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[10-10][7-4][2-2]"));
+    assert(3 == rechist.rh_n_alloced);
+
+    lsquic_rechist_stop_wait(&rechist, 5);
+    rechist2str(&rechist, buf, sizeof(buf));
+    assert(0 == strcmp(buf, "[10-10][7-5]"));
+    assert(10 == lsquic_rechist_largest_packno(&rechist));
+
+    lsquic_rechist_cleanup(&rechist);
+}
+
+
 int
 main (void)
 {
@@ -178,7 +233,7 @@ main (void)
     lsq_log_levels[LSQLM_PARSE]   = LSQ_LOG_DEBUG;
     lsq_log_levels[LSQLM_RECHIST] = LSQ_LOG_DEBUG;
     
-    lsquic_rechist_init(&rechist, 0);
+    lsquic_rechist_init(&rechist, 0, 0);
 
     lsquic_time_t now = lsquic_time_now();
     st = lsquic_rechist_received(&rechist, 0, now);
@@ -251,5 +306,7 @@ main (void)
 
     test5();
 
+    test_max_ranges();
+
     return 0;
 }
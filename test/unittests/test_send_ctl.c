@@ -0,0 +1,813 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test ACK processing in the send controller.
+ *
+ * With -b, also time processing of ACKs with 10,000 packets in flight.
+ * Three patterns are timed: ACK frames with the maximum number of ranges,
+ * ACK frames with a single range that the peer keeps repeating, and ACK
+ * frames whose ranges have many unacked packets between them.
+ */
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+
+#include "lsquic_alarmset.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_parse.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_rtt.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_types.h"
+#include "lsquic_malo.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_logger.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cong_ctl.h"
+#include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
+#include "lsquic_pacer.h"
+#include "lsquic_senhist.h"
+#include "lsquic_send_ctl.h"
+#include "lsquic_ver_neg.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_util.h"
+
+
+struct test_objs {
+    struct lsquic_engine_public eng_pub;
+    struct lsquic_conn        lconn;
+    struct lsquic_conn_public conn_pub;
+    struct lsquic_send_ctl    send_ctl;
+    struct lsquic_alarmset    alset;
+    struct ver_neg            ver_neg;
+};
+
+
+static void
+init_test_objs (struct test_objs *tobjs, unsigned cc_algo,
+                        const struct lsquic_cong_ctl_if *cc_if, void *cc_ctx)
+{
+    memset(tobjs, 0, sizeof(*tobjs));
+    tobjs->eng_pub.enp_cc_if = cc_if;
+    tobjs->eng_pub.enp_cc_ctx = cc_ctx;
+    tobjs->eng_pub.enp_settings.es_cc_algo = cc_algo;
+    tobjs->lconn.cn_pf = select_pf_by_ver(LSQVER_039);
+    tobjs->lconn.cn_version = LSQVER_039;
+    tobjs->lconn.cn_pack_size = 1370;
+    tobjs->lconn.cn_flags = LSCONN_HANDSHAKE_DONE;
+    lsquic_mm_init(&tobjs->eng_pub.enp_mm);
+    lsquic_alarmset_init(&tobjs->alset, 0);
+    tobjs->conn_pub.mm = &tobjs->eng_pub.enp_mm;
+    tobjs->conn_pub.lconn = &tobjs->lconn;
+    tobjs->conn_pub.enpub = &tobjs->eng_pub;
+    tobjs->conn_pub.send_ctl = &tobjs->send_ctl;
+    tobjs->conn_pub.packet_out_malo =
+                        lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    lsquic_send_ctl_init(&tobjs->send_ctl, &tobjs->alset, &tobjs->eng_pub,
+        &tobjs->ver_neg, &tobjs->conn_pub, tobjs->lconn.cn_pack_size);
+}
+
+
+static void
+deinit_test_objs (struct test_objs *tobjs)
+{
+    lsquic_send_ctl_cleanup(&tobjs->send_ctl);
+    lsquic_malo_destroy(tobjs->conn_pub.packet_out_malo);
+    lsquic_mm_cleanup(&tobjs->eng_pub.enp_mm);
+}
+
+
+static void
+send_packets (struct test_objs *tobjs, unsigned count, lsquic_time_t now)
+{
+    struct lsquic_packet_out *packet_out;
+    int s;
+
+    while (count--)
+    {
+        packet_out = lsquic_send_ctl_new_packet_out(&tobjs->send_ctl, 0);
+        assert(packet_out);
+        packet_out->po_data_sz = 100;
+        /* No stream records are added: the frame type is there just to
+         * make the packet retransmittable.
+         */
+        packet_out->po_frame_types = 1 << QUIC_FRAME_STREAM;
+        packet_out->po_sent = now;
+        s = lsquic_send_ctl_sent_packet(&tobjs->send_ctl, packet_out, 0);
+        assert(0 == s);
+    }
+}
+
+
+static int
+in_ack (const struct ack_info *acki, lsquic_packno_t packno)
+{
+    unsigned n;
+
+    for (n = 0; n < acki->n_ranges; ++n)
+        if (acki->ranges[n].low <= packno && packno <= acki->ranges[n].high)
+            return 1;
+
+    return 0;
+}
+
+
+static void
+verify_unacked (const struct lsquic_send_ctl *ctl, const struct ack_info *acki)
+{
+    const struct lsquic_packet_out *packet_out;
+    lsquic_packno_t prev = 0;
+    unsigned count = 0;
+
+    TAILQ_FOREACH(packet_out, &ctl->sc_unacked_packets, po_next)
+    {
+        assert(packet_out->po_packno > prev);
+        prev = packet_out->po_packno;
+        assert(!in_ack(acki, packet_out->po_packno));
+        assert(ctl->sc_unacked_ring[ packet_out->po_packno
+                            & (ctl->sc_unacked_ring_sz - 1) ] == packet_out);
+        ++count;
+    }
+    assert(count == ctl->sc_n_in_flight_all);
+}
+
+
+/* Packet numbers in the ACK frame are chosen randomly from the packets that
+ * are in flight.  Packets that are acked must be removed from the unacked
+ * queue, and the rest must remain (unless they are declared lost).
+ */
+static void
+test_random_acks (unsigned cc_algo)
+{
+    struct test_objs tobjs;
+    struct ack_info acki;
+    lsquic_packno_t high, low;
+    unsigned round, n;
+    int s;
+
+    srand(0);
+    init_test_objs(&tobjs, cc_algo, NULL, NULL);
+
+    for (round = 0; round < 20; ++round)
+    {
+        send_packets(&tobjs, 10000, 1000000 + round);
+        high = lsquic_senhist_largest(&tobjs.send_ctl.sc_senhist);
+        memset(&acki, 0, sizeof(acki));
+        for (n = 0; n < 256; ++n)
+        {
+            low = high > 30 ? high - rand() % 30 : 1;
+            acki.ranges[n].high = high;
+            acki.ranges[n].low = low;
+            if (low < 12)
+            {
+                ++n;
+                break;
+            }
+            high = low - 2 - rand() % 10;
+        }
+        acki.n_ranges = n;
+        s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 1000000 + round);
+        assert(0 == s);
+        verify_unacked(&tobjs.send_ctl, &acki);
+    }
+
+    /* Ack everything */
+    memset(&acki, 0, sizeof(acki));
+    acki.n_ranges = 1;
+    acki.ranges[0].low = 1;
+    acki.ranges[0].high = lsquic_senhist_largest(&tobjs.send_ctl.sc_senhist);
+    s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 2000000);
+    assert(0 == s);
+    assert(TAILQ_EMPTY(&tobjs.send_ctl.sc_unacked_packets));
+    assert(0 == tobjs.send_ctl.sc_n_in_flight_all);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+struct test_cc
+{
+    lsquic_conn_t      *conn;
+    unsigned long       cwnd;
+    unsigned            n_sent, n_acked, n_lost, n_ack_frames, n_undos;
+    int                 in_ack;
+    int                 destroyed;
+};
+
+
+static void *
+test_cc_create (void *cc_ctx, lsquic_conn_t *conn)
+{
+    struct test_cc *const cc = cc_ctx;
+
+    if (!cc)
+        return NULL;
+    cc->conn = conn;
+    return cc;
+}
+
+
+static void
+test_cc_sent (void *cc_p, uint64_t packno, unsigned packet_sz, uint64_t now,
+                                    unsigned bytes_in_flight, int app_limited)
+{
+    struct test_cc *const cc = cc_p;
+    ++cc->n_sent;
+}
+
+
+static void
+test_cc_begin_ack (void *cc_p, uint64_t ack_time, unsigned bytes_in_flight)
+{
+    struct test_cc *const cc = cc_p;
+    assert(!cc->in_ack);
+    cc->in_ack = 1;
+}
+
+
+static void
+test_cc_ack (void *cc_p, uint64_t packno, unsigned packet_sz, uint64_t sent,
+                                                uint64_t now, int app_limited)
+{
+    struct test_cc *const cc = cc_p;
+    assert(cc->in_ack);
+    ++cc->n_acked;
+}
+
+
+static void
+test_cc_end_ack (void *cc_p, unsigned bytes_in_flight)
+{
+    struct test_cc *const cc = cc_p;
+    assert(cc->in_ack);
+    cc->in_ack = 0;
+    ++cc->n_ack_frames;
+}
+
+
+static void
+test_cc_lost (void *cc_p, uint64_t packno, unsigned packet_sz)
+{
+    struct test_cc *const cc = cc_p;
+    ++cc->n_lost;
+}
+
+
+static void
+test_cc_noop (void *cc_p)
+{
+}
+
+
+static void
+test_cc_undo (void *cc_p)
+{
+    struct test_cc *const cc = cc_p;
+    ++cc->n_undos;
+}
+
+
+static void
+test_cc_was_quiet (void *cc_p, uint64_t now)
+{
+}
+
+
+static unsigned long
+test_cc_get_cwnd (void *cc_p)
+{
+    struct test_cc *const cc = cc_p;
+    return cc->cwnd;
+}
+
+
+static uint64_t
+test_cc_pacing_rate (void *cc_p, int in_recovery)
+{
+    return 1000000;
+}
+
+
+static void
+test_cc_destroy (void *cc_p)
+{
+    struct test_cc *const cc = cc_p;
+    cc->destroyed = 1;
+}
+
+
+static const struct lsquic_cong_ctl_if test_cc_if =
+{
+    .cci_create      = test_cc_create,
+    .cci_sent        = test_cc_sent,
+    .cci_begin_ack   = test_cc_begin_ack,
+    .cci_ack         = test_cc_ack,
+    .cci_end_ack     = test_cc_end_ack,
+    .cci_lost        = test_cc_lost,
+    .cci_loss        = test_cc_noop,
+    .cci_timeout     = test_cc_noop,
+    .cci_was_quiet   = test_cc_was_quiet,
+    .cci_get_cwnd    = test_cc_get_cwnd,
+    .cci_pacing_rate = test_cc_pacing_rate,
+    .cci_destroy     = test_cc_destroy,
+    .cci_undo        = test_cc_undo,
+};
+
+
+/* User-supplied congestion controller is driven by the send controller */
+static void
+test_user_cc (void)
+{
+    struct test_objs tobjs;
+    struct test_cc cc;
+    struct ack_info acki;
+    int s;
+
+    memset(&cc, 0, sizeof(cc));
+    cc.cwnd = 10 * 100;
+    init_test_objs(&tobjs, 1, &test_cc_if, &cc);
+    assert(cc.conn == &tobjs.lconn);
+
+    assert(lsquic_send_ctl_can_send(&tobjs.send_ctl));
+    send_packets(&tobjs, 10, 1000000);
+    assert(10 == cc.n_sent);
+    assert(!lsquic_send_ctl_can_send(&tobjs.send_ctl));
+
+    memset(&acki, 0, sizeof(acki));
+    acki.n_ranges = 1;
+    acki.ranges[0].low = 6;
+    acki.ranges[0].high = 10;
+    s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 1100000);
+    assert(0 == s);
+    assert(1 == cc.n_ack_frames);
+    assert(5 == cc.n_acked);
+    assert(5 == cc.n_lost);    /* Packets 1 through 5 are lost by FACK */
+    assert(lsquic_send_ctl_can_send(&tobjs.send_ctl));
+
+    deinit_test_objs(&tobjs);
+    assert(cc.destroyed);
+
+    /* If the controller cannot be created, built-in one is used */
+    init_test_objs(&tobjs, 1, &test_cc_if, NULL);
+    assert(tobjs.send_ctl.sc_ci == &lsquic_cong_cubic_if);
+    deinit_test_objs(&tobjs);
+}
+
+
+static void
+ack_range (struct test_objs *tobjs, lsquic_packno_t low, lsquic_packno_t high,
+                                                    lsquic_time_t recv_time)
+{
+    struct ack_info acki;
+    int s;
+
+    memset(&acki, 0, sizeof(acki));
+    acki.n_ranges = 1;
+    acki.ranges[0].low = low;
+    acki.ranges[0].high = high;
+    s = lsquic_send_ctl_got_ack(&tobjs->send_ctl, &acki, recv_time);
+    assert(0 == s);
+}
+
+
+/* Once a spurious loss is detected, FACK is no longer used and packets are
+ * declared lost only after RTT plus the reordering window.
+ */
+static void
+test_rack (void)
+{
+    struct test_objs tobjs;
+    struct lsquic_send_ctl *const ctl = &tobjs.send_ctl;
+    struct test_cc cc;
+    unsigned i;
+
+    memset(&cc, 0, sizeof(cc));
+    cc.cwnd = 100 * 100;
+    init_test_objs(&tobjs, 1, &test_cc_if, &cc);
+    assert(1 == ctl->sc_rack.reo_wnd_mult);
+
+    for (i = 0; i < 10; ++i)
+        send_packets(&tobjs, 1, 1000000 + i * 1000);
+
+    /* Packet 1 is lost by FACK */
+    ack_range(&tobjs, 2, 10, 1100000);
+    assert(1 == cc.n_lost);
+    assert(10 == ctl->sc_rack.packno);
+    assert(91000 == ctl->sc_rack.rtt);
+    assert(1 == ctl->sc_n_lost_recs);
+    assert(!ctl->sc_rack.reordering_seen);
+
+    /* ...but it was merely delayed */
+    ack_range(&tobjs, 1, 10, 1101000);
+    assert(0 == ctl->sc_n_lost_recs);
+    assert(ctl->sc_rack.reordering_seen);
+    assert(2 == ctl->sc_rack.reo_wnd_mult);
+    assert(1 == cc.n_undos);
+#if LSQUIC_SEND_STATS
+    assert(1 == ctl->sc_stats.n_spurious);
+#endif
+
+    for (i = 0; i < 5; ++i)
+        send_packets(&tobjs, 1, 1200000 + i * 1000);
+
+    /* RTT is 46 ms, loss delay is 46 + 46 * 2 / 8 = 57.5 ms: packet 11 is
+     * not lost yet, even though four packets after it have been acked.
+     */
+    ack_range(&tobjs, 12, 15, 1250000);
+    assert(1 == cc.n_lost);
+    assert(7500 == ctl->sc_loss_to);
+
+    ack_range(&tobjs, 12, 15, 1260000);
+    assert(2 == cc.n_lost);
+    assert(0 == ctl->sc_loss_to);
+    assert(15 == ctl->sc_rack.reo_wnd_persist);  /* One fewer loss event to go */
+    assert(1 == cc.n_undos);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+/* When all packets lost in a loss event are acked later, CUBIC's cwnd and
+ * ssthresh are restored.  If one of them is never acked, they are not.
+ */
+static void
+test_cwnd_undo (void)
+{
+    struct test_objs tobjs;
+    struct lsquic_send_ctl *const ctl = &tobjs.send_ctl;
+    struct lsquic_cubic *const cubic = &ctl->sc_cong_u.cubic;
+    unsigned long cwnd, ssthresh;
+    unsigned i;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    ssthresh = cubic->cu_ssthresh;
+
+    for (i = 0; i < 10; ++i)
+        send_packets(&tobjs, 1, 1000000 + i * 1000);
+    ack_range(&tobjs, 2, 10, 1100000);
+    assert(cubic->cu_cwnd < cubic->cu_prior_cwnd);
+    assert(cubic->cu_ssthresh < ssthresh);
+    cwnd = cubic->cu_prior_cwnd;
+
+    ack_range(&tobjs, 1, 10, 1101000);
+    assert(cubic->cu_cwnd == cwnd);
+    assert(cubic->cu_ssthresh == ssthresh);
+    assert(0 == ctl->sc_largest_sent_at_cutback);
+    assert(!(ctl->sc_loss_epoch.flags & LE_CAN_UNDO));
+
+    /* Reordering has been seen, so packet 11 is lost by RACK */
+    for (i = 0; i < 10; ++i)
+        send_packets(&tobjs, 1, 1200000 + i * 1000);
+    ack_range(&tobjs, 12, 20, 1400000);
+    assert(cubic->cu_cwnd < cwnd);
+    cwnd = cubic->cu_cwnd;
+    assert(ctl->sc_loss_epoch.flags & LE_CAN_UNDO);
+    assert(1 == ctl->sc_loss_epoch.n_lost);
+
+    /* The peer stops reporting packet 11: loss was real */
+    send_packets(&tobjs, 1, 1400000);
+    ack_range(&tobjs, 12, 21, 1450000);
+    assert(!(ctl->sc_loss_epoch.flags & LE_CAN_UNDO));
+    assert(0 == ctl->sc_n_lost_recs);
+    assert(cubic->cu_cwnd >= cwnd && cubic->cu_cwnd < cubic->cu_prior_cwnd);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+/* Send packets for as long as the send controller allows */
+static unsigned
+send_while_can (struct test_objs *tobjs, lsquic_time_t now)
+{
+    unsigned n;
+
+    for (n = 0; lsquic_send_ctl_can_send(&tobjs->send_ctl); ++n)
+        send_packets(tobjs, 1, now);
+    return n;
+}
+
+
+/* After CUBIC cuts cwnd, PRR lets the sender go on sending in proportion
+ * to bytes delivered instead of stopping until bytes in flight drop below
+ * the new cwnd.
+ */
+static void
+test_prr (void)
+{
+    struct test_objs tobjs;
+    struct lsquic_send_ctl *const ctl = &tobjs.send_ctl;
+    unsigned n_in_flight, n, bytes_in_flight, ssthresh;
+    uint64_t limit;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    assert(ctl->sc_flags & SC_PRR);
+
+    n_in_flight = send_while_can(&tobjs, 1000000);
+    assert(n_in_flight > 100);
+    bytes_in_flight = ctl->sc_bytes_unacked_all;
+
+    /* Packet 1 is lost: */
+    ack_range(&tobjs, 2, 5, 1100000);
+    assert(ctl->sc_prr.recover_fs);
+    assert(ctl->sc_prr.recover_fs + ctl->sc_prr.delivered == bytes_in_flight);
+    ssthresh = ctl->sc_prr.ssthresh;
+    assert(ssthresh == ctl->sc_ci->cci_get_cwnd(&ctl->sc_cong_u));
+    assert(ctl->sc_bytes_unacked_all > ssthresh);
+
+    /* Without PRR, nothing could be sent until bytes in flight dropped
+     * below cwnd.
+     */
+    n = send_while_can(&tobjs, 1100000);
+    assert(n > 0 && n < 5);
+    limit = ((uint64_t) ctl->sc_prr.delivered * ssthresh
+                    + ctl->sc_prr.recover_fs - 1) / ctl->sc_prr.recover_fs;
+    assert(ctl->sc_prr.out >= limit);
+    assert(ctl->sc_prr.out < limit + 200);
+
+    /* Another ACK, more packets */
+    ack_range(&tobjs, 2, 15, 1101000);
+    n = send_while_can(&tobjs, 1101000);
+    assert(n > 0 && n < 10);
+
+    /* Once bytes in flight drop below ssthresh, PRR-SSRB lets them grow
+     * back up to it:
+     */
+    ack_range(&tobjs, 2, n_in_flight, 1102000);
+    assert(ctl->sc_bytes_unacked_all < ssthresh);
+    assert(ctl->sc_prr.recover_fs);
+    n = send_while_can(&tobjs, 1102000);
+    assert(n > 0);
+    assert(ctl->sc_bytes_unacked_all >= ssthresh);
+    assert(ctl->sc_bytes_unacked_all < ssthresh + ctl->sc_pack_size);
+
+    /* Packet sent after the cutback is acked: recovery is over */
+    ack_range(&tobjs, 2, n_in_flight + 1, 1200000);
+    assert(0 == ctl->sc_prr.recover_fs);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+/* Once reordering has been seen, a packet that is not acked is not declared
+ * lost right away and the peer keeps acking everything above it.  The
+ * repeated parts of the ranges are skipped, but packets acked for the
+ * first time, wherever they are, are still processed.
+ */
+static void
+test_repeated_ranges (void)
+{
+    struct test_objs tobjs;
+    struct lsquic_send_ctl *const ctl = &tobjs.send_ctl;
+    struct ack_info acki;
+    int s;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    ctl->sc_rack.reordering_seen = 1;
+    send_packets(&tobjs, 30, 1000000);
+
+    ack_range(&tobjs, 2, 10, 1000100);
+    assert(21 == ctl->sc_n_in_flight_all);
+    ack_range(&tobjs, 2, 15, 1000200);
+    assert(16 == ctl->sc_n_in_flight_all);
+    assert(1 == TAILQ_FIRST(&ctl->sc_unacked_packets)->po_packno);
+    assert(16 == TAILQ_NEXT(TAILQ_FIRST(&ctl->sc_unacked_packets),
+                                                        po_next)->po_packno);
+
+    /* Packets 25 and 26 are acked first, then the gap is filled in */
+    memset(&acki, 0, sizeof(acki));
+    acki.n_ranges = 2;
+    acki.ranges[0].low = 25;
+    acki.ranges[0].high = 26;
+    acki.ranges[1].low = 2;
+    acki.ranges[1].high = 18;
+    s = lsquic_send_ctl_got_ack(ctl, &acki, 1000300);
+    assert(0 == s);
+    verify_unacked(ctl, &acki);
+    assert(11 == ctl->sc_n_in_flight_all);
+
+    /* An older ACK frame arriving late does not change anything */
+    ack_range(&tobjs, 2, 12, 1000400);
+    assert(11 == ctl->sc_n_in_flight_all);
+
+    ack_range(&tobjs, 1, 30, 1000500);
+    verify_unacked(ctl, &acki);
+    assert(0 == ctl->sc_n_in_flight_all);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+/* The unacked ring grows when many packets are in flight and shrinks once
+ * they have been acked.
+ */
+static void
+test_ring_shrink (void)
+{
+    struct test_objs tobjs;
+    struct lsquic_send_ctl *const ctl = &tobjs.send_ctl;
+    struct ack_info acki;
+    lsquic_packno_t largest;
+    unsigned ring_sz;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    send_packets(&tobjs, 5000, 1000000);
+    ring_sz = ctl->sc_unacked_ring_sz;
+    assert(ring_sz > 5000);
+
+    largest = lsquic_senhist_largest(&ctl->sc_senhist);
+    ack_range(&tobjs, 1, largest - 2000, 1100000);
+    assert(ctl->sc_unacked_ring_sz == ring_sz);   /* Not small enough yet */
+    ack_range(&tobjs, 1, largest - 10, 1100000);
+    assert(ctl->sc_unacked_ring_sz < ring_sz);
+    assert(ctl->sc_unacked_ring_sz > 20);
+    send_packets(&tobjs, 100, 1100000);
+    ack_range(&tobjs, 1, largest - 5, 1200000);
+    memset(&acki, 0, sizeof(acki));
+    verify_unacked(ctl, &acki);
+    assert(105 == ctl->sc_n_in_flight_all);
+
+    ack_range(&tobjs, 1, lsquic_senhist_largest(&ctl->sc_senhist), 1300000);
+    assert(0 == ctl->sc_n_in_flight_all);
+    assert(ctl->sc_unacked_ring_sz <= 64);
+
+    deinit_test_objs(&tobjs);
+}
+
+
+/* Keep `n_in_flight' packets in flight.  Each ACK frame acks the next
+ * `per_ack' packets; older packets are acked, too, but with holes in them,
+ * so that the frame has the maximum number of ranges.
+ */
+static void
+bench_acks (unsigned n_in_flight, unsigned per_ack, unsigned n_acks)
+{
+    struct test_objs tobjs;
+    struct ack_info acki;
+    lsquic_packno_t largest;
+    lsquic_time_t start, end;
+    unsigned i, n;
+    int s;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    send_packets(&tobjs, n_in_flight, 1000000);
+
+    largest = 0;
+    start = lsquic_time_now();
+    for (i = 0; i < n_acks; ++i)
+    {
+        largest += per_ack;
+        memset(&acki, 0, sizeof(acki));
+        acki.ranges[0].high = largest;
+        acki.ranges[0].low  = largest - per_ack + 1;
+        for (n = 1; n < 256 && acki.ranges[n - 1].low > 3; ++n)
+        {
+            acki.ranges[n].high = acki.ranges[n - 1].low - 2;
+            acki.ranges[n].low  = acki.ranges[n].high;
+        }
+        acki.n_ranges = n;
+        s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 1000000);
+        assert(0 == s);
+        send_packets(&tobjs, per_ack, 1000000);
+    }
+    end = lsquic_time_now();
+
+    printf("in flight: %u; acks: %u; packets per ack: %u; time: %"PRIu64
+                " usec\n", n_in_flight, n_acks, per_ack, end - start);
+    deinit_test_objs(&tobjs);
+}
+
+
+/* The first packet is never acked.  Since reordering has been seen, it is
+ * not declared lost, either, and each ACK frame consists of a single range
+ * that covers all other packets: only the last `per_ack' packets in it
+ * have not been acked before.
+ */
+static void
+bench_repeated_range (unsigned n_in_flight, unsigned per_ack, unsigned n_acks)
+{
+    struct test_objs tobjs;
+    struct ack_info acki;
+    lsquic_time_t start, end;
+    unsigned i;
+    int s;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    tobjs.send_ctl.sc_rack.reordering_seen = 1;
+    send_packets(&tobjs, n_in_flight, 1000000);
+
+    memset(&acki, 0, sizeof(acki));
+    acki.n_ranges = 1;
+    acki.ranges[0].low = 2;
+    acki.ranges[0].high = 1;
+    start = lsquic_time_now();
+    for (i = 0; i < n_acks; ++i)
+    {
+        acki.ranges[0].high += per_ack;
+        s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 1000000);
+        assert(0 == s);
+        send_packets(&tobjs, per_ack, 1000000);
+    }
+    end = lsquic_time_now();
+
+    printf("repeated range; in flight: %u; acks: %u; packets per ack: %u; "
+        "time: %"PRIu64" usec\n", n_in_flight, n_acks, per_ack, end - start);
+    deinit_test_objs(&tobjs);
+}
+
+
+/* Every tenth packet reaches the peer right away, while the others are
+ * delayed by `delay' packets.  Each ACK frame consists of one range that
+ * covers everything up to the delayed packets and single-packet ranges for
+ * the packets that arrived early.  The delayed packets between the ranges
+ * stay in flight: they are not declared lost, since reordering has been
+ * seen.
+ */
+static void
+bench_sparse_ranges (unsigned delay, unsigned n_acks)
+{
+    struct test_objs tobjs;
+    struct ack_info acki;
+    lsquic_packno_t largest;
+    lsquic_time_t start, end;
+    unsigned i, n;
+    int s;
+
+    init_test_objs(&tobjs, 1, NULL, NULL);
+    tobjs.send_ctl.sc_rack.reordering_seen = 1;
+    send_packets(&tobjs, delay + 10, 1000000);
+
+    largest = delay;
+    start = lsquic_time_now();
+    for (i = 0; i < n_acks; ++i)
+    {
+        largest += 10;
+        memset(&acki, 0, sizeof(acki));
+        for (n = 0; n < delay / 10; ++n)
+            acki.ranges[n].low = acki.ranges[n].high = largest - n * 10;
+        acki.ranges[n].low = 1;
+        acki.ranges[n].high = largest - delay;
+        acki.n_ranges = n + 1;
+        s = lsquic_send_ctl_got_ack(&tobjs.send_ctl, &acki, 1000000);
+        assert(0 == s);
+        send_packets(&tobjs, 10, 1000000);
+    }
+    end = lsquic_time_now();
+
+    printf("sparse ranges; in flight: %u; acks: %u; ranges per ack: %u; "
+        "time: %"PRIu64" usec\n", tobjs.send_ctl.sc_n_in_flight_all, n_acks,
+        acki.n_ranges, end - start);
+    deinit_test_objs(&tobjs);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt, bench = 0;
+
+    while (-1 != (opt = getopt(argc, argv, "bl:")))
+    {
+        switch (opt)
+        {
+        case 'b':
+            bench = 1;
+            break;
+        case 'l':
+            lsquic_log_to_fstream(stderr, 0);
+            lsquic_logger_lopt(optarg);
+            break;
+        default:
+            exit(1);
+        }
+    }
+
+    test_random_acks(1);
+    test_random_acks(2);
+    test_user_cc();
+    test_rack();
+    test_cwnd_undo();
+    test_prr();
+    test_repeated_ranges();
+    test_ring_shrink();
+    if (bench)
+    {
+        bench_acks(10000, 10, 100000);
+        bench_repeated_range(10000, 10, 10000);
+        bench_sparse_ranges(2000, 100000);
+    }
+
+    return 0;
+}
@@ -31,7 +31,9 @@
 #include "lsquic_parse.h"
 #include "lsquic_conn.h"
 #include "lsquic_engine_public.h"
+#include "lsquic_cong_ctl.h"
 #include "lsquic_cubic.h"
+#include "lsquic_bbr.h"
 #include "lsquic_pacer.h"
 #include "lsquic_senhist.h"
 #include "lsquic_send_ctl.h"
@@ -1450,6 +1452,113 @@ test_read_in_middle (void)
 }
 
 
+struct readf_ctx
+{
+    const unsigned char    *bufs[4];
+    unsigned char           copies[4][16];  /* `bufs' are only valid in
+                                             * the callback
+                                             */
+    size_t                  lens[4];
+    int                     fins[4];
+    unsigned                n_calls;
+    size_t                  max_consume;
+};
+
+
+static size_t
+readf_cb (void *ctx_p, const unsigned char *buf, size_t len, int fin)
+{
+    struct readf_ctx *const ctx = ctx_p;
+
+    assert(ctx->n_calls < sizeof(ctx->bufs) / sizeof(ctx->bufs[0]));
+    ctx->bufs[ctx->n_calls] = buf;
+    memcpy(ctx->copies[ctx->n_calls], buf,
+                len < sizeof(ctx->copies[0]) ? len : sizeof(ctx->copies[0]));
+    ctx->lens[ctx->n_calls] = len;
+    ctx->fins[ctx->n_calls] = fin;
+    ++ctx->n_calls;
+    return len < ctx->max_consume ? len : ctx->max_consume;
+}
+
+
+/* lsquic_stream_readf() hands out data in the packets without copying,
+ * unless the data_in implementation copies it itself.
+ */
+static void
+test_readf (void)
+{
+    int s;
+    ssize_t nr;
+    const char data[] = "AAABBBCCC";
+    const int nocopy = !(stream_ctor_flags & SCF_USE_DI_HASH);
+    struct test_objs tobjs;
+    struct readf_ctx ctx;
+    stream_frame_t *frame;
+
+    init_test_objs(&tobjs, 0x4000, 0x4000, NULL);
+
+    lsquic_stream_t *stream = new_stream(&tobjs, 123);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.max_consume = 100;
+    nr = lsquic_stream_readf(stream, readf_cb, &ctx);
+    assert(-1 == nr && EWOULDBLOCK == errno);
+    assert(0 == ctx.n_calls);
+
+    frame = new_frame_in_ext(&tobjs, 0, 3, 0, &data[0]);
+    s = lsquic_stream_frame_in(stream, frame);
+    assert(0 == s);
+    frame = new_frame_in_ext(&tobjs, 3, 3, 0, &data[3]);
+    s = lsquic_stream_frame_in(stream, frame);
+    assert(0 == s);
+
+    nr = lsquic_stream_readf(stream, readf_cb, &ctx);
+    assert(6 == nr);
+    assert(0 == memcmp(ctx.copies[0], "AAA", 3) && !ctx.fins[0]);
+    if (nocopy)
+    {
+        /* The callback sees both frames in place */
+        assert(2 == ctx.n_calls);
+        assert((const unsigned char *) &data[0] == ctx.bufs[0]);
+        assert(3 == ctx.lens[0]);
+        assert((const unsigned char *) &data[3] == ctx.bufs[1]);
+        assert(3 == ctx.lens[1] && !ctx.fins[1]);
+    }
+
+    /* Partial consumption: the rest is offered again */
+    frame = new_frame_in_ext(&tobjs, 6, 3, 1, &data[6]);
+    s = lsquic_stream_frame_in(stream, frame);
+    assert(0 == s);
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.max_consume = 1;
+    nr = lsquic_stream_readf(stream, readf_cb, &ctx);
+    assert(1 == nr);
+    assert(1 == ctx.n_calls);
+    assert(3 == ctx.lens[0]);
+    assert(0 == memcmp(ctx.copies[0], "CCC", 3));
+    assert(!nocopy || (const unsigned char *) &data[6] == ctx.bufs[0]);
+    assert(!nocopy || ctx.fins[0]);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.max_consume = 100;
+    nr = lsquic_stream_readf(stream, readf_cb, &ctx);
+    assert(2 == nr);
+    assert(2 == ctx.lens[0]);
+    /* FIN is either delivered along with the data or in a separate call */
+    assert(ctx.fins[ctx.n_calls - 1]);
+    assert(ctx.n_calls == 1 || 0 == ctx.lens[ctx.n_calls - 1]);
+    assert(!nocopy || (const unsigned char *) &data[7] == ctx.bufs[0]);
+
+    memset(&ctx, 0, sizeof(ctx));
+    nr = lsquic_stream_readf(stream, readf_cb, &ctx);
+    assert(0 == nr);
+    assert(0 == ctx.n_calls);
+
+    lsquic_stream_destroy(stream);
+    deinit_test_objs(&tobjs);
+}
+
+
 /* Test that connection flow control does not go past the max when both
  * connection limited and unlimited streams are used.
  */
@@ -2806,6 +2915,8 @@ main (int argc, char **argv)
 
     test_read_in_middle();
 
+    test_readf();
+
     test_conn_unlimited();
 
     test_flushing();
@@ -0,0 +1,142 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * Test HPACK static table lookup.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lshpack.h"
+
+
+/* RFC 7541, Appendix A */
+static const struct {
+    const char *name, *value;
+} static_table[] =
+{
+    { ":authority",                  "", },
+    { ":method",                     "GET", },
+    { ":method",                     "POST", },
+    { ":path",                       "/", },
+    { ":path",                       "/index.html", },
+    { ":scheme",                     "http", },
+    { ":scheme",                     "https", },
+    { ":status",                     "200", },
+    { ":status",                     "204", },
+    { ":status",                     "206", },
+    { ":status",                     "304", },
+    { ":status",                     "400", },
+    { ":status",                     "404", },
+    { ":status",                     "500", },
+    { "accept-charset",              "", },
+    { "accept-encoding",             "gzip, deflate", },
+    { "accept-language",             "", },
+    { "accept-ranges",               "", },
+    { "accept",                      "", },
+    { "access-control-allow-origin", "", },
+    { "age",                         "", },
+    { "allow",                       "", },
+    { "authorization",               "", },
+    { "cache-control",               "", },
+    { "content-disposition",         "", },
+    { "content-encoding",            "", },
+    { "content-language",            "", },
+    { "content-length",              "", },
+    { "content-location",            "", },
+    { "content-range",               "", },
+    { "content-type",                "", },
+    { "cookie",                      "", },
+    { "date",                        "", },
+    { "etag",                        "", },
+    { "expect",                      "", },
+    { "expires",                     "", },
+    { "from",                        "", },
+    { "host",                        "", },
+    { "if-match",                    "", },
+    { "if-modified-since",           "", },
+    { "if-none-match",               "", },
+    { "if-range",                    "", },
+    { "if-unmodified-since",         "", },
+    { "last-modified",               "", },
+    { "link",                        "", },
+    { "location",                    "", },
+    { "max-forwards",                "", },
+    { "proxy-authenticate",          "", },
+    { "proxy-authorization",         "", },
+    { "range",                       "", },
+    { "referer",                     "", },
+    { "refresh",                     "", },
+    { "retry-after",                 "", },
+    { "server",                      "", },
+    { "set-cookie",                  "", },
+    { "strict-transport-security",   "", },
+    { "transfer-encoding",           "", },
+    { "user-agent",                  "", },
+    { "vary",                        "", },
+    { "via",                         "", },
+    { "www-authenticate",            "", },
+};
+
+#define N_ENTRIES (sizeof(static_table) / sizeof(static_table[0]))
+
+
+static unsigned
+lookup (const char *name, const char *value)
+{
+    return lshpack_enc_get_stx_tab_id(name, strlen(name), value,
+                                                            strlen(value));
+}
+
+
+static void
+test_all_entries (void)
+{
+    unsigned i;
+
+    assert(61 == N_ENTRIES);
+    for (i = 0; i < N_ENTRIES; ++i)
+        assert(i + 1 == lookup(static_table[i].name, static_table[i].value));
+}
+
+
+/* When only the name matches, ID of the first entry with that name is
+ * returned.
+ */
+static void
+test_name_only (void)
+{
+    assert(2 == lookup(":method", "PUT"));
+    assert(4 == lookup(":path", "/index.htm"));
+    assert(6 == lookup(":scheme", "ftp"));
+    assert(8 == lookup(":status", "201"));
+    assert(8 == lookup(":status", ""));
+    assert(16 == lookup("accept-encoding", "gzip, deflate, br"));
+    assert(32 == lookup("cookie", "a=b"));
+    assert(58 == lookup("user-agent", "curl/7.64.1"));
+}
+
+
+static void
+test_no_match (void)
+{
+    assert(0 == lookup("", ""));
+    assert(0 == lookup("x-forwarded-for", "127.0.0.1"));
+    assert(0 == lookup("Cookie", "a=b"));
+    /* Same length, first and last characters as static table names: */
+    assert(0 == lookup("coooie", ""));
+    assert(0 == lookup("content-lxngth", "1"));
+    assert(0 == lookup(":statuS", "200"));
+    assert(0 == lookup(":autho", ""));
+}
+
+
+int
+main (void)
+{
+    test_all_entries();
+    test_name_only();
+    test_no_match();
+    return 0;
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# Generate the perfect hash used for HPACK static table lookup in
+# src/lshpack/lshpack.c (STX_PHASH_BITS, STX_PHASH_MULT, stx_name2id).
+#
+# The key of a name is its length and its first and last characters:
+#
+#   key = len | name[0] << 8 | name[len - 1] << 16
+#
+# and the hash is the top STX_PHASH_BITS bits of key * STX_PHASH_MULT
+# (32-bit multiplication).  Odd multipliers are drawn from a PRNG with a
+# fixed seed until one maps all distinct static table names to different
+# slots.  The smallest table size for which a multiplier is found wins.
+#
+# Usage: tools/gen-stx-phash.py [src/lshpack/lshpack.c]
+#
+# The output replaces the block between the comment describing the
+# perfect hash and the stx_nameval_count table.
+
+import random
+import re
+import sys
+
+SEED = 1
+MAX_TRIES = 2000000
+
+
+def read_static_table(path):
+    with open(path) as f:
+        src = f.read()
+    entries = re.findall(r'\{ NAME_VAL\("([^"]*)",\s*"([^"]*)"\) \}', src)
+    if len(entries) != 61:
+        sys.exit('expected 61 static table entries, found %d' % len(entries))
+    return entries
+
+
+def key(name):
+    return len(name) | ord(name[0]) << 8 | ord(name[-1]) << 16
+
+
+def slot(k, mult, bits):
+    return ((k * mult) & 0xFFFFFFFF) >> (32 - bits)
+
+
+def find_multiplier(keys):
+    for bits in range(6, 9):
+        rng = random.Random(SEED)
+        for _ in range(MAX_TRIES):
+            mult = rng.getrandbits(32) | 1
+            if len(set(slot(k, mult, bits) for k in keys)) == len(keys):
+                return bits, mult
+    sys.exit('no perfect hash found')
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else 'src/lshpack/lshpack.c'
+    entries = read_static_table(path)
+
+    first_id = {}
+    for idx, (name, _) in enumerate(entries):
+        first_id.setdefault(name, idx + 1)
+    names = list(first_id)
+    keys = [key(name) for name in names]
+    if len(set(keys)) != len(keys):
+        sys.exit('static table names are not distinguished by the key')
+
+    bits, mult = find_multiplier(keys)
+    table = [0] * (1 << bits)
+    for name, k in zip(names, keys):
+        table[slot(k, mult, bits)] = first_id[name]
+
+    print('#define STX_PHASH_BITS %d' % bits)
+    print('#define STX_PHASH_MULT 0x%08XU' % mult)
+    print()
+    print('static const unsigned char stx_name2id[ 1 << STX_PHASH_BITS ] =')
+    print('{')
+    items = ['%-5s = %2d,' % ('[%d]' % i, v) for i, v in enumerate(table) if v]
+    line = '   '
+    for item in items:
+        if len(line) + 1 + len(item) > 78:
+            print(line.rstrip())
+            line = '   '
+        line += ' ' + item
+    print(line.rstrip())
+    print('};')
+
+
+if __name__ == '__main__':
+    main()